@@ -82,6 +82,8 @@ PottsMesh<DIM>::PottsMesh(std::vector<Node<DIM>*> nodes,
         }
     }
 
+    SetUpNeighbourStencils();
+
     this->mMeshChangesDuringSimulation = true;
 }
 
@@ -208,13 +210,12 @@ double PottsMesh<DIM>::GetSurfaceAreaOfElement(unsigned index)
     double surface_area = 0.0;
     for (unsigned node_index=0; node_index< p_element->GetNumNodes(); node_index++)
     {
-        std::set<unsigned> neighbouring_node_indices = GetVonNeumannNeighbouringNodeIndices(p_element->GetNode(node_index)->GetIndex());
+        unsigned global_node_index = p_element->GetNode(node_index)->GetIndex();
+        unsigned num_neighbours = GetNumVonNeumannNeighbours(global_node_index);
         unsigned local_edges = 2*DIM;
-        for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
-             iter != neighbouring_node_indices.end();
-             iter++)
+        for (unsigned neighbour=0; neighbour<num_neighbours; neighbour++)
         {
-            std::set<unsigned> neighbouring_node_element_indices = this->mNodes[*iter]->rGetContainingElementIndices();
+            const std::set<unsigned>& neighbouring_node_element_indices = this->mNodes[GetVonNeumannNeighbour(global_node_index, neighbour)]->rGetContainingElementIndices();
 
             if (neighbouring_node_element_indices.size()>0 && local_edges>0)
             {
@@ -242,6 +243,61 @@ std::set<unsigned> PottsMesh<DIM>::GetVonNeumannNeighbouringNodeIndices(unsigned
     return mVonNeumannNeighbouringNodeIndices[nodeIndex];
 }
 
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetNumMooreNeighbours(unsigned nodeIndex) const
+{
+    assert(nodeIndex + 1 < mMooreNeighbourStencilOffsets.size());
+    return mMooreNeighbourStencilOffsets[nodeIndex+1] - mMooreNeighbourStencilOffsets[nodeIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetMooreNeighbour(unsigned nodeIndex, unsigned localIndex) const
+{
+    assert(localIndex < GetNumMooreNeighbours(nodeIndex));
+    return mMooreNeighbourStencils[mMooreNeighbourStencilOffsets[nodeIndex] + localIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetNumVonNeumannNeighbours(unsigned nodeIndex) const
+{
+    assert(nodeIndex + 1 < mVonNeumannNeighbourStencilOffsets.size());
+    return mVonNeumannNeighbourStencilOffsets[nodeIndex+1] - mVonNeumannNeighbourStencilOffsets[nodeIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetVonNeumannNeighbour(unsigned nodeIndex, unsigned localIndex) const
+{
+    assert(localIndex < GetNumVonNeumannNeighbours(nodeIndex));
+    return mVonNeumannNeighbourStencils[mVonNeumannNeighbourStencilOffsets[nodeIndex] + localIndex];
+}
+
+template<unsigned DIM>
+void PottsMesh<DIM>::SetUpNeighbourStencils()
+{
+    assert(mVonNeumannNeighbouringNodeIndices.size() == mMooreNeighbouringNodeIndices.size());
+    unsigned num_nodes = mMooreNeighbouringNodeIndices.size();
+
+    mVonNeumannNeighbourStencils.clear();
+    mVonNeumannNeighbourStencilOffsets.resize(num_nodes+1);
+    mMooreNeighbourStencils.clear();
+    mMooreNeighbourStencilOffsets.resize(num_nodes+1);
+
+    for (unsigned node_index=0; node_index<num_nodes; node_index++)
+    {
+        mVonNeumannNeighbourStencilOffsets[node_index] = mVonNeumannNeighbourStencils.size();
+        mVonNeumannNeighbourStencils.insert(mVonNeumannNeighbourStencils.end(),
+                                            mVonNeumannNeighbouringNodeIndices[node_index].begin(),
+                                            mVonNeumannNeighbouringNodeIndices[node_index].end());
+
+        mMooreNeighbourStencilOffsets[node_index] = mMooreNeighbourStencils.size();
+        mMooreNeighbourStencils.insert(mMooreNeighbourStencils.end(),
+                                       mMooreNeighbouringNodeIndices[node_index].begin(),
+                                       mMooreNeighbouringNodeIndices[node_index].end());
+    }
+    mVonNeumannNeighbourStencilOffsets[num_nodes] = mVonNeumannNeighbourStencils.size();
+    mMooreNeighbourStencilOffsets[num_nodes] = mMooreNeighbourStencils.size();
+}
+
 template<unsigned DIM>
 void PottsMesh<DIM>::DeleteElement(unsigned index)
 {
@@ -363,6 +419,8 @@ void PottsMesh<DIM>::DeleteNode(unsigned index)
             mElements[elem_index]->ResetIndex(elem_index);
         }
     }
+
+    SetUpNeighbourStencils();
 }
 
 template<unsigned DIM>
@@ -617,6 +675,8 @@ void PottsMesh<DIM>::ConstructFromMeshReader(AbstractMeshReader<DIM, DIM>& rMesh
     {
         mMooreNeighbouringNodeIndices.resize(num_nodes);
     }
+
+    SetUpNeighbourStencils();
 }
 
 // Explicit instantiation
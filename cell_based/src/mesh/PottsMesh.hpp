@@ -80,6 +80,31 @@ protected:
     /** Vector of set of Moore neighbours for each node. */
     std::vector< std::set<unsigned> > mMooreNeighbouringNodeIndices;
 
+    /**
+     * The Von Neumann neighbours of all the nodes, stored contiguously in node order
+     * (each node's neighbours in increasing order).  Set up by SetUpNeighbourStencils().
+     */
+    std::vector<unsigned> mVonNeumannNeighbourStencils;
+
+    /** The position of the first Von Neumann neighbour of each node in mVonNeumannNeighbourStencils, plus one past the end. */
+    std::vector<unsigned> mVonNeumannNeighbourStencilOffsets;
+
+    /**
+     * The Moore neighbours of all the nodes, stored contiguously in node order
+     * (each node's neighbours in increasing order).  Set up by SetUpNeighbourStencils().
+     */
+    std::vector<unsigned> mMooreNeighbourStencils;
+
+    /** The position of the first Moore neighbour of each node in mMooreNeighbourStencils, plus one past the end. */
+    std::vector<unsigned> mMooreNeighbourStencilOffsets;
+
+    /**
+     * Copy the Von Neumann and Moore neighbour sets into contiguous arrays, so that a given
+     * neighbour can be looked up without copying or walking a set.  Must be called whenever
+     * the neighbour sets change.
+     */
+    void SetUpNeighbourStencils();
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -285,6 +310,40 @@ public:
      */
     std::set<unsigned> GetVonNeumannNeighbouringNodeIndices(unsigned nodeIndex);
 
+    /**
+     * @return the number of Moore neighbours of a node.
+     *
+     * @param nodeIndex global index of the node
+     */
+    unsigned GetNumMooreNeighbours(unsigned nodeIndex) const;
+
+    /**
+     * Get one of the Moore neighbours of a node, without copying the set returned by
+     * GetMooreNeighbouringNodeIndices().
+     *
+     * @param nodeIndex global index of the node
+     * @param localIndex which neighbour, counting from the lowest neighbour index (must be less than GetNumMooreNeighbours())
+     * @return the global index of the neighbouring node
+     */
+    unsigned GetMooreNeighbour(unsigned nodeIndex, unsigned localIndex) const;
+
+    /**
+     * @return the number of Von Neumann neighbours of a node.
+     *
+     * @param nodeIndex global index of the node
+     */
+    unsigned GetNumVonNeumannNeighbours(unsigned nodeIndex) const;
+
+    /**
+     * Get one of the Von Neumann neighbours of a node, without copying the set returned by
+     * GetVonNeumannNeighbouringNodeIndices().
+     *
+     * @param nodeIndex global index of the node
+     * @param localIndex which neighbour, counting from the lowest neighbour index (must be less than GetNumVonNeumannNeighbours())
+     * @return the global index of the neighbouring node
+     */
+    unsigned GetVonNeumannNeighbour(unsigned nodeIndex, unsigned localIndex) const;
+
     /**
      * Mark a node as deleted. Note that in a Potts mesh this requires the elements and connectivity to be updated accordingley.
      *
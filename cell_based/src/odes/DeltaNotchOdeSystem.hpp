@@ -94,6 +94,27 @@ public:
      * @param rDY filled in with the resulting derivatives (using  Collier et al. system of equations).
      */
     void EvaluateYDerivatives(double time, const std::vector<double>& rY, std::vector<double>& rDY);
+
+    /**
+     * Compute the RHS of the Collier et al. system of ODEs on plain arrays.
+     *
+     * This is non-virtual so that FixedSizeOneStepIvpOdeSolver can inline it;
+     * EvaluateYDerivatives() calls it, so the two always agree.
+     *
+     * @param time used to evaluate the RHS.
+     * @param rY value of the solution vector used to evaluate the RHS.
+     * @param rDY filled in with the resulting derivatives.
+     */
+    void EvaluateFixedSizeYDerivatives(double time, const double rY[2], double rDY[2])
+    {
+        double notch = rY[0];
+        double delta = rY[1];
+        double mean_delta = this->mParameters[0]; // Shorthand for "this->mParameter("Mean Delta");"
+
+        // The next two lines define the ODE system by Collier et al. (1996)
+        rDY[0] = mean_delta*mean_delta/(0.01 + mean_delta*mean_delta) - notch;  // d[Notch]/dt
+        rDY[1] = 1.0/(1.0 + 100.0*notch*notch) - delta;                   // d[Delta]/dt
+    }
 };
 
 // Declare identifier for the serializer
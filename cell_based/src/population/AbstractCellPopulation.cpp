@@ -297,15 +297,15 @@ std::vector<unsigned> AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetCellCyc
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 CellPtr AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetCellUsingLocationIndex(unsigned index)
 {
-    // Get the set of pointers to cells corresponding to this location index
-    std::set<CellPtr> cells = mLocationCellMap[index];
+    // Get the set of pointers to cells corresponding to this location index (find() is used so that this may be called concurrently)
+    std::map<unsigned, std::set<CellPtr> >::const_iterator iter = mLocationCellMap.find(index);
 
     // If there is only one cell attached return the cell. Note currently only one cell per index.
-    if (cells.size() == 1)
+    if (iter != mLocationCellMap.end() && iter->second.size() == 1)
     {
-        return *(cells.begin());
+        return *(iter->second.begin());
     }
-    if (cells.empty())
+    if (iter == mLocationCellMap.end() || iter->second.empty())
     {
         EXCEPTION("Location index input argument does not correspond to a Cell");
     }
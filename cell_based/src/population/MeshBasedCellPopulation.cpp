@@ -69,7 +69,8 @@ MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::MeshBasedCellPopulation(MutableM
       mAreaBasedDampingConstantParameter(0.1),
       mWriteVtkAsPoints(false),
       mOutputMeshInVtk(false),
-      mHasVariableRestLength(false)
+      mHasVariableRestLength(false),
+      mUseIncrementalReMesh(false)
 {
     mpMutableMesh = static_cast<MutableMesh<ELEMENT_DIM,SPACE_DIM>* >(&(this->mrMesh));
 
@@ -300,7 +301,9 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::Update(bool hasHadBirthsOrD
     NodeMap node_map(this->mrMesh.GetNumAllNodes());
 
     // We must use a static_cast to call ReMesh() as this method is not defined in parent mesh classes
-    static_cast<MutableMesh<ELEMENT_DIM,SPACE_DIM>&>((this->mrMesh)).ReMesh(node_map);
+    MutableMesh<ELEMENT_DIM,SPACE_DIM>& r_mutable_mesh = static_cast<MutableMesh<ELEMENT_DIM,SPACE_DIM>&>((this->mrMesh));
+    r_mutable_mesh.SetUseIncrementalReMesh(mUseIncrementalReMesh);
+    r_mutable_mesh.ReMesh(node_map);
 
     if (!node_map.IsIdentityMap())
     {
@@ -807,6 +810,18 @@ bool MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetOutputMeshInVtk()
     return mOutputMeshInVtk;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::SetUseIncrementalReMesh(bool useIncrementalReMesh)
+{
+    mUseIncrementalReMesh = useIncrementalReMesh;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetUseIncrementalReMesh()
+{
+    return mUseIncrementalReMesh;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //                          Spring iterator class                           //
 //////////////////////////////////////////////////////////////////////////////
@@ -1117,6 +1132,7 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::OutputCellPopulationParamet
     *rParamsFile << "\t\t<WriteVtkAsPoints>" << mWriteVtkAsPoints << "</WriteVtkAsPoints>\n";
     *rParamsFile << "\t\t<OutputMeshInVtk>" << mOutputMeshInVtk << "</OutputMeshInVtk>\n";
     *rParamsFile << "\t\t<HasVariableRestLength>" << mHasVariableRestLength << "</HasVariableRestLength>\n";
+    *rParamsFile << "\t\t<UseIncrementalReMesh>" << mUseIncrementalReMesh << "</UseIncrementalReMesh>\n";
 
     // Call method on direct parent class
     AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::OutputCellPopulationParameters(rParamsFile);
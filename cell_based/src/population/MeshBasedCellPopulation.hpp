@@ -43,6 +43,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TrianglesMeshReader.hpp"
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/set.hpp>
 #include <boost/serialization/vector.hpp>
@@ -89,6 +90,10 @@ private:
         archive & mWriteVtkAsPoints;
         archive & mOutputMeshInVtk;
         archive & mHasVariableRestLength;
+        if (version > 0)
+        {
+            archive & mUseIncrementalReMesh;
+        }
 
         this->Validate();
     }
@@ -142,6 +147,9 @@ protected:
     /** Whether springs have variable rest lengths. */
     bool mHasVariableRestLength;
 
+    /** Whether Update() remeshes incrementally (see MutableMesh::SetUseIncrementalReMesh()). */
+    bool mUseIncrementalReMesh;
+
     /** Node pairs for force calculations. */
     std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > > mNodePairs;
 
@@ -553,6 +561,22 @@ public:
      */
     bool GetOutputMeshInVtk();
 
+    /**
+     * Set mUseIncrementalReMesh.
+     *
+     * If true, Update() updates the existing triangulation locally where it can,
+     * rather than rebuilding it every time step; see
+     * MutableMesh::SetUseIncrementalReMesh().  This applies to 2D meshes only.
+     *
+     * @param useIncrementalReMesh whether to remesh incrementally
+     */
+    void SetUseIncrementalReMesh(bool useIncrementalReMesh);
+
+    /**
+     * @return mUseIncrementalReMesh.
+     */
+    bool GetUseIncrementalReMesh();
+
     /**
      * Overridden GetNeighbouringNodeIndices() method.
      *
@@ -589,6 +613,23 @@ public:
 #include "SerializationExportWrapper.hpp"
 EXPORT_TEMPLATE_CLASS_ALL_DIMS(MeshBasedCellPopulation)
 
+namespace boost {
+namespace serialization {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(MeshBasedCellPopulation, 1)
+ * with a templated class.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+struct version<MeshBasedCellPopulation<ELEMENT_DIM, SPACE_DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+} // namespace serialization
+} // namespace boost
+
 namespace boost
 {
 namespace serialization
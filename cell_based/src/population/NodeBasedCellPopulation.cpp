@@ -55,7 +55,9 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh,
       mDeleteMesh(deleteMesh),
       mUseVariableRadii(false),
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mUseVerletLists(false),
+      mVerletListSkin(0.0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 
@@ -71,7 +73,9 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh)
       mDeleteMesh(true),
       mUseVariableRadii(false), // will be set by serialize() method
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mUseVerletLists(false),
+      mVerletListSkin(0.0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 }
@@ -102,6 +106,8 @@ template<unsigned DIM>
 void NodeBasedCellPopulation<DIM>::Clear()
 {
     mNodePairs.clear();
+    mNodesAtLastPairCalculation.clear();
+    mNodeLocationsAtLastPairCalculation.clear();
 }
 
 template<unsigned DIM>
@@ -155,11 +161,26 @@ void NodeBasedCellPopulation<DIM>::Update(bool hasHadBirthsOrDeaths)
 
     RefreshHaloCells();
 
-    mpNodesOnlyMesh->CalculateInteriorNodePairs(mNodePairs, mNodeNeighbours);
+    // With Verlet lists we keep the node pairs until the nodes change or move too far
+    bool use_verlet_lists = mUseVerletLists && PetscTools::IsSequential();
+    bool calculate_node_pairs = !use_verlet_lists || hasHadBirthsOrDeaths || DoNodePairsNeedRecalculating();
+
+    if (calculate_node_pairs)
+    {
+        mpNodesOnlyMesh->CalculateInteriorNodePairs(mNodePairs, mNodeNeighbours);
+    }
 
     AddReceivedHaloCells();
 
-    mpNodesOnlyMesh->CalculateBoundaryNodePairs(mNodePairs, mNodeNeighbours);
+    if (calculate_node_pairs)
+    {
+        mpNodesOnlyMesh->CalculateBoundaryNodePairs(mNodePairs, mNodeNeighbours);
+
+        if (use_verlet_lists)
+        {
+            SetUpVerletLists();
+        }
+    }
 
     /*
      * Update cell radii based on CellData
@@ -180,6 +201,66 @@ void NodeBasedCellPopulation<DIM>::Update(bool hasHadBirthsOrDeaths)
     PetscTools::Barrier("Update");
 }
 
+template<unsigned DIM>
+bool NodeBasedCellPopulation<DIM>::DoNodePairsNeedRecalculating()
+{
+    if (mpNodesOnlyMesh->GetNumNodes() != mNodesAtLastPairCalculation.size())
+    {
+        return true;
+    }
+
+    // Check that no node has moved more than half the skin, so no pair can have closed by more than the skin
+    const double max_displacement_squared = 0.25*mVerletListSkin*mVerletListSkin;
+    unsigned i = 0;
+    for (typename AbstractMesh<DIM,DIM>::NodeIterator node_iter = mpNodesOnlyMesh->GetNodeIteratorBegin();
+         node_iter != mpNodesOnlyMesh->GetNodeIteratorEnd();
+         ++node_iter, ++i)
+    {
+        if (i >= mNodesAtLastPairCalculation.size() || &(*node_iter) != mNodesAtLastPairCalculation[i])
+        {
+            return true;
+        }
+
+        c_vector<double, DIM> displacement = node_iter->rGetLocation() - mNodeLocationsAtLastPairCalculation[i];
+        if (inner_prod(displacement, displacement) > max_displacement_squared)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetUpVerletLists()
+{
+    // Only keep pairs that can come within interaction distance minus the skin before the next recalculation
+    const double max_distance = mpNodesOnlyMesh->GetMaximumInteractionDistance();
+    unsigned num_kept = 0;
+    for (unsigned i=0; i<mNodePairs.size(); i++)
+    {
+        c_vector<double, DIM> node_a_to_b = mpNodesOnlyMesh->GetVectorFromAtoB(mNodePairs[i].first->rGetLocation(),
+                                                                               mNodePairs[i].second->rGetLocation());
+        if (norm_2(node_a_to_b) < max_distance)
+        {
+            mNodePairs[num_kept++] = mNodePairs[i];
+        }
+    }
+    mNodePairs.resize(num_kept);
+
+    // Record where the nodes are
+    mNodesAtLastPairCalculation.clear();
+    mNodeLocationsAtLastPairCalculation.clear();
+    mNodesAtLastPairCalculation.reserve(mpNodesOnlyMesh->GetNumNodes());
+    mNodeLocationsAtLastPairCalculation.reserve(mpNodesOnlyMesh->GetNumNodes());
+    for (typename AbstractMesh<DIM,DIM>::NodeIterator node_iter = mpNodesOnlyMesh->GetNodeIteratorBegin();
+         node_iter != mpNodesOnlyMesh->GetNodeIteratorEnd();
+         ++node_iter)
+    {
+        mNodesAtLastPairCalculation.push_back(&(*node_iter));
+        mNodeLocationsAtLastPairCalculation.push_back(node_iter->rGetLocation());
+    }
+}
+
 template<unsigned DIM>
 void NodeBasedCellPopulation<DIM>::UpdateMapsAfterRemesh(NodeMap& map)
 {
@@ -286,6 +367,8 @@ void NodeBasedCellPopulation<DIM>::OutputCellPopulationParameters(out_stream& rP
     *rParamsFile << "\t\t<MechanicsCutOffLength>" << mpNodesOnlyMesh->GetMaximumInteractionDistance() << "</MechanicsCutOffLength>\n";
     *rParamsFile << "\t\t<UseVariableRadii>" << mUseVariableRadii <<
 "</UseVariableRadii>\n";
+    *rParamsFile << "\t\t<UseVerletLists>" << mUseVerletLists << "</UseVerletLists>\n";
+    *rParamsFile << "\t\t<VerletListSkin>" << mVerletListSkin << "</VerletListSkin>\n";
 
     // Call method on direct parent class
     AbstractCentreBasedCellPopulation<DIM>::OutputCellPopulationParameters(rParamsFile);
@@ -339,6 +422,38 @@ void NodeBasedCellPopulation<DIM>::SetLoadBalanceFrequency(unsigned loadBalanceF
     mLoadBalanceFrequency = loadBalanceFrequency;
 }
 
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetUseVerletLists(bool useVerletLists)
+{
+    mUseVerletLists = useVerletLists;
+
+    // Make sure the node pairs are recalculated at the next update
+    mNodesAtLastPairCalculation.clear();
+    mNodeLocationsAtLastPairCalculation.clear();
+}
+
+template<unsigned DIM>
+bool NodeBasedCellPopulation<DIM>::GetUseVerletLists()
+{
+    return mUseVerletLists;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetVerletListSkin(double skin)
+{
+    if (skin < 0.0 || skin >= mpNodesOnlyMesh->GetMaximumInteractionDistance())
+    {
+        EXCEPTION("The Verlet list skin must be non-negative and less than the maximum interaction distance of the mesh.");
+    }
+    mVerletListSkin = skin;
+}
+
+template<unsigned DIM>
+double NodeBasedCellPopulation<DIM>::GetVerletListSkin()
+{
+    return mVerletListSkin;
+}
+
 template<unsigned DIM>
 double NodeBasedCellPopulation<DIM>::GetWidth(const unsigned& rDimension)
 {
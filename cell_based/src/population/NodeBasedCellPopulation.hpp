@@ -120,13 +120,26 @@ private:
     /** The frequency at which the mesh is rebalanced */
     unsigned mLoadBalanceFrequency;
 
+    /** Whether to keep the node pairs between time steps until the nodes have moved far enough to need new ones */
+    bool mUseVerletLists;
+
+    /** The skin distance used with Verlet lists, i.e. how far inside the maximum interaction distance interactions are guaranteed to be found */
+    double mVerletListSkin;
+
+    /** The nodes when #mNodePairs was last calculated (only used with Verlet lists) */
+    std::vector<Node<DIM>*> mNodesAtLastPairCalculation;
+
+    /** The locations of the nodes in #mNodesAtLastPairCalculation when #mNodePairs was last calculated */
+    std::vector<c_vector<double, DIM> > mNodeLocationsAtLastPairCalculation;
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
      * Serialize the object and its member variables.
      *
-     * Note that serialization of the nodes is handled by load/save_construct_data,
-     * so we don't actually have to do anything here except delegate to the base class.
+     * Note that serialization of the nodes is handled by load/save_construct_data.
+     * The node pairs kept for Verlet lists are not saved; they are recalculated at the
+     * first update after loading.
      *
      * @param archive the archive
      * @param version the current version of this class
@@ -136,6 +149,8 @@ private:
     {
         archive & boost::serialization::base_object<AbstractCentreBasedCellPopulation<DIM> >(*this);
         archive & mUseVariableRadii;
+        archive & mUseVerletLists;
+        archive & mVerletListSkin;
 
         this->Validate();
     }
@@ -215,6 +230,20 @@ private:
      */
     void UpdateMapsAfterRemesh(NodeMap& map);
 
+    /**
+     * With Verlet lists, check whether #mNodePairs is still good, i.e. the nodes are the same
+     * as when it was calculated, and none of them has moved more than half the skin since then.
+     *
+     * @return whether the node pairs need to be recalculated
+     */
+    bool DoNodePairsNeedRecalculating();
+
+    /**
+     * With Verlet lists, remove the node pairs that are further apart than the maximum interaction
+     * distance from #mNodePairs, and record where the nodes are now.
+     */
+    void SetUpVerletLists();
+
 protected:
 
 #undef COVERAGE_IGNORE // Avoid prototypes being treated as code by gcov
@@ -407,6 +436,40 @@ public:
      */
     void SetLoadBalanceFrequency(unsigned loadBalanceFrequency);
 
+    /**
+     * Set whether to use Verlet lists, i.e. keep the node pairs from one time step to the next,
+     * only searching for new pairs once a node has moved more than half the skin distance (see
+     * SetVerletListSkin()).  The pairs kept are those closer than the maximum interaction distance
+     * of the NodesOnlyMesh, so all pairs closer than this distance minus the skin are always found:
+     * the mesh's maximum interaction distance should be at least the cut-off length of the forces
+     * plus the skin.
+     *
+     * In parallel the node pairs are still recalculated every time step, as halo nodes are.
+     *
+     * @param useVerletLists whether to use Verlet lists (defaults to true)
+     */
+    void SetUseVerletLists(bool useVerletLists=true);
+
+    /**
+     * @return whether Verlet lists are used (see SetUseVerletLists()).
+     */
+    bool GetUseVerletLists();
+
+    /**
+     * Set the skin distance used with Verlet lists.  A larger skin means the node pairs are
+     * recalculated less often, but there are more of them.  Defaults to zero, which gives exactly
+     * the same interactions as not using Verlet lists, but only saves work while no node moves.
+     *
+     * @param skin the skin distance, which must be non-negative and less than the maximum interaction
+     *     distance of the mesh
+     */
+    void SetVerletListSkin(double skin);
+
+    /**
+     * @return the skin distance used with Verlet lists.
+     */
+    double GetVerletListSkin();
+
     /**
      * Overridden GetWidth() method.
      *
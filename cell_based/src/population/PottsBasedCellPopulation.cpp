@@ -33,6 +33,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 #include "PottsBasedCellPopulation.hpp"
 #include "RandomNumberGenerator.hpp"
 #include "Warnings.hpp"
@@ -41,6 +45,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VtkMeshWriter.hpp"
 #include "NodesOnlyMesh.hpp"
 #include "Exception.hpp"
+#include "FirstFailureCollector.hpp"
 
 // Cell writers
 #include "CellPopulationElementWriter.hpp"
@@ -84,7 +89,8 @@ PottsBasedCellPopulation<DIM>::PottsBasedCellPopulation(PottsMesh<DIM>& rMesh,
       mpElementTessellation(NULL),
       mpMutableMesh(NULL),
       mTemperature(0.1),
-      mNumSweepsPerTimestep(1)
+      mNumSweepsPerTimestep(1),
+      mUseCheckerboardSweeps(false)
 {
     mpPottsMesh = static_cast<PottsMesh<DIM>* >(&(this->mrMesh));
     // Check each element has only one cell associated with it
@@ -100,7 +106,8 @@ PottsBasedCellPopulation<DIM>::PottsBasedCellPopulation(PottsMesh<DIM>& rMesh)
       mpElementTessellation(NULL),
       mpMutableMesh(NULL),
       mTemperature(0.1),
-      mNumSweepsPerTimestep(1)
+      mNumSweepsPerTimestep(1),
+      mUseCheckerboardSweeps(false)
 {
     mpPottsMesh = static_cast<PottsMesh<DIM>* >(&(this->mrMesh));
 }
@@ -239,6 +246,12 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
         p_gen->Shuffle(mUpdateRuleCollection);
     }
 
+    if (mUseCheckerboardSweeps)
+    {
+        DoCheckerboardSweeps();
+        return;
+    }
+
     for (unsigned i=0; i<num_nodes*mNumSweepsPerTimestep; i++)
     {
         unsigned node_index;
@@ -253,72 +266,223 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
             node_index = i%num_nodes;
         }
 
-        Node<DIM>* p_node = this->mrMesh.GetNode(node_index);
-
         // Each node in the mesh must be in at most one element
-        assert(p_node->GetNumContainingElements() <= 1);
+        assert(this->mrMesh.GetNode(node_index)->GetNumContainingElements() <= 1);
 
         // Find a random available neighbouring node to overwrite current site
-        std::set<unsigned> neighbouring_node_indices = mpPottsMesh->GetMooreNeighbouringNodeIndices(node_index);
-        unsigned neighbour_location_index;
+        unsigned num_neighbours = mpPottsMesh->GetNumMooreNeighbours(node_index);
 
-        if (!neighbouring_node_indices.empty())
+        if (num_neighbours > 0)
         {
-            unsigned num_neighbours = neighbouring_node_indices.size();
             unsigned chosen_neighbour = p_gen->randMod(num_neighbours);
+            unsigned neighbour_location_index = mpPottsMesh->GetMooreNeighbour(node_index, chosen_neighbour);
 
-            std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-            for (unsigned j=0; j<chosen_neighbour; j++)
+            // Only calculate Hamiltonian and update elements if the nodes are from different elements, or one is from the medium
+            double delta_H = 0.0; // This is H_1-H_0.
+            if (CalculateChangeInHamiltonian(node_index, neighbour_location_index, delta_H))
             {
-                neighbour_iter++;
+                // Generate a uniform random number to do the random motion
+                double random_number = p_gen->ranf();
+
+                double p = exp(-delta_H/mTemperature);
+                if (delta_H <= 0 || random_number < p)
+                {
+                    // Do swap
+                    CopyNeighbourToNode(node_index, neighbour_location_index);
+                }
             }
+        }
+    }
+}
 
-            neighbour_location_index = *neighbour_iter;
+template<unsigned DIM>
+bool PottsBasedCellPopulation<DIM>::CalculateChangeInHamiltonian(unsigned nodeIndex, unsigned neighbourIndex, double& rDeltaH)
+{
+    const std::set<unsigned>& r_containing_elements = GetNode(nodeIndex)->rGetContainingElementIndices();
+    const std::set<unsigned>& r_neighbour_containing_elements = GetNode(neighbourIndex)->rGetContainingElementIndices();
 
-            std::set<unsigned> containing_elements = p_node->rGetContainingElementIndices();
-            std::set<unsigned> neighbour_containing_elements = GetNode(neighbour_location_index)->rGetContainingElementIndices();
-            // Only calculate Hamiltonian and update elements if the nodes are from different elements, or one is from the medium
-            if (    ( !containing_elements.empty() && neighbour_containing_elements.empty() )
-                 || ( containing_elements.empty() && !neighbour_containing_elements.empty() )
-                 || ( !containing_elements.empty() && !neighbour_containing_elements.empty() && *containing_elements.begin() != *neighbour_containing_elements.begin() ) )
+    if (    ( !r_containing_elements.empty() && r_neighbour_containing_elements.empty() )
+         || ( r_containing_elements.empty() && !r_neighbour_containing_elements.empty() )
+         || ( !r_containing_elements.empty() && !r_neighbour_containing_elements.empty() && *r_containing_elements.begin() != *r_neighbour_containing_elements.begin() ) )
+    {
+        rDeltaH = 0.0;
+
+        // Now add contributions to the Hamiltonian from each AbstractPottsUpdateRule
+        for (typename std::vector<boost::shared_ptr<AbstractPottsUpdateRule<DIM> > >::iterator iter = mUpdateRuleCollection.begin();
+             iter != mUpdateRuleCollection.end();
+             ++iter)
+        {
+            rDeltaH += (*iter)->EvaluateHamiltonianContribution(neighbourIndex, nodeIndex, *this);
+        }
+        return true;
+    }
+    return false;
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::CopyNeighbourToNode(unsigned nodeIndex, unsigned neighbourIndex)
+{
+    std::set<unsigned> containing_elements = GetNode(nodeIndex)->rGetContainingElementIndices();
+    std::set<unsigned> neighbour_containing_elements = GetNode(neighbourIndex)->rGetContainingElementIndices();
+
+    // Remove the current node from any elements containing it (there should be at most one such element)
+    for (std::set<unsigned>::iterator iter = containing_elements.begin();
+         iter != containing_elements.end();
+         ++iter)
+    {
+        GetElement(*iter)->DeleteNode(GetElement(*iter)->GetNodeLocalIndex(nodeIndex));
+
+        ///\todo If this causes the element to have no nodes then flag the element and cell to be deleted
+    }
+
+    // Next add the current node to any elements containing the neighbouring node (there should be at most one such element)
+    for (std::set<unsigned>::iterator iter = neighbour_containing_elements.begin();
+         iter != neighbour_containing_elements.end();
+         ++iter)
+    {
+        GetElement(*iter)->AddNode(this->mrMesh.GetNode(nodeIndex));
+    }
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::SetUpSublattices()
+{
+    unsigned num_nodes = this->mrMesh.GetNumNodes();
+    std::vector<unsigned> colours(num_nodes, UNSIGNED_UNSET);
+    mSublattices.clear();
+
+    for (unsigned node_index=0; node_index<num_nodes; node_index++)
+    {
+        // Find the colours already used by neighbours of this node
+        std::vector<bool> colour_used(mSublattices.size(), false);
+        for (unsigned i=0; i<mpPottsMesh->GetNumMooreNeighbours(node_index); i++)
+        {
+            unsigned neighbour_colour = colours[mpPottsMesh->GetMooreNeighbour(node_index, i)];
+            if (neighbour_colour != UNSIGNED_UNSET)
             {
-                double delta_H = 0.0; // This is H_1-H_0.
+                colour_used[neighbour_colour] = true;
+            }
+        }
+
+        // Use the first free colour, adding a new sublattice if necessary
+        unsigned colour = 0;
+        while (colour < colour_used.size() && colour_used[colour])
+        {
+            colour++;
+        }
+        if (colour == mSublattices.size())
+        {
+            mSublattices.push_back(std::vector<unsigned>());
+        }
+        colours[node_index] = colour;
+        mSublattices[colour].push_back(node_index);
+    }
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::DoCheckerboardSweeps()
+{
+    RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+
+    // The sublattices only need recalculating if nodes have been deleted from the mesh
+    unsigned num_nodes_in_sublattices = 0;
+    for (unsigned i=0; i<mSublattices.size(); i++)
+    {
+        num_nodes_in_sublattices += mSublattices[i].size();
+    }
+    if (num_nodes_in_sublattices != this->mrMesh.GetNumNodes())
+    {
+        SetUpSublattices();
+    }
+
+    bool use_threads = false;
+#ifdef _OPENMP
+    use_threads = (omp_get_max_threads() > 1) && !omp_in_parallel();
+    for (unsigned i=0; i<mUpdateRuleCollection.size(); i++)
+    {
+        use_threads = use_threads && mUpdateRuleCollection[i]->CanEvaluateHamiltonianContributionConcurrently();
+    }
+#endif // _OPENMP
 
-                // Now add contributions to the Hamiltonian from each AbstractPottsUpdateRule
-                for (typename std::vector<boost::shared_ptr<AbstractPottsUpdateRule<DIM> > >::iterator iter = mUpdateRuleCollection.begin();
-                     iter != mUpdateRuleCollection.end();
-                     ++iter)
+    std::vector<unsigned> sublattice_order(mSublattices.size());
+    for (unsigned i=0; i<sublattice_order.size(); i++)
+    {
+        sublattice_order[i] = i;
+    }
+
+    for (unsigned sweep=0; sweep<mNumSweepsPerTimestep; sweep++)
+    {
+        if (this->mUpdateNodesInRandomOrder)
+        {
+            p_gen->Shuffle(sublattice_order);
+        }
+
+        for (unsigned k=0; k<sublattice_order.size(); k++)
+        {
+            const std::vector<unsigned>& r_sites = mSublattices[sublattice_order[k]];
+            const unsigned num_sites = r_sites.size();
+
+            // Draw the random numbers for every trial in node order, so that they don't depend on the number of threads
+            std::vector<unsigned> neighbours(num_sites, UNSIGNED_UNSET);
+            std::vector<double> random_numbers(num_sites);
+            for (unsigned i=0; i<num_sites; i++)
+            {
+                unsigned num_neighbours = mpPottsMesh->GetNumMooreNeighbours(r_sites[i]);
+                if (num_neighbours > 0)
                 {
-                    delta_H += (*iter)->EvaluateHamiltonianContribution(neighbour_location_index, p_node->GetIndex(), *this);
+                    neighbours[i] = mpPottsMesh->GetMooreNeighbour(r_sites[i], p_gen->randMod(num_neighbours));
+                    random_numbers[i] = p_gen->ranf();
                 }
+            }
 
-                // Generate a uniform random number to do the random motion
-                double random_number = p_gen->ranf();
+            // Evaluate every trial from the current configuration (no two sites in a sublattice are neighbours)
+            std::vector<unsigned char> accept(num_sites, 0u);
+            if (use_threads)
+            {
+                // Exceptions must not escape a parallel region, so the one for the first site is thrown once all threads have finished
+                FirstFailureCollector failures;
 
-                double p = exp(-delta_H/mTemperature);
-                if (delta_H <= 0 || random_number < p)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+                for (int i=0; i<(int)num_sites; i++)
                 {
-                    // Do swap
-
-                    // Remove the current node from any elements containing it (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = containing_elements.begin();
-                         iter != containing_elements.end();
-                         ++iter)
+                    try
                     {
-                        GetElement(*iter)->DeleteNode(GetElement(*iter)->GetNodeLocalIndex(node_index));
-
-                        ///\todo If this causes the element to have no nodes then flag the element and cell to be deleted
+                        double delta_H = 0.0;
+                        if (neighbours[i] != UNSIGNED_UNSET && CalculateChangeInHamiltonian(r_sites[i], neighbours[i], delta_H))
+                        {
+                            accept[i] = (delta_H <= 0 || random_numbers[i] < exp(-delta_H/mTemperature));
+                        }
                     }
+                    catch (Exception& e)
+                    {
+                        failures.RecordFailure(i, e);
+                    }
+                }
 
-                    // Next add the current node to any elements containing the neighbouring node (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = neighbour_containing_elements.begin();
-                         iter != neighbour_containing_elements.end();
-                         ++iter)
+                failures.ThrowFirstFailure();
+            }
+            else
+            {
+                for (unsigned i=0; i<num_sites; i++)
+                {
+                    double delta_H = 0.0;
+                    if (neighbours[i] != UNSIGNED_UNSET && CalculateChangeInHamiltonian(r_sites[i], neighbours[i], delta_H))
                     {
-                        GetElement(*iter)->AddNode(this->mrMesh.GetNode(node_index));
+                        accept[i] = (delta_H <= 0 || random_numbers[i] < exp(-delta_H/mTemperature));
                     }
                 }
             }
+
+            // Carry out the accepted moves in node order
+            for (unsigned i=0; i<num_sites; i++)
+            {
+                if (accept[i])
+                {
+                    CopyNeighbourToNode(r_sites[i], neighbours[i]);
+                }
+            }
         }
     }
 }
@@ -468,6 +632,7 @@ void PottsBasedCellPopulation<DIM>::OutputCellPopulationParameters(out_stream& r
 {
     *rParamsFile << "\t\t<Temperature>" << mTemperature << "</Temperature>\n";
     *rParamsFile << "\t\t<NumSweepsPerTimestep>" << mNumSweepsPerTimestep << "</NumSweepsPerTimestep>\n";
+    *rParamsFile << "\t\t<UseCheckerboardSweeps>" << mUseCheckerboardSweeps << "</UseCheckerboardSweeps>\n";
 
     // Call method on direct parent class
     AbstractOnLatticeCellPopulation<DIM>::OutputCellPopulationParameters(rParamsFile);
@@ -497,6 +662,18 @@ unsigned PottsBasedCellPopulation<DIM>::GetNumSweepsPerTimestep()
     return mNumSweepsPerTimestep;
 }
 
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::SetUseCheckerboardSweeps(bool useCheckerboardSweeps)
+{
+    mUseCheckerboardSweeps = useCheckerboardSweeps;
+}
+
+template<unsigned DIM>
+bool PottsBasedCellPopulation<DIM>::GetUseCheckerboardSweeps()
+{
+    return mUseCheckerboardSweeps;
+}
+
 template<unsigned DIM>
 void PottsBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDirectory)
 {
@@ -97,6 +97,52 @@ private:
      */
     unsigned mNumSweepsPerTimestep;
 
+    /**
+     * Whether UpdateCellLocations() uses checkerboard sweeps (see SetUseCheckerboardSweeps()).
+     * Initialised to false in the constructor.  Not archived.
+     */
+    bool mUseCheckerboardSweeps;
+
+    /**
+     * The sublattices used by checkerboard sweeps: a partition of the nodes into sets, none of
+     * which contains two Moore neighbours.  Set up by SetUpSublattices() when first needed.
+     */
+    std::vector<std::vector<unsigned> > mSublattices;
+
+    /**
+     * Colour the nodes greedily, in index order, so that no two Moore neighbours share a colour,
+     * and store the nodes of each colour in mSublattices.  On the regular lattices made by
+     * PottsMeshGenerator this gives the usual 2^DIM checkerboard sublattices.
+     */
+    void SetUpSublattices();
+
+    /**
+     * Calculate the change in the Hamiltonian if a node were to be copied into (i.e. join the
+     * element of) a neighbouring node, by summing the contributions from the update rules.
+     *
+     * @param nodeIndex the index of the node which may change element
+     * @param neighbourIndex the index of the neighbouring node
+     * @param rDeltaH set to the change in the Hamiltonian, H_1-H_0, if the two nodes are in different
+     *     elements (or one is in the medium)
+     * @return whether the two nodes are in different elements (or one is in the medium); if not,
+     *     there is nothing to do and rDeltaH is not set
+     */
+    bool CalculateChangeInHamiltonian(unsigned nodeIndex, unsigned neighbourIndex, double& rDeltaH);
+
+    /**
+     * Move a node from the element containing it (if any) to the element containing a neighbouring
+     * node (if any).
+     *
+     * @param nodeIndex the index of the node which changes element
+     * @param neighbourIndex the index of the neighbouring node
+     */
+    void CopyNeighbourToNode(unsigned nodeIndex, unsigned neighbourIndex);
+
+    /**
+     * Carry out mNumSweepsPerTimestep checkerboard sweeps (see SetUseCheckerboardSweeps()).
+     */
+    void DoCheckerboardSweeps();
+
     friend class boost::serialization::access;
     /**
      * Serialize the object and its member variables.
@@ -125,6 +171,7 @@ private:
         archive & mUpdateRuleCollection;
         archive & mTemperature;
         archive & mNumSweepsPerTimestep;
+        archive & mUseCheckerboardSweeps;
 
 #undef COVERAGE_IGNORE
     }
@@ -407,6 +454,36 @@ public:
      */
     unsigned GetNumSweepsPerTimestep();
 
+    /**
+     * Set whether UpdateCellLocations() uses checkerboard sweeps.
+     *
+     * By default each sweep carries out GetNumNodes() Metropolis trials one after another, each
+     * seeing the result of the last.  In a checkerboard sweep the nodes are split into sublattices
+     * containing no two Moore neighbours, and all the trials for one sublattice are evaluated from the
+     * same configuration and then carried out.  A trial only changes its own node, and only chooses
+     * a neighbour outside the sublattice, so local quantities (such as adhesion energies) are exact;
+     * but global quantities (such as the volume and surface area of each element) are those at the
+     * start of the sublattice.  This is a standard approximation, and is a different Monte Carlo
+     * scheme to the default, so results will differ.
+     *
+     * If Chaste is built with OpenMP (the 'openmp' build option) and every update rule
+     * CanEvaluateHamiltonianContributionConcurrently(), the trials for each sublattice are evaluated
+     * by several threads.  All random numbers are drawn in node order before the trials are
+     * evaluated, and the accepted moves are carried out in node order, so the results do not depend
+     * on the number of threads.
+     *
+     * Sublattices are visited in a random order if the population updates nodes in a random order
+     * (see SetUpdateNodesInRandomOrder()), otherwise in order.
+     *
+     * @param useCheckerboardSweeps whether to use checkerboard sweeps (defaults to true)
+     */
+    void SetUseCheckerboardSweeps(bool useCheckerboardSweeps=true);
+
+    /**
+     * @return mUseCheckerboardSweeps
+     */
+    bool GetUseCheckerboardSweeps();
+
     /**
      * Create a Element tessellation of the mesh for use in visualising the mesh.
      */
@@ -95,9 +95,7 @@ bool CellCycleModelOdeHandler::SolveOdeToTime(double currentTime)
     {
         AdjustOdeParameters(currentTime);
 
-        mpOdeSolver->SolveAndUpdateStateVariable(mpOdeSystem, mLastTime, currentTime, GetDt());
-
-        stopping_event_occurred = mpOdeSolver->StoppingEventOccurred();
+        stopping_event_occurred = SolveOdeStep(currentTime);
         if (stopping_event_occurred)
         {
             mLastTime = mpOdeSolver->GetStoppingTime();
@@ -114,6 +112,12 @@ void CellCycleModelOdeHandler::AdjustOdeParameters(double currentTime)
 {
 }
 
+bool CellCycleModelOdeHandler::SolveOdeStep(double currentTime)
+{
+    mpOdeSolver->SolveAndUpdateStateVariable(mpOdeSystem, mLastTime, currentTime, GetDt());
+    return mpOdeSolver->StoppingEventOccurred();
+}
+
 void CellCycleModelOdeHandler::SetLastTime(double lastTime)
 {
     mLastTime = lastTime;
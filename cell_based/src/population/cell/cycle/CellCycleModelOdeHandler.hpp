@@ -103,6 +103,18 @@ protected:
      */
     virtual void AdjustOdeParameters(double currentTime);
 
+    /**
+     * Solve the ODE system from #mLastTime to currentTime.  Called by SolveOdeToTime(),
+     * after AdjustOdeParameters(); by default this uses #mpOdeSolver.  Subclasses may
+     * override this to take a faster path for their own ODE system.
+     *
+     * @param currentTime  the time up to which to solve the system
+     *
+     * @return whether a stopping event occurred, in which case #mpOdeSolver
+     *     holds the stopping time.
+     */
+    virtual bool SolveOdeStep(double currentTime);
+
 public:
 
     /**
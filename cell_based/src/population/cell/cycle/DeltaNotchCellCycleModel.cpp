@@ -37,6 +37,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "DeltaNotchCellCycleModel.hpp"
 #include "CellCycleModelOdeSolver.hpp"
 #include "CvodeAdaptor.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "FixedSizeOneStepIvpOdeSolver.hpp"
 #include "Exception.hpp"
 
 
@@ -87,10 +89,24 @@ void DeltaNotchCellCycleModel::UpdateCellCyclePhase()
 {
     assert(SimulationTime::Instance()->IsStartTimeSetUp());
     UpdateDeltaNotch();
+
     SolveOdeToTime(SimulationTime::Instance()->GetTime());
     AbstractSimpleCellCycleModel::UpdateCellCyclePhase();
 }
 
+bool DeltaNotchCellCycleModel::SolveOdeStep(double currentTime)
+{
+    DeltaNotchOdeSystem* p_ode_system = dynamic_cast<DeltaNotchOdeSystem*>(mpOdeSystem);
+    if (p_ode_system != NULL
+        && dynamic_cast<CellCycleModelOdeSolver<DeltaNotchCellCycleModel, RungeKutta4IvpOdeSolver>*>(mpOdeSolver.get()) != NULL)
+    {
+        // This system has no stopping event, so the fixed-size RK4 path gives the same answer without heap allocation or virtual calls
+        FixedSizeOneStepIvpOdeSolver<FixedSizeRungeKutta4Step>::SolveAndUpdateStateVariable<2>(*p_ode_system, mLastTime, currentTime, GetDt());
+        return false;
+    }
+    return CellCycleModelOdeHandler::SolveOdeStep(currentTime);
+}
+
 void DeltaNotchCellCycleModel::Initialise()
 {
     assert(mpOdeSystem == NULL);
@@ -76,6 +76,21 @@ private:
      */
     std::vector<double> mInitialConditions;
 
+protected:
+
+    /**
+     * Overridden SolveOdeStep() method.
+     *
+     * When the model uses the shared RungeKutta4IvpOdeSolver on a DeltaNotchOdeSystem,
+     * the system is solved with FixedSizeOneStepIvpOdeSolver instead, which takes the
+     * same steps; otherwise the generic solver is used.
+     *
+     * @param currentTime  the time up to which to solve the system
+     *
+     * @return whether a stopping event occurred
+     */
+    virtual bool SolveOdeStep(double currentTime);
+
 public:
 
     /**
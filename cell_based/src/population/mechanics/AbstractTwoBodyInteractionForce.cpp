@@ -33,7 +33,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 #include "AbstractTwoBodyInteractionForce.hpp"
+#include "FirstFailureCollector.hpp"
 #include "IsNan.hpp"
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -78,50 +83,78 @@ void AbstractTwoBodyInteractionForce<ELEMENT_DIM,SPACE_DIM>::AddForceContributio
     {
         MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>* p_static_cast_cell_population = static_cast<MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation);
 
-        // Iterate over all springs and add force contributions
+        // Collect the pairs of nodes joined by springs
+        std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > > node_pairs;
         for (typename MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::SpringIterator spring_iterator = p_static_cast_cell_population->SpringsBegin();
              spring_iterator != p_static_cast_cell_population->SpringsEnd();
              ++spring_iterator)
         {
-            unsigned nodeA_global_index = spring_iterator.GetNodeA()->GetIndex();
-            unsigned nodeB_global_index = spring_iterator.GetNodeB()->GetIndex();
-
-            // Calculate the force between nodes
-            c_vector<double, SPACE_DIM> force = CalculateForceBetweenNodes(nodeA_global_index, nodeB_global_index, rCellPopulation);
-
-            // Add the force contribution to each node
-            c_vector<double, SPACE_DIM> negative_force = -1.0*force;
-            spring_iterator.GetNodeB()->AddAppliedForceContribution(negative_force);
-            spring_iterator.GetNodeA()->AddAppliedForceContribution(force);
+            node_pairs.push_back(std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* >(spring_iterator.GetNodeA(), spring_iterator.GetNodeB()));
         }
+
+        AddForceContributionsFromNodePairs(node_pairs, rCellPopulation);
     }
     else    // This is a NodeBasedCellPopulation
     {
         AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>* p_static_cast_cell_population = static_cast<AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation);
 
-        std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > >& r_node_pairs = p_static_cast_cell_population->rGetNodePairs();
+        AddForceContributionsFromNodePairs(p_static_cast_cell_population->rGetNodePairs(), rCellPopulation);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTwoBodyInteractionForce<ELEMENT_DIM,SPACE_DIM>::AddForceContributionsFromNodePairs(std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > >& rNodePairs,
+                                                                                             AbstractCellPopulation<ELEMENT_DIM,SPACE_DIM>& rCellPopulation)
+{
+    const unsigned num_pairs = rNodePairs.size();
+    std::vector<c_vector<double, SPACE_DIM> > pair_forces(num_pairs);
 
-        for (typename std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > >::iterator iter = r_node_pairs.begin();
-            iter != r_node_pairs.end();
-            iter++)
-        {
-            std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > pair = *iter;
+    bool use_threads = false;
+#ifdef _OPENMP
+    use_threads = (omp_get_max_threads() > 1) && !omp_in_parallel() && CanCalculateForcesConcurrently();
+#endif // _OPENMP
 
-            unsigned node_a_index = pair.first->GetIndex();
-            unsigned node_b_index = pair.second->GetIndex();
+    if (use_threads)
+    {
+        // Exceptions must not escape a parallel region, so the one for the first pair is thrown once all threads have finished
+        FirstFailureCollector failures;
 
-            // Calculate the force between nodes
-            c_vector<double, SPACE_DIM> force = CalculateForceBetweenNodes(node_a_index, node_b_index, rCellPopulation);
-            for (unsigned j=0; j<SPACE_DIM; j++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+        for (int i=0; i<(int)num_pairs; i++)
+        {
+            try
             {
-                assert(!std::isnan(force[j]));
+                pair_forces[i] = CalculateForceBetweenNodes(rNodePairs[i].first->GetIndex(), rNodePairs[i].second->GetIndex(), rCellPopulation);
             }
+            catch (Exception& e)
+            {
+                failures.RecordFailure(i, e);
+            }
+        }
+
+        failures.ThrowFirstFailure();
+    }
+    else
+    {
+        for (unsigned i=0; i<num_pairs; i++)
+        {
+            pair_forces[i] = CalculateForceBetweenNodes(rNodePairs[i].first->GetIndex(), rNodePairs[i].second->GetIndex(), rCellPopulation);
+        }
+    }
 
-            // Add the force contribution to each node
-            c_vector<double, SPACE_DIM> negative_force = -1.0*force;
-            pair.first->AddAppliedForceContribution(force);
-            pair.second->AddAppliedForceContribution(negative_force);
+    // Add the force contribution to each node, in the same order whatever the number of threads
+    for (unsigned i=0; i<num_pairs; i++)
+    {
+        for (unsigned j=0; j<SPACE_DIM; j++)
+        {
+            assert(!std::isnan(pair_forces[i][j]));
         }
+
+        c_vector<double, SPACE_DIM> negative_force = -1.0*pair_forces[i];
+        rNodePairs[i].first->AddAppliedForceContribution(pair_forces[i]);
+        rNodePairs[i].second->AddAppliedForceContribution(negative_force);
     }
 }
 
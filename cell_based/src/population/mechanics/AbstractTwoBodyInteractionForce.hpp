@@ -39,8 +39,16 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractForce.hpp"
 #include "MeshBasedCellPopulation.hpp"
 #include "NodeBasedCellPopulation.hpp"
+
 /**
  * An abstract class for two-body force laws.
+ *
+ * AddForceContribution() first calculates the force for every interacting pair of nodes
+ * into a contiguous buffer, and then adds them to the nodes in pair order.  If Chaste is built
+ * with OpenMP (the 'openmp' build option) and the concrete class says that
+ * CanCalculateForcesConcurrently(), the forces are calculated by several threads; since they
+ * are still added to the nodes by one thread in the same order, the results don't depend on
+ * the number of threads.
  */
 template<unsigned  ELEMENT_DIM, unsigned SPACE_DIM=ELEMENT_DIM>
 class AbstractTwoBodyInteractionForce : public AbstractForce<ELEMENT_DIM, SPACE_DIM>
@@ -71,6 +79,26 @@ protected:
     /** Mechanics cut off length. */
     double mMechanicsCutOffLength;
 
+    /**
+     * @return whether CalculateForceBetweenNodes() may be called for different pairs of nodes at
+     * the same time, i.e. it only reads the cell population and this object, or protects anything
+     * it modifies.  Defaults to false; concrete classes should override this to return true
+     * when it is safe.
+     */
+    virtual bool CanCalculateForcesConcurrently()
+    {
+        return false;
+    }
+
+    /**
+     * Calculate the forces between the given pairs of nodes, and add them to the nodes.
+     *
+     * @param rNodePairs the interacting pairs of nodes
+     * @param rCellPopulation the cell population
+     */
+    void AddForceContributionsFromNodePairs(std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > >& rNodePairs,
+                                            AbstractCellPopulation<ELEMENT_DIM,SPACE_DIM>& rCellPopulation);
+
 public:
 
     /**
@@ -33,6 +33,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <typeinfo>
+
 #include "DifferentialAdhesionGeneralisedLinearSpringForce.hpp"
 #include "NodeBasedCellPopulation.hpp"
 #include "CellLabel.hpp"
@@ -45,6 +47,12 @@ DifferentialAdhesionGeneralisedLinearSpringForce<ELEMENT_DIM, SPACE_DIM>::Differ
 {
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool DifferentialAdhesionGeneralisedLinearSpringForce<ELEMENT_DIM, SPACE_DIM>::CanCalculateForcesConcurrently()
+{
+    return typeid(*this) == typeid(DifferentialAdhesionGeneralisedLinearSpringForce<ELEMENT_DIM, SPACE_DIM>);
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double DifferentialAdhesionGeneralisedLinearSpringForce<ELEMENT_DIM, SPACE_DIM>::VariableSpringConstantMultiplicationFactor(
     unsigned nodeAGlobalIndex,
@@ -92,6 +92,18 @@ private :
         archive & mHeterotypicSpringConstantMultiplier;
     }
 
+protected :
+
+    /**
+     * Overridden CanCalculateForcesConcurrently() method.
+     *
+     * VariableSpringConstantMultiplicationFactor() only reads the cells' labels, so this class
+     * is safe to use concurrently; subclasses must opt in themselves.
+     *
+     * @return whether this object is a DifferentialAdhesionGeneralisedLinearSpringForce (rather than a subclass)
+     */
+    virtual bool CanCalculateForcesConcurrently();
+
 public :
 
     /**
@@ -33,6 +33,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <typeinfo>
+
 #include "GeneralisedLinearSpringForce.hpp"
 #include "IsNan.hpp"
 
@@ -63,6 +65,12 @@ GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>::~GeneralisedLinearSpringFor
 {
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>::CanCalculateForcesConcurrently()
+{
+    return typeid(*this) == typeid(GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>);
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>::CalculateForceBetweenNodes(unsigned nodeAGlobalIndex,
                                                                                     unsigned nodeBGlobalIndex,
@@ -154,16 +162,22 @@ c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>:
 
         std::pair<CellPtr,CellPtr> cell_pair = p_static_cast_cell_population->CreateCellPair(p_cell_A, p_cell_B);
 
-        if (p_static_cast_cell_population->IsMarkedSpring(cell_pair))
-        {
-            // Spring rest length increases from a small value to the normal rest length over 1 hour
-            double lambda = mMeinekeDivisionRestingSpringLength;
-            rest_length = lambda + (rest_length_final - lambda) * ageA/mMeinekeSpringGrowthDuration;
-        }
-        if (ageA + SimulationTime::Instance()->GetTimeStep() >= mMeinekeSpringGrowthDuration)
+        // The set of marked springs is shared by all pairs, so only one thread may use it at a time
+#ifdef _OPENMP
+#pragma omp critical(GeneralisedLinearSpringForceMarkedSprings)
+#endif // _OPENMP
         {
-            // This spring is about to go out of scope
-            p_static_cast_cell_population->UnmarkSpring(cell_pair);
+            if (p_static_cast_cell_population->IsMarkedSpring(cell_pair))
+            {
+                // Spring rest length increases from a small value to the normal rest length over 1 hour
+                double lambda = mMeinekeDivisionRestingSpringLength;
+                rest_length = lambda + (rest_length_final - lambda) * ageA/mMeinekeSpringGrowthDuration;
+            }
+            if (ageA + SimulationTime::Instance()->GetTimeStep() >= mMeinekeSpringGrowthDuration)
+            {
+                // This spring is about to go out of scope
+                p_static_cast_cell_population->UnmarkSpring(cell_pair);
+            }
         }
     }
 
@@ -113,6 +113,19 @@ protected:
      */
     double mMeinekeSpringGrowthDuration;
 
+    /**
+     * Overridden CanCalculateForcesConcurrently() method.
+     *
+     * CalculateForceBetweenNodes() only modifies the cell population's set of marked springs,
+     * which it does in a critical section.  A subclass may override CalculateForceBetweenNodes()
+     * or VariableSpringConstantMultiplicationFactor() with methods that modify shared state, so
+     * this is only true for this exact class: subclasses must opt in themselves, by overriding
+     * this method, once they have been checked.
+     *
+     * @return whether this object is a GeneralisedLinearSpringForce (rather than a subclass)
+     */
+    virtual bool CanCalculateForcesConcurrently();
+
 public:
 
     /**
@@ -33,6 +33,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <typeinfo>
+
 #include "RepulsionForce.hpp"
 #include "IsNan.hpp"
 
@@ -53,45 +55,36 @@ void RepulsionForce<DIM>::AddForceContribution(AbstractCellPopulation<DIM>& rCel
 
     std::vector< std::pair<Node<DIM>*, Node<DIM>* > >& r_node_pairs = (static_cast<NodeBasedCellPopulation<DIM>*>(&rCellPopulation))->rGetNodePairs();
 
-    for (typename std::vector< std::pair<Node<DIM>*, Node<DIM>* > >::iterator iter = r_node_pairs.begin();
-        iter != r_node_pairs.end();
-        iter++)
+    this->AddForceContributionsFromNodePairs(r_node_pairs, rCellPopulation);
+}
+
+template<unsigned DIM>
+bool RepulsionForce<DIM>::CanCalculateForcesConcurrently()
+{
+    return typeid(*this) == typeid(RepulsionForce<DIM>);
+}
+
+template<unsigned DIM>
+c_vector<double, DIM> RepulsionForce<DIM>::CalculateForceBetweenNodes(unsigned nodeAGlobalIndex,
+                                                                      unsigned nodeBGlobalIndex,
+                                                                      AbstractCellPopulation<DIM>& rCellPopulation)
+{
+    Node<DIM>* p_node_a = rCellPopulation.GetNode(nodeAGlobalIndex);
+    Node<DIM>* p_node_b = rCellPopulation.GetNode(nodeBGlobalIndex);
+
+    // Get the unit vector parallel to the line joining the two nodes
+    c_vector<double, DIM> unit_difference = rCellPopulation.rGetMesh().GetVectorFromAtoB(p_node_a->rGetLocation(), p_node_b->rGetLocation());
+
+    // Calculate the value of the rest length
+    double rest_length = p_node_a->GetRadius() + p_node_b->GetRadius();
+
+    // Only overlapping cells repel each other
+    if (norm_2(unit_difference) >= rest_length)
     {
-        std::pair<Node<DIM>*, Node<DIM>* > pair = *iter;
-
-        Node<DIM>* p_node_a = pair.first;
-        Node<DIM>* p_node_b = pair.second;
-
-        // Get the node locations
-        c_vector<double, DIM> node_a_location = p_node_a->rGetLocation();
-        c_vector<double, DIM> node_b_location =  p_node_b->rGetLocation();
-
-        // Get the node radii
-        double node_a_radius = p_node_a->GetRadius();
-        double node_b_radius = p_node_b->GetRadius();
-
-        // Get the unit vector parallel to the line joining the two nodes
-        c_vector<double, DIM> unit_difference;
-
-        unit_difference = (static_cast<NodeBasedCellPopulation<DIM>*>(&rCellPopulation))->rGetMesh().GetVectorFromAtoB(node_a_location, node_b_location);
-
-        // Calculate the value of the rest length
-        double rest_length = node_a_radius+node_b_radius;
-
-        if (norm_2(unit_difference) < rest_length)
-        {
-            // Calculate the force between nodes
-            c_vector<double, DIM> force = this->CalculateForceBetweenNodes(p_node_a->GetIndex(), p_node_b->GetIndex(), rCellPopulation);
-            c_vector<double, DIM> negative_force = -1.0 * force;
-            for (unsigned j=0; j<DIM; j++)
-            {
-                assert(!std::isnan(force[j]));
-            }
-            // Add the force contribution to each node
-            p_node_a->AddAppliedForceContribution(force);
-            p_node_b->AddAppliedForceContribution(negative_force);
-        }
+        return zero_vector<double>(DIM);
     }
+
+    return GeneralisedLinearSpringForce<DIM>::CalculateForceBetweenNodes(nodeAGlobalIndex, nodeBGlobalIndex, rCellPopulation);
 }
 
 template<unsigned DIM>
@@ -66,6 +66,18 @@ private :
         archive & boost::serialization::base_object<GeneralisedLinearSpringForce<DIM> >(*this);
     }
 
+protected :
+
+    /**
+     * Overridden CanCalculateForcesConcurrently() method.
+     *
+     * CalculateForceBetweenNodes() only reads the nodes before calling the parent class method,
+     * so is safe for this exact class; subclasses must opt in themselves.
+     *
+     * @return whether this object is a RepulsionForce (rather than a subclass)
+     */
+    virtual bool CanCalculateForcesConcurrently();
+
 public :
 
     /**
@@ -80,6 +92,21 @@ public :
      */
     void AddForceContribution(AbstractCellPopulation<DIM>& rCellPopulation);
 
+    /**
+     * Overridden CalculateForceBetweenNodes() method.
+     *
+     * Returns zero unless the two nodes are closer than the sum of their radii,
+     * in which case the force is calculated by GeneralisedLinearSpringForce.
+     *
+     * @param nodeAGlobalIndex index of one neighbouring node
+     * @param nodeBGlobalIndex index of the other neighbouring node
+     * @param rCellPopulation the cell population
+     * @return The force exerted on Node A by Node B.
+     */
+    c_vector<double, DIM> CalculateForceBetweenNodes(unsigned nodeAGlobalIndex,
+                                                     unsigned nodeBGlobalIndex,
+                                                     AbstractCellPopulation<DIM>& rCellPopulation);
+
     /**
      * Outputs force Parameters to file
      *
@@ -43,6 +43,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CellBasedPdeSolver.hpp"
 #include "Exception.hpp"
 #include "VtkMeshWriter.hpp"
+#include "CellBasedEventHandler.hpp"
 
 template<unsigned DIM>
 CellBasedPdeHandler<DIM>::CellBasedPdeHandler(AbstractCellPopulation<DIM>* pCellPopulation,
@@ -77,12 +78,25 @@ CellBasedPdeHandler<DIM>::~CellBasedPdeHandler()
             delete mPdeAndBcCollection[i];
         }
     }
+    DeleteCoarsePdeSolvers();
     if (mpCoarsePdeMesh)
     {
         delete mpCoarsePdeMesh;
     }
 }
 
+template<unsigned DIM>
+void CellBasedPdeHandler<DIM>::DeleteCoarsePdeSolvers()
+{
+    for (unsigned i=0; i<mCoarsePdeSolvers.size(); i++)
+    {
+        delete mCoarsePdeSolvers[i];
+        delete mCoarsePdeBoundaryConditions[i];
+    }
+    mCoarsePdeSolvers.clear();
+    mCoarsePdeBoundaryConditions.clear();
+}
+
 template<unsigned DIM>
 const AbstractCellPopulation<DIM>* CellBasedPdeHandler<DIM>::GetCellPopulation() const
 {
@@ -254,6 +268,9 @@ void CellBasedPdeHandler<DIM>::UseCoarsePdeMesh(double stepSize, ChasteCuboid<DI
         }
     }
 
+    // Any solvers we have are for the old coarse mesh
+    DeleteCoarsePdeSolvers();
+
     // Create a regular coarse tetrahedral mesh
     mpCoarsePdeMesh = new TetrahedralMesh<DIM,DIM>;
     switch (DIM)
@@ -271,6 +288,9 @@ void CellBasedPdeHandler<DIM>::UseCoarsePdeMesh(double stepSize, ChasteCuboid<DI
             NEVER_REACHED;
     }
 
+    // Cells are located in the coarse mesh every time step, so index its elements for faster point location
+    mpCoarsePdeMesh->SetUseElementSpatialIndex();
+
     if (centreOnCellPopulation)
     {
         // Find the centre of the coarse PDE mesh
@@ -339,6 +359,8 @@ void CellBasedPdeHandler<DIM>::SolvePdeAndWriteResultsToFile(unsigned samplingTi
         // Get pointer to this PdeAndBoundaryConditions object
         PdeAndBoundaryConditions<DIM>* p_pde_and_bc = mPdeAndBcCollection[pde_index];
 
+        CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE_SETUP);
+
         // Set up boundary conditions
         std::auto_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc = ConstructBoundaryConditionsContainer(p_pde_and_bc, p_mesh);
 
@@ -379,25 +401,50 @@ void CellBasedPdeHandler<DIM>::SolvePdeAndWriteResultsToFile(unsigned samplingTi
             this->UpdateCellPdeElementMap();
             p_pde_and_bc->SetUpSourceTermsForAveragedSourcePde(p_mesh, &mCellPdeElementMap);
 
-
-            SimpleLinearEllipticSolver<DIM,DIM> solver(p_mesh, p_pde_and_bc->GetPde(), p_bcc.get());
+            /*
+             * The coarse mesh doesn't change, so we keep the solver from previous time steps and only
+             * give it the new boundary conditions.  Its linear system is then reassembled with the new
+             * source terms, reusing the sparsity pattern and the KSP solver.
+             */
+            assert(using_coarse_pde_mesh);
+            if (mCoarsePdeSolvers.size() < mPdeAndBcCollection.size())
+            {
+                mCoarsePdeSolvers.resize(mPdeAndBcCollection.size(), NULL);
+                mCoarsePdeBoundaryConditions.resize(mPdeAndBcCollection.size(), NULL);
+            }
+            BoundaryConditionsContainer<DIM,DIM,1>* p_old_bcc = mCoarsePdeBoundaryConditions[pde_index];
+            mCoarsePdeBoundaryConditions[pde_index] = p_bcc.release();
+            if (mCoarsePdeSolvers[pde_index] == NULL)
+            {
+                mCoarsePdeSolvers[pde_index] = new SimpleLinearEllipticSolver<DIM,DIM>(p_mesh, p_pde_and_bc->GetPde(), mCoarsePdeBoundaryConditions[pde_index]);
+            }
+            else
+            {
+                mCoarsePdeSolvers[pde_index]->ResetBoundaryConditionsContainer(mCoarsePdeBoundaryConditions[pde_index]);
+            }
+            delete p_old_bcc;
+            CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SETUP);
 
             // If we have an initial guess, use this when solving the system...
+            CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE_SOLVE);
             if (is_previous_solution_size_correct)
             {
-                p_pde_and_bc->SetSolution(solver.Solve(initial_guess));
+                p_pde_and_bc->SetSolution(mCoarsePdeSolvers[pde_index]->Solve(initial_guess));
                 PetscTools::Destroy(initial_guess);
             }
             else // ...otherwise do not supply one
             {
-                p_pde_and_bc->SetSolution(solver.Solve());
+                p_pde_and_bc->SetSolution(mCoarsePdeSolvers[pde_index]->Solve());
             }
+            CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SOLVE);
         }
         else
         {
             CellBasedPdeSolver<DIM> solver(p_mesh, p_pde_and_bc->GetPde(), p_bcc.get());
+            CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SETUP);
 
             // If we have an initial guess, use this...
+            CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE_SOLVE);
             if (is_previous_solution_size_correct)
             {
                 p_pde_and_bc->SetSolution(solver.Solve(initial_guess));
@@ -407,6 +454,7 @@ void CellBasedPdeHandler<DIM>::SolvePdeAndWriteResultsToFile(unsigned samplingTi
             {
                 p_pde_and_bc->SetSolution(solver.Solve());
             }
+            CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SOLVE);
         }
 
         // Store the PDE solution in an accessible form
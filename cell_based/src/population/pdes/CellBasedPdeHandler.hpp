@@ -48,6 +48,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TetrahedralMesh.hpp"
 #include "ChasteCuboid.hpp"
 
+// Forward declaration prevents circular include chain
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class SimpleLinearEllipticSolver;
+
 /**
  * A helper class, containing code for handling the numerical solution of one or more PDEs
  * (using the finite element method) associated with a cell-based simulation object.
@@ -129,6 +133,25 @@ protected:
      */
     bool mDeleteMemberPointersInDestructor;
 
+    /**
+     * Solvers for the PDEs in mPdeAndBcCollection that are solved on the coarse PDE mesh, indexed
+     * as mPdeAndBcCollection (NULL if not yet created).  As the coarse mesh is fixed, each solver is
+     * kept from one time step to the next, so that its linear system (with the sparsity pattern
+     * and preallocation) and KSP solver are only set up once.  Not archived.
+     */
+    std::vector<SimpleLinearEllipticSolver<DIM,DIM>*> mCoarsePdeSolvers;
+
+    /**
+     * The boundary conditions currently used by each of mCoarsePdeSolvers, which the solvers
+     * only hold pointers to.
+     */
+    std::vector<BoundaryConditionsContainer<DIM,DIM,1>*> mCoarsePdeBoundaryConditions;
+
+    /**
+     * Delete mCoarsePdeSolvers and their boundary conditions, so that they are created afresh.
+     */
+    void DeleteCoarsePdeSolvers();
+
     /**
      * Initialise mCellPdeElementMap.
      *
@@ -91,6 +91,17 @@ public:
                                                    unsigned targetNodeIndex,
                                                    PottsBasedCellPopulation<DIM>& rCellPopulation)=0;
 
+    /**
+     * @return whether EvaluateHamiltonianContribution() may be called for different lattice sites
+     * at the same time, i.e. it only reads the cell population and this object.  This lets
+     * checkerboard sweeps (see PottsBasedCellPopulation::SetUseCheckerboardSweeps()) use several
+     * threads.  Defaults to false; concrete classes should override this to return true when it is safe.
+     */
+    virtual bool CanEvaluateHamiltonianContributionConcurrently()
+    {
+        return false;
+    }
+
     /**
      * Output update rule to file. Call OutputUpdateRuleParameters() to output
      * all member variables to file.
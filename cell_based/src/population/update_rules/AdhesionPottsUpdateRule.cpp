@@ -48,6 +48,12 @@ AdhesionPottsUpdateRule<DIM>::~AdhesionPottsUpdateRule()
 {
 }
 
+template<unsigned DIM>
+bool AdhesionPottsUpdateRule<DIM>::CanEvaluateHamiltonianContributionConcurrently()
+{
+    return true;
+}
+
 template<unsigned DIM>
 double AdhesionPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(unsigned currentNodeIndex,
                                                                 unsigned targetNodeIndex,
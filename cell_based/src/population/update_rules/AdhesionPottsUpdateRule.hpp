@@ -111,6 +111,16 @@ public:
                                            unsigned targetNodeIndex,
                                            PottsBasedCellPopulation<DIM>& rCellPopulation);
 
+    /**
+     * Overridden CanEvaluateHamiltonianContributionConcurrently() method.
+     *
+     * Subclasses which override the adhesion energy methods below so that they modify any
+     * shared state should override this to return false.
+     *
+     * @return true, since EvaluateHamiltonianContribution() only reads the cell population
+     */
+    virtual bool CanEvaluateHamiltonianContributionConcurrently();
+
     /**
      * Method to calculate the specific interaction between 2 cells can be overridden in
      * child classes to  implement differential adhesion .etc.
@@ -46,6 +46,12 @@ ChemotaxisPottsUpdateRule<DIM>::~ChemotaxisPottsUpdateRule()
 {
 }
 
+template<unsigned DIM>
+bool ChemotaxisPottsUpdateRule<DIM>::CanEvaluateHamiltonianContributionConcurrently()
+{
+    return true;
+}
+
 template<unsigned DIM>
 double ChemotaxisPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(unsigned currentNodeIndex,
                                                                         unsigned targetNodeIndex,
@@ -97,6 +97,13 @@ public:
                                            unsigned targetNodeIndex,
                                            PottsBasedCellPopulation<DIM>& rCellPopulation);
 
+    /**
+     * Overridden CanEvaluateHamiltonianContributionConcurrently() method.
+     *
+     * @return true, since EvaluateHamiltonianContribution() only reads the cell population
+     */
+    virtual bool CanEvaluateHamiltonianContributionConcurrently();
+
     /**
      * Overridden OutputUpdateRuleParameters() method.
      *
@@ -49,6 +49,12 @@ SurfaceAreaConstraintPottsUpdateRule<DIM>::~SurfaceAreaConstraintPottsUpdateRule
 {
 }
 
+template<unsigned DIM>
+bool SurfaceAreaConstraintPottsUpdateRule<DIM>::CanEvaluateHamiltonianContributionConcurrently()
+{
+    return true;
+}
+
 template<unsigned DIM>
 double SurfaceAreaConstraintPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(unsigned currentNodeIndex,
                                                                         unsigned targetNodeIndex,
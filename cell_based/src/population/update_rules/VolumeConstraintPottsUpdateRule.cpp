@@ -49,6 +49,12 @@ VolumeConstraintPottsUpdateRule<DIM>::~VolumeConstraintPottsUpdateRule()
 {
 }
 
+template<unsigned DIM>
+bool VolumeConstraintPottsUpdateRule<DIM>::CanEvaluateHamiltonianContributionConcurrently()
+{
+    return true;
+}
+
 template<unsigned DIM>
 double VolumeConstraintPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(unsigned currentNodeIndex,
                                                                         unsigned targetNodeIndex,
@@ -51,11 +51,96 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TransitCellProliferativeType.hpp"
 #include "SmartPointers.hpp"
 #include "FileComparison.hpp"
+#include "CellCycleModelOdeSolver.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
 //This test is always run sequentially (never in parallel)
 #include "FakePetscSetup.hpp"
 
+/**
+ * A Delta-Notch cell-cycle model that uses a fixed mean neighbouring Delta of 0.5,
+ * set in AdjustOdeParameters(), for testing.
+ */
+class FixedMeanDeltaNotchCellCycleModel : public DeltaNotchCellCycleModel
+{
+protected:
+
+    /**
+     * Overridden AdjustOdeParameters() method.
+     *
+     * @param currentTime  the time up to which the system will be solved
+     */
+    void AdjustOdeParameters(double currentTime)
+    {
+        mpOdeSystem->SetParameter("Mean Delta", 0.5);
+    }
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param pOdeSolver  the cell-cycle model ODE solver to use
+     */
+    FixedMeanDeltaNotchCellCycleModel(boost::shared_ptr<AbstractCellCycleModelOdeSolver> pOdeSolver)
+        : DeltaNotchCellCycleModel(pOdeSolver)
+    {
+    }
+};
+
 class TestDeltaNotchCellCycleModel : public AbstractCellBasedTestSuite
 {
+private:
+
+    /**
+     * Solve a model with the shared RK4 solver, which takes the fixed-size path, and check
+     * the result against the general RK4 solver with a mean Delta of 0.5.
+     *
+     * @param cellMeanDelta  the mean neighbouring Delta stored in the cell data
+     */
+    template<class MODEL>
+    void CheckFixedSizeSolveMatchesRungeKutta4(double cellMeanDelta)
+    {
+        // With the shared RK4 solver the model takes the fixed-size path
+        boost::shared_ptr<AbstractCellCycleModelOdeSolver> p_solver(CellCycleModelOdeSolver<DeltaNotchCellCycleModel, RungeKutta4IvpOdeSolver>::Instance());
+        p_solver->Initialise();
+
+        MODEL* p_model = new MODEL(p_solver);
+        p_model->SetDimension(2);
+        p_model->SetDt(0.001);
+        std::vector<double> initial_conditions(2);
+        initial_conditions[0] = 0.3;
+        initial_conditions[1] = 0.8;
+        p_model->SetInitialConditions(initial_conditions);
+
+        MAKE_PTR(WildTypeCellMutationState, p_healthy_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+        CellPtr p_cell(new Cell(p_healthy_state, p_model));
+        p_cell->SetCellProliferativeType(p_diff_type);
+        p_cell->GetCellData()->SetItem("mean delta", cellMeanDelta);
+        p_cell->InitialiseCellCycleModel();
+
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        unsigned num_steps = 20;
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(2.0, num_steps);
+
+        // Solve the same system over the same intervals with the general solver
+        DeltaNotchOdeSystem ode_system;
+        ode_system.SetParameter("Mean Delta", 0.5);
+        std::vector<double> expected = initial_conditions;
+        RungeKutta4IvpOdeSolver rk4_solver;
+
+        for (unsigned i=0; i<num_steps; i++)
+        {
+            double last_time = p_simulation_time->GetTime();
+            p_simulation_time->IncrementTimeOneStep();
+            p_model->ReadyToDivide();
+            rk4_solver.Solve(&ode_system, expected, last_time, p_simulation_time->GetTime(), 0.001);
+        }
+
+        TS_ASSERT_DELTA(p_model->GetNotch(), expected[0], 1e-12);
+        TS_ASSERT_DELTA(p_model->GetDelta(), expected[1], 1e-12);
+    }
+
 public:
 
     ///\todo test correct behaviour of ODE system and state variables
@@ -124,6 +209,17 @@ public:
         TS_ASSERT_DELTA(p_diff_model->GetMeanNeighbouringDelta(), 4.2, 1e-4);
     }
 
+    void TestFixedSizeSolveMatchesRungeKutta4() throw(Exception)
+    {
+        CheckFixedSizeSolveMatchesRungeKutta4<DeltaNotchCellCycleModel>(0.5);
+    }
+
+    void TestFixedSizeSolveAdjustsOdeParameters() throw(Exception)
+    {
+        // The subclass sets the mean Delta itself before each solve, overriding the cell data
+        CheckFixedSizeSolveMatchesRungeKutta4<FixedMeanDeltaNotchCellCycleModel>(0.0);
+    }
+
     ///\todo test archiving of ODE system and state variables
     void TestArchiveDeltaNotchCellCycleModel()
     {
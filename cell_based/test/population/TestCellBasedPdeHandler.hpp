@@ -57,6 +57,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ReplicatableVector.hpp"
 #include "WildTypeCellMutationState.hpp"
 #include "AveragedSourcePde.hpp"
+#include "SimpleLinearEllipticSolver.hpp"
 #include "FileComparison.hpp"
 #include "NumericFileComparison.hpp"
 #include "FunctionalBoundaryCondition.hpp"
@@ -994,6 +995,75 @@ public:
         }
     }
 
+    void TestCoarsePdeSolverIsKeptBetweenSolves() throw(Exception)
+    {
+        EXIT_IF_PARALLEL;
+
+        // Set up SimulationTime
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(0.05, 6);
+
+        // Create a cigar-shaped mesh
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/disk_522_elements");
+        MutableMesh<2,2> mesh;
+        mesh.ConstructFromMeshReader(mesh_reader);
+        mesh.Scale(5.0, 1.0);
+
+        // Create a cell population
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        MeshBasedCellPopulation<2> cell_population(mesh, cells);
+
+        // Create a PDE handler object using this cell population
+        CellBasedPdeHandler<2> pde_handler(&cell_population);
+
+        // Set up PDE and pass to handler
+        AveragedSourcePde<2> pde(cell_population, -0.01);
+        ConstBoundaryCondition<2> bc(1.0);
+        PdeAndBoundaryConditions<2> pde_and_bc(&pde, &bc, false);
+        pde_and_bc.SetDependentVariableName("variable");
+
+        pde_handler.AddPdeAndBc(&pde_and_bc);
+
+        // Solve PDEs on a coarse mesh, with boundary conditions that are recalculated every solve
+        ChastePoint<2> lower(0.0, 0.0);
+        ChastePoint<2> upper(50.0, 50.0);
+        ChasteCuboid<2> cuboid(lower, upper);
+        pde_handler.UseCoarsePdeMesh(10.0, cuboid, true);
+        pde_handler.SetImposeBcsOnCoarseBoundary(false);
+        TS_ASSERT(pde_handler.mCoarsePdeSolvers.empty());
+
+        OutputFileHandler output_file_handler("TestCoarsePdeSolverIsKeptBetweenSolves", false);
+        pde_handler.mpVizPdeSolutionResultsFile = output_file_handler.OpenOutputFile("results.vizpdesolution");
+
+        pde_handler.SolvePdeAndWriteResultsToFile(10);
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers.size(), 1u);
+        SimpleLinearEllipticSolver<2,2>* p_solver = pde_handler.mCoarsePdeSolvers[0];
+        TS_ASSERT(p_solver != NULL);
+        LinearSystem* p_linear_system = p_solver->GetLinearSystem();
+        TS_ASSERT(p_linear_system != NULL);
+        ReplicatableVector first_solution(pde_and_bc.GetSolution());
+
+        // Solving again uses the same solver and linear system, and (as the cells haven't moved) gives the same answer
+        pde_handler.SolvePdeAndWriteResultsToFile(10);
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers.size(), 1u);
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers[0], p_solver);
+        TS_ASSERT_EQUALS(p_solver->GetLinearSystem(), p_linear_system);
+        ReplicatableVector second_solution(pde_and_bc.GetSolution());
+        TS_ASSERT_EQUALS(second_solution.GetSize(), first_solution.GetSize());
+        for (unsigned i=0; i<first_solution.GetSize(); i++)
+        {
+            TS_ASSERT_DELTA(second_solution[i], first_solution[i], 1e-4);
+        }
+
+        pde_handler.mpVizPdeSolutionResultsFile->close();
+
+        // A new coarse mesh needs new solvers
+        pde_handler.UseCoarsePdeMesh(10.0, cuboid, true);
+        TS_ASSERT(pde_handler.mCoarsePdeSolvers.empty());
+    }
+
     void TestSolvePdeAndWriteResultsToFileCoarsePdeMeshNeumann() throw(Exception)
     {
         EXIT_IF_PARALLEL;
@@ -69,6 +69,21 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "PetscSetupAndFinalize.hpp"
 
+/**
+ * A subclass of a two-body force that changes nothing, but exposes whether the forces
+ * may be calculated by several threads.
+ */
+template<class FORCE>
+class ForceConcurrencyQuery : public FORCE
+{
+public:
+    /** @return the result of the protected CanCalculateForcesConcurrently() method */
+    bool QueryCanCalculateForcesConcurrently()
+    {
+        return this->CanCalculateForcesConcurrently();
+    }
+};
+
 class TestForces : public AbstractCellBasedTestSuite
 {
 public:
@@ -957,6 +972,71 @@ public:
         }
     }
 
+    void TestGeneralisedLinearSpringForceMatchesPairwiseForces() throw (Exception)
+    {
+        EXIT_IF_PARALLEL;    // HoneycombMeshGenerator doesn't work in parallel.
+
+        /*
+         * AddForceContribution() calculates the forces between all pairs into a buffer (using
+         * several threads if Chaste is built with OpenMP) before adding them to the nodes, so
+         * check it gives the same answer as adding the pairwise forces one at a time.
+         */
+        HoneycombMeshGenerator generator(6, 6, 0);
+        MutableMesh<2,2>* p_generating_mesh = generator.GetMesh();
+        p_generating_mesh->Translate(0.05, 0.02); // Avoid any symmetry in the forces
+        p_generating_mesh->GetNode(7)->rGetModifiableLocation()[0] += 0.1;
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(*p_generating_mesh, 1.5);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+        cell_population.Update();
+
+        GeneralisedLinearSpringForce<2> force;
+        for (AbstractMesh<2,2>::NodeIterator node_iter = mesh.GetNodeIteratorBegin();
+             node_iter != mesh.GetNodeIteratorEnd();
+             ++node_iter)
+        {
+            node_iter->ClearAppliedForce();
+        }
+        force.AddForceContribution(cell_population);
+
+        std::vector<c_vector<double, 2> > expected_forces(mesh.GetNumNodes(), zero_vector<double>(2));
+        std::vector< std::pair<Node<2>*, Node<2>* > >& r_node_pairs = cell_population.rGetNodePairs();
+        TS_ASSERT(!r_node_pairs.empty());
+        for (unsigned i=0; i<r_node_pairs.size(); i++)
+        {
+            unsigned index_a = r_node_pairs[i].first->GetIndex();
+            unsigned index_b = r_node_pairs[i].second->GetIndex();
+            c_vector<double, 2> pair_force = force.CalculateForceBetweenNodes(index_a, index_b, cell_population);
+            expected_forces[index_a] += pair_force;
+            expected_forces[index_b] -= pair_force;
+        }
+
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            TS_ASSERT_DELTA(mesh.GetNode(i)->rGetAppliedForce()[0], expected_forces[i][0], 1e-12);
+            TS_ASSERT_DELTA(mesh.GetNode(i)->rGetAppliedForce()[1], expected_forces[i][1], 1e-12);
+        }
+    }
+
+    void TestSubclassesDoNotInheritConcurrentForceCalculation() throw (Exception)
+    {
+        // A subclass might override the force methods to modify shared state, so has to opt in itself
+        ForceConcurrencyQuery<GeneralisedLinearSpringForce<2> > spring_force;
+        TS_ASSERT_EQUALS(spring_force.QueryCanCalculateForcesConcurrently(), false);
+
+        ForceConcurrencyQuery<DifferentialAdhesionGeneralisedLinearSpringForce<2> > differential_adhesion_force;
+        TS_ASSERT_EQUALS(differential_adhesion_force.QueryCanCalculateForcesConcurrently(), false);
+
+        ForceConcurrencyQuery<RepulsionForce<2> > repulsion_force;
+        TS_ASSERT_EQUALS(repulsion_force.QueryCanCalculateForcesConcurrently(), false);
+    }
+
     void TestRepulsionForceArchiving() throw (Exception)
     {
         EXIT_IF_PARALLEL; // Beware of processes overwriting the identical archives of other processes
@@ -629,6 +629,63 @@ public:
         TS_ASSERT_EQUALS(node_indices, expected_node_indices);
     }
 
+    void TestUpdateWithIncrementalReMesh()
+    {
+        // Create two populations on the same mesh, one of which remeshes incrementally
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/disk_984_elements");
+        MutableMesh<2,2> incremental_mesh;
+        incremental_mesh.ConstructFromMeshReader(mesh_reader);
+        mesh_reader.Reset();
+        MutableMesh<2,2> full_mesh;
+        full_mesh.ConstructFromMeshReader(mesh_reader);
+
+        std::vector<CellPtr> incremental_cells;
+        std::vector<CellPtr> full_cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(incremental_cells, incremental_mesh.GetNumNodes());
+        cells_generator.GenerateBasic(full_cells, full_mesh.GetNumNodes());
+
+        MeshBasedCellPopulation<2> incremental_population(incremental_mesh, incremental_cells);
+        MeshBasedCellPopulation<2> full_population(full_mesh, full_cells);
+
+        TS_ASSERT_EQUALS(incremental_population.GetUseIncrementalReMesh(), false);
+        incremental_population.SetUseIncrementalReMesh(true);
+        TS_ASSERT_EQUALS(incremental_population.GetUseIncrementalReMesh(), true);
+
+        // Move the interior nodes a little, so some edges are no longer Delaunay
+        for (unsigned i=0; i<full_mesh.GetNumNodes(); i++)
+        {
+            if (!full_mesh.GetNode(i)->IsBoundaryNode())
+            {
+                c_vector<double, 2> displacement;
+                displacement[0] = 0.02*sin(1.7*i);
+                displacement[1] = 0.02*cos(2.3*i);
+                incremental_mesh.GetNode(i)->rGetModifiableLocation() += displacement;
+                full_mesh.GetNode(i)->rGetModifiableLocation() += displacement;
+            }
+        }
+
+        Node<2>* p_node = incremental_mesh.GetNode(0);
+        incremental_population.Update();
+        full_population.Update();
+
+        // Update() should have passed the setting on, so the mesh was updated rather than rebuilt
+        TS_ASSERT_EQUALS(incremental_mesh.GetUseIncrementalReMesh(), true);
+        TS_ASSERT_EQUALS(incremental_mesh.GetNode(0), p_node);
+        TS_ASSERT_EQUALS(full_mesh.GetUseIncrementalReMesh(), false);
+
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumElements(), full_mesh.GetNumElements());
+        TS_ASSERT_DELTA(incremental_mesh.GetVolume(), full_mesh.GetVolume(), 1e-10);
+        TS_ASSERT(incremental_mesh.CheckIsVoronoi());
+        TS_ASSERT_EQUALS(incremental_population.GetNumRealCells(), full_population.GetNumRealCells());
+
+        // Each cell should still be attached to its node
+        for (unsigned i=0; i<incremental_mesh.GetNumNodes(); i++)
+        {
+            TS_ASSERT_EQUALS(incremental_population.GetLocationIndexUsingCell(incremental_population.GetCellUsingLocationIndex(i)), i);
+        }
+    }
+
     void TestUpdateNodeLocations()
     {
         // Test MeshBasedCellPopulation::UpdateNodeLocations()
@@ -1372,6 +1429,9 @@ public:
             // Set area-based viscosity
             p_cell_population->SetAreaBasedDampingConstant(true);
 
+            // Remesh incrementally
+            p_cell_population->SetUseIncrementalReMesh(true);
+
             // Create output archive
             ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_file);
             boost::archive::text_oarchive* p_arch = arch_opener.GetCommonArchive();
@@ -1433,6 +1493,7 @@ public:
 
             // Check area-based viscosity is still true
             TS_ASSERT_EQUALS(p_cell_population->UseAreaBasedDampingConstant(), true);
+            TS_ASSERT_EQUALS(p_cell_population->GetUseIncrementalReMesh(), true);
 
             TS_ASSERT_EQUALS(p_cell_population->rGetMesh().GetNumNodes(), 5u);
 
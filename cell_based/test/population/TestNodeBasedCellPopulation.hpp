@@ -802,6 +802,71 @@ public:
         }
     }
 
+    void TestVerletLists()
+    {
+        EXIT_IF_PARALLEL;    // Verlet lists are only used in serial
+
+        // Create a small node-based cell population
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_4_elements");
+        TetrahedralMesh<2,2> generating_mesh;
+        generating_mesh.ConstructFromMeshReader(mesh_reader);
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(generating_mesh, 1.2);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> node_based_cell_population(mesh, cells);
+
+        // Test set and get methods
+        TS_ASSERT_EQUALS(node_based_cell_population.GetUseVerletLists(), false);
+        TS_ASSERT_DELTA(node_based_cell_population.GetVerletListSkin(), 0.0, 1e-12);
+        TS_ASSERT_THROWS_THIS(node_based_cell_population.SetVerletListSkin(1.2),
+                              "The Verlet list skin must be non-negative and less than the maximum interaction distance of the mesh.");
+        TS_ASSERT_THROWS_THIS(node_based_cell_population.SetVerletListSkin(-0.1),
+                              "The Verlet list skin must be non-negative and less than the maximum interaction distance of the mesh.");
+
+        node_based_cell_population.SetUseVerletLists();
+        node_based_cell_population.SetVerletListSkin(0.2);
+        TS_ASSERT_EQUALS(node_based_cell_population.GetUseVerletLists(), true);
+        TS_ASSERT_DELTA(node_based_cell_population.GetVerletListSkin(), 0.2, 1e-12);
+
+        // Only the pairs closer than the interaction distance are kept, i.e. not the two diagonals of the square
+        node_based_cell_population.Update();
+        TS_ASSERT_EQUALS(node_based_cell_population.rGetNodePairs().size(), 8u);
+        TS_ASSERT_EQUALS(node_based_cell_population.mNodesAtLastPairCalculation.size(), 5u);
+
+        // Moving the centre node less than half the skin keeps the same pairs
+        c_vector<double, 2> new_location;
+        new_location[0] = 0.55;
+        new_location[1] = 0.5;
+        ChastePoint<2> new_point(new_location);
+        node_based_cell_population.SetNode(4, new_point);
+
+        node_based_cell_population.Update(false);
+        TS_ASSERT_EQUALS(node_based_cell_population.rGetNodePairs().size(), 8u);
+        TS_ASSERT_DELTA(node_based_cell_population.mNodeLocationsAtLastPairCalculation[4][0], 0.5, 1e-12);
+
+        // Moving it further means the pairs are recalculated
+        new_point.rGetLocation()[0] = 0.65;
+        node_based_cell_population.SetNode(4, new_point);
+
+        node_based_cell_population.Update(false);
+        TS_ASSERT_EQUALS(node_based_cell_population.rGetNodePairs().size(), 8u);
+        TS_ASSERT_DELTA(node_based_cell_population.mNodeLocationsAtLastPairCalculation[4][0], 0.65, 1e-12);
+
+        // So does moving two nodes that were out of range into range
+        new_location[0] = 0.75;
+        new_location[1] = 0.75;
+        ChastePoint<2> corner_point(new_location);
+        node_based_cell_population.SetNode(0, corner_point);
+
+        node_based_cell_population.Update(false);
+        TS_ASSERT_EQUALS(node_based_cell_population.rGetNodePairs().size(), 9u);
+    }
+
     void TestSettingCellAncestors() throw (Exception)
     {
         // Create a small node-based cell population
@@ -1292,6 +1357,8 @@ public:
             }
 
             p_cell_population->SetUseVariableRadii(true);
+            p_cell_population->SetUseVerletLists();
+            p_cell_population->SetVerletListSkin(0.25);
 
             // Create an output archive
             ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_file);
@@ -1357,6 +1424,8 @@ public:
             // Check the member variables have been restored
             TS_ASSERT_DELTA(p_cell_population->GetMechanicsCutOffLength(), 1.5, 1e-9);
             TS_ASSERT(p_cell_population->GetUseVariableRadii());
+            TS_ASSERT(p_cell_population->GetUseVerletLists());
+            TS_ASSERT_DELTA(p_cell_population->GetVerletListSkin(), 0.25, 1e-9);
 
             // Tidy up
             delete p_cell_population;
@@ -391,6 +391,72 @@ public:
         TS_ASSERT_EQUALS(cell_population.rGetMesh().GetElement(1)->GetNumNodes(), 4u);
     }
 
+    void TestUpdateCellLocationsWithCheckerboardSweeps()
+    {
+        // Create a 2D PottsMesh with four cells
+        PottsMeshGenerator<2> generator(8, 2, 2, 8, 2, 2);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        // The neighbour stencils should match the neighbour sets
+        for (unsigned node_index=0; node_index<p_mesh->GetNumNodes(); node_index++)
+        {
+            std::set<unsigned> moore_neighbours = p_mesh->GetMooreNeighbouringNodeIndices(node_index);
+            TS_ASSERT_EQUALS(p_mesh->GetNumMooreNeighbours(node_index), moore_neighbours.size());
+            unsigned local_index = 0;
+            for (std::set<unsigned>::iterator iter = moore_neighbours.begin(); iter != moore_neighbours.end(); ++iter)
+            {
+                TS_ASSERT_EQUALS(p_mesh->GetMooreNeighbour(node_index, local_index), *iter);
+                local_index++;
+            }
+
+            std::set<unsigned> von_neumann_neighbours = p_mesh->GetVonNeumannNeighbouringNodeIndices(node_index);
+            TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(node_index), von_neumann_neighbours.size());
+            local_index = 0;
+            for (std::set<unsigned>::iterator iter = von_neumann_neighbours.begin(); iter != von_neumann_neighbours.end(); ++iter)
+            {
+                TS_ASSERT_EQUALS(p_mesh->GetVonNeumannNeighbour(node_index, local_index), *iter);
+                local_index++;
+            }
+        }
+
+        // Create cells
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, p_mesh->GetNumElements());
+
+        // Create cell population
+        PottsBasedCellPopulation<2> cell_population(*p_mesh, cells);
+        TS_ASSERT_EQUALS(cell_population.GetUseCheckerboardSweeps(), false);
+        cell_population.SetUseCheckerboardSweeps();
+        TS_ASSERT_EQUALS(cell_population.GetUseCheckerboardSweeps(), true);
+
+        cell_population.SetTemperature(10.0);
+        cell_population.SetNumSweepsPerTimestep(2);
+
+        MAKE_PTR(VolumeConstraintPottsUpdateRule<2>, p_volume_constraint_update_rule);
+        cell_population.AddUpdateRule(p_volume_constraint_update_rule);
+
+        // Every node should still be in at most one element and no nodes should be lost
+        cell_population.UpdateCellLocations(1.0);
+        TS_ASSERT_EQUALS(cell_population.rGetCells().size(), 4u);
+        unsigned num_nodes_in_elements = 0;
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            num_nodes_in_elements += p_mesh->GetElement(elem_index)->GetNumNodes();
+        }
+        unsigned num_nodes_in_some_element = 0;
+        for (unsigned node_index=0; node_index<p_mesh->GetNumNodes(); node_index++)
+        {
+            TS_ASSERT_LESS_THAN_EQUALS(p_mesh->GetNode(node_index)->GetNumContainingElements(), 1u);
+            num_nodes_in_some_element += p_mesh->GetNode(node_index)->GetNumContainingElements();
+        }
+        TS_ASSERT_EQUALS(num_nodes_in_elements, num_nodes_in_some_element);
+
+        // Switching back to serial sweeps should also work
+        cell_population.SetUseCheckerboardSweeps(false);
+        TS_ASSERT_THROWS_NOTHING(cell_population.UpdateCellLocations(1.0));
+    }
+
     ///\todo implement this test (#1666)
 //    void TestVoronoiMethods()
 //    {
@@ -454,6 +520,7 @@ public:
         cell_population.AddCellWriter<CellAgesWriter>();
         cell_population.AddCellWriter<CellVolumesWriter>();
         cell_population.SetNumSweepsPerTimestep(5);
+        cell_population.SetUseCheckerboardSweeps();
 
         TS_ASSERT_EQUALS(cell_population.GetNumSweepsPerTimestep(), 5u);
 
@@ -648,6 +715,7 @@ public:
             // Set member variables in order to test that they are archived correctly
             static_cast<PottsBasedCellPopulation<2>*>(p_cell_population)->SetTemperature(0.25);
             static_cast<PottsBasedCellPopulation<2>*>(p_cell_population)->SetNumSweepsPerTimestep(3);
+            static_cast<PottsBasedCellPopulation<2>*>(p_cell_population)->SetUseCheckerboardSweeps();
             static_cast<PottsBasedCellPopulation<2>*>(p_cell_population)->SetUpdateNodesInRandomOrder(false);
             static_cast<PottsBasedCellPopulation<2>*>(p_cell_population)->SetIterateRandomlyOverUpdateRuleCollection(true);
 
@@ -683,6 +751,7 @@ public:
             PottsBasedCellPopulation<2>* p_static_population = static_cast<PottsBasedCellPopulation<2>*>(p_cell_population);
             TS_ASSERT_DELTA(p_static_population->GetTemperature(), 0.25, 1e-6);
             TS_ASSERT_EQUALS(p_static_population->GetNumSweepsPerTimestep(), 3u);
+            TS_ASSERT_EQUALS(p_static_population->GetUseCheckerboardSweeps(), true);
             TS_ASSERT_EQUALS(p_static_population->GetUpdateNodesInRandomOrder(), false);
             TS_ASSERT_EQUALS(p_static_population->GetIterateRandomlyOverUpdateRuleCollection(), true);
 
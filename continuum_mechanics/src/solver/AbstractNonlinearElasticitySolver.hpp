@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cmath>
 #include "AbstractContinuumMechanicsSolver.hpp"
 #include "LinearSystem.hpp"
+#include "PreconditionerReusePolicy.hpp"
 #include "LogFile.hpp"
 #include "MechanicsEventHandler.hpp"
 #include "ReplicatableVector.hpp"
@@ -264,6 +265,21 @@ protected:
      */
     double mKspAbsoluteTol;
 
+    /**
+     * The linear solver for the Newton steps of the non-SNES solver. It is created on the
+     * first Newton step and kept, so that its preconditioner can be reused.
+     */
+    KSP mKspSolver;
+
+    /** Whether mKspSolver has been created. */
+    bool mKspSolverIsSetUp;
+
+    /**
+     * Decides when to rebuild the preconditioner of mKspSolver (NULL to rebuild it for every
+     * Newton step). See SetPreconditionerReusePolicy().
+     */
+    PreconditionerReusePolicy* mpPreconditionerReusePolicy;
+
     /**
      * By default only the initial and final solutions are written. However, we may
      * want to write the solutions after every Newton iteration, in which case the
@@ -699,6 +715,22 @@ public:
         mKspAbsoluteTol = kspAbsoluteTolerance;
     }
 
+    /**
+     * Keep the preconditioner of the linear solver across Newton steps (and across calls to
+     * Solve()), and only rebuild it when the number of Krylov iterations grows too much
+     * compared with the first solve after the last set-up (see PreconditionerReusePolicy).
+     * This is not used by the SNES solver.
+     *
+     * @param iterationGrowthFactor  rebuild when a solve takes more than this factor times the baseline iterations
+     * @param maxSolvesBetweenSetups  rebuild after this many solves regardless
+     */
+    void SetPreconditionerReusePolicy(double iterationGrowthFactor=1.5, unsigned maxSolvesBetweenSetups=UINT_MAX);
+
+    /**
+     * @return the preconditioner reuse policy, with statistics on set-ups avoided (NULL if not in use)
+     */
+    const PreconditionerReusePolicy* GetPreconditionerReusePolicy() const;
+
     /**
      *  The following odd behaviour has been observed: for some problems the solver
      *  will fail in the first Newton iteration, with the residual not decreasing
@@ -828,6 +860,8 @@ AbstractNonlinearElasticitySolver<DIM>::AbstractNonlinearElasticitySolver(Abstra
       mrProblemDefinition(rProblemDefinition),
       mrJacobianMatrix(this->mSystemLhsMatrix),
       mKspAbsoluteTol(-1),
+      mKspSolverIsSetUp(false),
+      mpPreconditionerReusePolicy(NULL),
       mWriteOutputEachNewtonIteration(false),
       mNumNewtonIterations(0),
       mCurrentTime(0.0),
@@ -848,6 +882,11 @@ AbstractNonlinearElasticitySolver<DIM>::AbstractNonlinearElasticitySolver(Abstra
 template<unsigned DIM>
 AbstractNonlinearElasticitySolver<DIM>::~AbstractNonlinearElasticitySolver()
 {
+    if (mKspSolverIsSetUp)
+    {
+        KSPDestroy(PETSC_DESTROY_PARAM(mKspSolver));
+    }
+    delete mpPreconditionerReusePolicy;
 }
 
 
@@ -1763,22 +1802,50 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     Vec solution;
     VecDuplicate(this->mResidualVector,&solution);
 
-    KSP solver;
-    KSPCreate(PETSC_COMM_WORLD,&solver);
+    // Rebuild the preconditioner for this Newton step unless the reuse policy says it is still good enough
+    bool reuse_preconditioner = false;
+    if (mpPreconditionerReusePolicy)
+    {
+        if (mKspSolverIsSetUp && !mpPreconditionerReusePolicy->IsSetupDue())
+        {
+            reuse_preconditioner = true;
+            mpPreconditionerReusePolicy->RecordReuse();
+        }
+        else
+        {
+            mpPreconditionerReusePolicy->RecordSetup();
+        }
+    }
+
+    bool first_use_of_solver = !mKspSolverIsSetUp;
+    if (first_use_of_solver)
+    {
+        KSPCreate(PETSC_COMM_WORLD,&mKspSolver);
+        mKspSolverIsSetUp = true;
+    }
+    KSP solver = mKspSolver;
 
 #if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
-    KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix);
+    if (first_use_of_solver)
+    {
+        KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix);
+    }
+    KSPSetReusePreconditioner(solver, reuse_preconditioner ? PETSC_TRUE : PETSC_FALSE);
 #else
-    KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix, DIFFERENT_NONZERO_PATTERN /*in precond between successive solves*/);
+    KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix,
+                    reuse_preconditioner ? SAME_PRECONDITIONER : DIFFERENT_NONZERO_PATTERN /*in precond between successive solves*/);
 #endif
 
-    // Set the type of KSP solver (CG, GMRES etc) and preconditioner (ILU, HYPRE, etc)
-    SetKspSolverAndPcType(solver);
+    if (first_use_of_solver)
+    {
+        // Set the type of KSP solver (CG, GMRES etc) and preconditioner (ILU, HYPRE, etc)
+        SetKspSolverAndPcType(solver);
 
-    //PetscOptionsSetValue("-ksp_monitor","");
-    //PetscOptionsSetValue("-ksp_norm_type","natural");
+        //PetscOptionsSetValue("-ksp_monitor","");
+        //PetscOptionsSetValue("-ksp_norm_type","natural");
 
-    KSPSetFromOptions(solver);
+        KSPSetFromOptions(solver);
+    }
     KSPSetUp(solver);
 
 
@@ -1877,11 +1944,15 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     if (num_iters==0)
     {
         PetscTools::Destroy(solution);
-        KSPDestroy(PETSC_DESTROY_PARAM(solver));
         EXCEPTION("KSP Absolute tolerance was too high, linear system wasn't solved - there will be no decrease in Newton residual. Decrease KspAbsoluteTolerance");
     }
 
 
+    if (mpPreconditionerReusePolicy)
+    {
+        mpPreconditionerReusePolicy->RecordSolve(num_iters);
+    }
+
     if(this->mVerbose)
     {
         Timer::PrintAndReset("KSP Solve");
@@ -1908,7 +1979,6 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     MechanicsEventHandler::EndEvent(MechanicsEventHandler::UPDATE);
 
     PetscTools::Destroy(solution);
-    KSPDestroy(PETSC_DESTROY_PARAM(solver));
 
     return new_norm_resid;
 }
@@ -2163,6 +2233,26 @@ unsigned AbstractNonlinearElasticitySolver<DIM>::GetNumNewtonIterations()
     return mNumNewtonIterations;
 }
 
+template<unsigned DIM>
+void AbstractNonlinearElasticitySolver<DIM>::SetPreconditionerReusePolicy(double iterationGrowthFactor, unsigned maxSolvesBetweenSetups)
+{
+    PreconditionerReusePolicy* p_policy = new PreconditionerReusePolicy(iterationGrowthFactor, maxSolvesBetweenSetups);
+    delete mpPreconditionerReusePolicy;
+    mpPreconditionerReusePolicy = p_policy;
+
+    if (mKspSolverIsSetUp)
+    {
+        // Keep the preconditioner that has already been built
+        mpPreconditionerReusePolicy->RecordSetup();
+    }
+}
+
+template<unsigned DIM>
+const PreconditionerReusePolicy* AbstractNonlinearElasticitySolver<DIM>::GetPreconditionerReusePolicy() const
+{
+    return mpPreconditionerReusePolicy;
+}
+
 
 
 //////////////////////////////////////////////////////////////
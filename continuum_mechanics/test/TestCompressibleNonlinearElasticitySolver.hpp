@@ -691,6 +691,66 @@ public:
     }
 
 
+    void TestReusePreconditionerAcrossNewtonSteps() throw(Exception)
+    {
+        unsigned num_elem = 10;
+        QuadraticMesh<2> mesh(1.0/num_elem, 1.0, 1.0);
+
+        CompressibleMooneyRivlinMaterialLaw<2> law(C_PARAM,D_PARAM);
+
+        std::vector<unsigned> fixed_nodes = NonlinearElasticityTools<2>::GetNodesByComponentValue(mesh,0,0);
+
+        std::vector<BoundaryElement<1,2>*> boundary_elems;
+        for (TetrahedralMesh<2,2>::BoundaryElementIterator iter
+              = mesh.GetBoundaryElementIteratorBegin();
+            iter != mesh.GetBoundaryElementIteratorEnd();
+            ++iter)
+        {
+            if (fabs((*iter)->CalculateCentroid()[0])>1e-6)
+            {
+                boundary_elems.push_back(*iter);
+            }
+        }
+
+        SolidMechanicsProblemDefinition<2> problem_defn(mesh);
+        problem_defn.SetMaterialLaw(COMPRESSIBLE,&law);
+        problem_defn.SetZeroDisplacementNodes(fixed_nodes);
+        problem_defn.SetBodyForce(MyBodyForce);
+        problem_defn.SetTractionBoundaryConditions(boundary_elems, MyTraction);
+
+        // Solve once rebuilding the preconditioner for every Newton step
+        CompressibleNonlinearElasticitySolver<2> solver(mesh, problem_defn, "comp_nonlin_elas_reuse_pc");
+        TS_ASSERT(solver.GetPreconditionerReusePolicy() == NULL);
+        solver.Solve();
+        std::vector<double> expected_solution = solver.rGetCurrentSolution();
+
+        // The preconditioner from the first Newton step is good enough for all the others
+        CompressibleNonlinearElasticitySolver<2> reusing_solver(mesh, problem_defn, "comp_nonlin_elas_reuse_pc");
+        reusing_solver.SetPreconditionerReusePolicy(1e6);
+        reusing_solver.Solve();
+        unsigned num_newton_iterations = reusing_solver.GetNumNewtonIterations();
+        TS_ASSERT_LESS_THAN(1u, num_newton_iterations);
+
+        const PreconditionerReusePolicy* p_policy = reusing_solver.GetPreconditionerReusePolicy();
+        TS_ASSERT(p_policy != NULL);
+        TS_ASSERT_EQUALS(p_policy->GetNumSetups(), 1u);
+        TS_ASSERT_EQUALS(p_policy->GetNumSetupsAvoided(), num_newton_iterations-1);
+
+        std::vector<double>& r_solution = reusing_solver.rGetCurrentSolution();
+        TS_ASSERT_EQUALS(r_solution.size(), expected_solution.size());
+        for (unsigned i=0; i<r_solution.size(); i++)
+        {
+            TS_ASSERT_DELTA(r_solution[i], expected_solution[i], 1e-6);
+        }
+
+        // Allowing only one solve between set-ups rebuilds the preconditioner for every Newton step
+        CompressibleNonlinearElasticitySolver<2> rebuilding_solver(mesh, problem_defn, "comp_nonlin_elas_reuse_pc");
+        rebuilding_solver.SetPreconditionerReusePolicy(1.5, 1u);
+        rebuilding_solver.Solve();
+        TS_ASSERT_EQUALS(rebuilding_solver.GetPreconditionerReusePolicy()->GetNumSetups(), rebuilding_solver.GetNumNewtonIterations());
+        TS_ASSERT_EQUALS(rebuilding_solver.GetPreconditionerReusePolicy()->GetNumSetupsAvoided(), 0u);
+    }
+
     void TestCheckPositiveDefinitenessOfJacobianMatrix() throw(Exception)
     {
         unsigned num_elem = 10;
@@ -0,0 +1,112 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef FIRSTFAILURECOLLECTOR_HPP_
+#define FIRSTFAILURECOLLECTOR_HPP_
+
+#include <vector>
+
+#include "Exception.hpp"
+
+/**
+ * Collects the exceptions thrown by the iterations of a loop that may be run by several
+ * OpenMP threads, and keeps the one from the lowest iteration index.
+ *
+ * Exceptions must not escape a parallel region, so each iteration catches its own failure and
+ * records it here; once all threads have finished the loop, ThrowFirstFailure() rethrows the
+ * failure that a serial loop would have stopped at, whatever the number of threads or the
+ * order in which they ran.
+ *
+ * RecordFailure() and Merge() may be called concurrently from several threads.  A loop can
+ * either record straight into one collector, or give each thread its own collector (so that
+ * a thread can cheaply check whether it has failed) and merge them at the end.
+ */
+class FirstFailureCollector
+{
+private:
+
+    /** The index of the iteration that threw #mFirstFailure, or UNSIGNED_UNSET if none has failed. */
+    unsigned mFirstFailedIndex;
+
+    /** The exception thrown by iteration #mFirstFailedIndex (at most one entry, since Exception has no default constructor). */
+    std::vector<Exception> mFirstFailure;
+
+    /**
+     * Keep the given failure if it comes before the one held (if any).  Not thread safe.
+     *
+     * @param index  the index of the iteration that failed
+     * @param rException  the exception it threw
+     */
+    void KeepIfFirst(unsigned index, const Exception& rException);
+
+public:
+
+    /**
+     * Constructor, for a collector with no failures.
+     */
+    FirstFailureCollector();
+
+    /**
+     * Record that an iteration failed.
+     *
+     * @param index  the index of the iteration that failed
+     * @param rException  the exception it threw
+     */
+    void RecordFailure(unsigned index, const Exception& rException);
+
+    /**
+     * Record the first failure (if any) held by another collector.
+     *
+     * @param rOther  the other collector, which must not be changed concurrently
+     */
+    void Merge(const FirstFailureCollector& rOther);
+
+    /**
+     * @return whether any failure has been recorded.
+     */
+    bool HasFailed() const;
+
+    /**
+     * @return the index of the first iteration that failed, or UNSIGNED_UNSET if none did.
+     */
+    unsigned GetFirstFailedIndex() const;
+
+    /**
+     * Rethrow the exception from the first iteration that failed.  Does nothing if none did.
+     */
+    void ThrowFirstFailure() const;
+};
+
+#endif // FIRSTFAILURECOLLECTOR_HPP_
@@ -33,13 +33,16 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "DistributedVectorFactory.hpp"
 #include "PetscTools.hpp"
 
 // Initialise static data
 bool DistributedVectorFactory::msCheckNumberOfProcessesOnLoad = true;
+std::vector<unsigned> DistributedVectorFactory::msOwnershipWeightsOnLoad;
 
 void DistributedVectorFactory::CalculateOwnership(Vec vec)
 {
@@ -107,7 +110,12 @@ DistributedVectorFactory::DistributedVectorFactory(DistributedVectorFactory* pOr
      * Normally called when mpOriginalFactory->GetNumProcs() != PetscTools::GetNumProcs()
      * so ignore mpOriginalFactory->GetLocalOwnership()
      */
-    Vec vec = PetscTools::CreateVec(mpOriginalFactory->GetProblemSize());
+    PetscInt local = PETSC_DECIDE;
+    if (msOwnershipWeightsOnLoad.size() == mpOriginalFactory->GetProblemSize())
+    {
+        local = CalculateWeightedLocalOwnership(msOwnershipWeightsOnLoad);
+    }
+    Vec vec = PetscTools::CreateVec(mpOriginalFactory->GetProblemSize(), local);
 
     CalculateOwnership(vec);
     PetscTools::Destroy(vec);
@@ -126,6 +134,55 @@ DistributedVectorFactory::DistributedVectorFactory(unsigned lo, unsigned hi, uns
 #endif
 }
 
+unsigned DistributedVectorFactory::CalculateWeightedLocalOwnership(const std::vector<unsigned>& rWeights)
+{
+    const unsigned num_indices = rWeights.size();
+    const unsigned num_procs = PetscTools::GetNumProcs();
+    const unsigned my_rank = PetscTools::GetMyRank();
+
+    double total_weight = 0.0;
+    for (unsigned i=0; i<num_indices; i++)
+    {
+        total_weight += rWeights[i];
+    }
+
+    /*
+     * Index i goes to the process whose share of the total weight contains the midpoint
+     * of i's weight.  The owners are then adjusted so that they never decrease, never
+     * skip a process, and leave enough indices for the processes still to come.
+     */
+    unsigned num_owned = 0;
+    unsigned owner = 0;
+    double weight_so_far = 0.0;
+    for (unsigned i=0; i<num_indices; i++)
+    {
+        double weight = (total_weight > 0.0) ? rWeights[i] : 1.0;
+        double scale = (total_weight > 0.0) ? total_weight : num_indices;
+        unsigned ideal_owner = std::min(num_procs-1, (unsigned) floor(num_procs*(weight_so_far + 0.5*weight)/scale));
+        weight_so_far += weight;
+
+        if (i > 0)
+        {
+            ideal_owner = std::max(owner, std::min(ideal_owner, owner+1));
+        }
+        else
+        {
+            ideal_owner = 0;
+        }
+        if (num_indices >= num_procs && num_procs - ideal_owner > num_indices - i)
+        {
+            ideal_owner = num_procs - (num_indices - i);
+        }
+        owner = ideal_owner;
+
+        if (owner == my_rank)
+        {
+            num_owned++;
+        }
+    }
+    return num_owned;
+}
+
 DistributedVectorFactory::~DistributedVectorFactory()
 {
     delete mpOriginalFactory;
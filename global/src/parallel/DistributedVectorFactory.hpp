@@ -38,6 +38,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ChasteSerialization.hpp"
 #include <petscvec.h>
+#include <vector>
 
 #include "DistributedVector.hpp"
 #include "Exception.hpp"
@@ -84,6 +85,14 @@ private:
      */
     static bool msCheckNumberOfProcessesOnLoad;
 
+    /**
+     * Relative weights of each global index, used when loading an instance from an
+     * archive without checking the number of processes.  If not empty, the ownership
+     * of the loaded factory is a contiguous split balancing these weights rather than
+     * PETSc's even split.  See SetOwnershipWeightsOnLoad().
+     */
+    static std::vector<unsigned> msOwnershipWeightsOnLoad;
+
     /**
      * If this instance was loaded from an archive, this points to a factory with
      * the settings from the archive, which may not be the same as this instance.
@@ -136,8 +145,10 @@ public:
 
     /**
      * Constructor for use in archiving.
-     * Note that this constructor is only called when the number of processes is different from the original.
-     * Therefore, the orignal local node ownership cannot be used, and a new even partition will be applied.
+     * Note that this constructor is only called when the number of processes is different from the original,
+     * or when a new ownership has been requested with SetOwnershipWeightsOnLoad().
+     * Therefore, the orignal local node ownership cannot be used, and a new even partition (or a partition
+     * balancing #msOwnershipWeightsOnLoad, if these match the problem size) will be applied.
      *
      * @param pOriginalFactory  see #mpOriginalFactory
      */
@@ -249,6 +260,42 @@ public:
         return msCheckNumberOfProcessesOnLoad;
     }
 
+    /**
+     * Set weights for each global index to use when loading an instance from an archive
+     * with #msCheckNumberOfProcessesOnLoad unset.  The loaded factory will then give each
+     * process a contiguous range of indices of roughly equal total weight, even if running
+     * on the same number of processes as the original.  This allows a simulation to be
+     * repartitioned when it is migrated.  Pass an empty vector to return to the default
+     * behaviour.
+     *
+     * @param rWeights  the weight of each global index (entries should be positive)
+     */
+    static void SetOwnershipWeightsOnLoad(const std::vector<unsigned>& rWeights)
+    {
+        msOwnershipWeightsOnLoad = rWeights;
+    }
+
+    /**
+     * @return the weights set by SetOwnershipWeightsOnLoad() (empty if none are in use).
+     */
+    static const std::vector<unsigned>& rGetOwnershipWeightsOnLoad()
+    {
+        return msOwnershipWeightsOnLoad;
+    }
+
+    /**
+     * Work out how many indices this process should own in a contiguous split of the
+     * given indices which balances their weights across processes.  Each process is
+     * given at least one index (if there are enough to go round).
+     *
+     * @note The weights must be the same on all processes, but this method does no communication.
+     *
+     * @param rWeights  the weight of each global index
+     * @return the local ownership for this process, suitable for passing to the
+     *     DistributedVectorFactory(unsigned, PetscInt) constructor
+     */
+    static unsigned CalculateWeightedLocalOwnership(const std::vector<unsigned>& rWeights);
+
     /**
      * If #msCheckNumberOfProcessesOnLoad is not set, and this factory was loaded from
      * an archive, then return a factory with the settings from the archive, which may
@@ -335,6 +382,12 @@ inline void load_construct_data(
     if (!DistributedVectorFactory::CheckNumberOfProcessesOnLoad())
     {
         ::new(t)DistributedVectorFactory(p_original_factory);
+
+        const std::vector<unsigned>& r_weights = DistributedVectorFactory::rGetOwnershipWeightsOnLoad();
+        if (!r_weights.empty() && r_weights.size() != size)
+        {
+            EXCEPTION("The ownership weights given for loading do not match the archived problem size.");
+        }
     }
     else
     {
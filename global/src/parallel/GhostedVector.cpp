@@ -0,0 +1,156 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "GhostedVector.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+#include <cassert>
+#include <iostream>
+
+// Private methods
+
+void GhostedVector::RemovePetscContext()
+{
+    if (mGhosted != NULL)
+    {
+        PetscTools::Destroy(mGhosted);
+        mGhosted = NULL;
+    }
+
+    if (mpData != NULL)
+    {
+        delete[] mpData;
+        mpData = NULL;
+    }
+}
+
+// Constructors & destructors
+
+GhostedVector::GhostedVector()
+    : mpData(NULL),
+      mSize(0),
+      mLo(0),
+      mHi(0),
+      mGhosted(NULL)
+{
+}
+
+GhostedVector::~GhostedVector()
+{
+    RemovePetscContext();
+}
+
+// Vector interface methods
+
+unsigned GhostedVector::GetSize()
+{
+    return mSize;
+}
+
+unsigned GhostedVector::GetNumGhosts()
+{
+    return mGhostPositions.size();
+}
+
+void GhostedVector::Resize(unsigned lo, unsigned hi, unsigned size, const std::vector<unsigned>& rGhostIndices)
+{
+    assert(lo <= hi && hi <= size);
+
+    // PETSc stuff will be out of date
+    RemovePetscContext();
+
+    mSize = size;
+    mLo = lo;
+    mHi = hi;
+    mGhostPositions.clear();
+    for (unsigned i=0; i<rGhostIndices.size(); i++)
+    {
+        assert(rGhostIndices[i] < lo || rGhostIndices[i] >= hi);
+        mGhostPositions[rGhostIndices[i]] = hi - lo + i;
+    }
+    assert(mGhostPositions.size() == rGhostIndices.size()); // No duplicates
+
+    const unsigned num_stored = hi - lo + rGhostIndices.size();
+    try
+    {
+        mpData = new double[num_stored];
+    }
+    catch(std::bad_alloc &badAlloc)
+    {
+#define COVERAGE_IGNORE
+        std::cout << "Failed to allocate a GhostedVector with " << num_stored << " local entries" << std::endl;
+        PetscTools::ReplicateException(true);
+        throw badAlloc;
+#undef COVERAGE_IGNORE
+    }
+    PetscTools::ReplicateException(false);
+
+    for (unsigned i=0; i<num_stored; i++)
+    {
+        mpData[i] = 0.0;
+    }
+
+    if (!PetscTools::IsSequential())
+    {
+        std::vector<PetscInt> ghosts(rGhostIndices.begin(), rGhostIndices.end());
+        VecCreateGhostWithArray(PETSC_COMM_WORLD, hi-lo, size, ghosts.size(),
+                                ghosts.empty() ? NULL : &ghosts[0], mpData, &mGhosted);
+    }
+}
+
+double& GhostedVector::operator[](unsigned globalIndex)
+{
+    if (mLo <= globalIndex && globalIndex < mHi)
+    {
+        return mpData[globalIndex - mLo];
+    }
+    std::map<unsigned, unsigned>::const_iterator it = mGhostPositions.find(globalIndex);
+    if (it == mGhostPositions.end())
+    {
+        EXCEPTION("Entry " << globalIndex << " of the vector is neither owned by this process nor a ghost.");
+    }
+    return mpData[it->second];
+}
+
+void GhostedVector::UpdateGhosts()
+{
+    if (mGhosted != NULL)
+    {
+        VecGhostUpdateBegin(mGhosted, INSERT_VALUES, SCATTER_FORWARD);
+        VecGhostUpdateEnd(mGhosted, INSERT_VALUES, SCATTER_FORWARD);
+    }
+}
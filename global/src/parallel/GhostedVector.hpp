@@ -0,0 +1,122 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef GHOSTEDVECTOR_HPP_
+#define GHOSTEDVECTOR_HPP_
+
+#include <map>
+#include <vector>
+#include <petscvec.h>
+#include <boost/utility.hpp>
+
+/**
+ * A vector indexed by global index, which stores only the entries owned by this
+ * process and a given set of "ghost" entries owned by other processes.
+ *
+ * Unlike ReplicatableVector, the memory used and the amount of data communicated
+ * depend on the size of this process's partition rather than on the global size.
+ * The ghost entries are brought up to date by UpdateGhosts(), which uses a PETSc
+ * ghosted vector sharing our storage.
+ */
+class GhostedVector : private boost::noncopyable
+{
+private:
+
+    double* mpData;     /**< The owned entries, followed by the ghost entries. */
+    unsigned mSize;     /**< The length of the global vector. */
+    unsigned mLo;       /**< The start of our ownership range. */
+    unsigned mHi;       /**< One past the end of our ownership range. */
+    Vec mGhosted;       /**< PETSc ghosted vector wrapping #mpData (NULL when running sequentially). */
+
+    /** Map from the global index of each ghost entry to its position in #mpData. */
+    std::map<unsigned, unsigned> mGhostPositions;
+
+    /**
+     * Clear data. Used in resize method and destructor.
+     */
+    void RemovePetscContext();
+
+public:
+
+    /**
+     * Default constructor.
+     * Note that the vector will need to be resized before it can be used.
+     */
+    GhostedVector();
+
+    /**
+     * Default destructor.
+     * Remove PETSc context.
+     */
+    ~GhostedVector();
+
+    /**
+     * @return the size of the global vector.
+     */
+    unsigned GetSize();
+
+    /**
+     * @return the number of ghost entries stored on this process.
+     */
+    unsigned GetNumGhosts();
+
+    /**
+     * Resize the vector, setting all the entries to zero.  This is collective when running
+     * in parallel.
+     *
+     * @param lo  The start of our ownership range
+     * @param hi  One past the end of our ownership range
+     * @param size  The size of the global vector
+     * @param rGhostIndices  The global indices, outside our ownership range, of the ghost entries
+     */
+    void Resize(unsigned lo, unsigned hi, unsigned size, const std::vector<unsigned>& rGhostIndices);
+
+    /**
+     * Access the vector.  Throws if the entry is neither owned nor a ghost.
+     *
+     * @param globalIndex the global index of the entry to return
+     * @return reference to component of the vector
+     */
+    double& operator[](unsigned globalIndex);
+
+    /**
+     * Copy the owned entries of every process into the ghost entries of the others.
+     * This is collective when running in parallel.
+     */
+    void UpdateGhosts();
+};
+
+#endif /*GHOSTEDVECTOR_HPP_*/
@@ -83,7 +83,12 @@ public:
         CellBasedEventHandler::EndEvent(CellBasedEventHandler::OUTPUT);
 
         CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE);
-        CellBasedEventHandler::MilliSleep(90);
+        CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE_SETUP);
+        CellBasedEventHandler::MilliSleep(40);
+        CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SETUP);
+        CellBasedEventHandler::BeginEvent(CellBasedEventHandler::PDE_SOLVE);
+        CellBasedEventHandler::MilliSleep(50);
+        CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE_SOLVE);
         CellBasedEventHandler::EndEvent(CellBasedEventHandler::PDE);
 
         CellBasedEventHandler::EndEvent(CellBasedEventHandler::EVERYTHING);
@@ -159,6 +159,51 @@ public:
                               "Cannot set from a factory for a different problem size.");
     }
 
+    void TestWeightedLocalOwnership()
+    {
+        unsigned num_procs = PetscTools::GetNumProcs();
+        unsigned my_rank = PetscTools::GetMyRank();
+
+        // Equal weights give the same split as PETSc
+        std::vector<unsigned> equal_weights(10*num_procs, 3u);
+        TS_ASSERT_EQUALS(DistributedVectorFactory::CalculateWeightedLocalOwnership(equal_weights), 10u);
+
+        // The first half of the indices are 4 times as expensive as the rest
+        std::vector<unsigned> weights(20*num_procs, 1u);
+        for (unsigned i=0; i<10*num_procs; i++)
+        {
+            weights[i] = 4u;
+        }
+        DistributedVectorFactory factory(weights.size(), DistributedVectorFactory::CalculateWeightedLocalOwnership(weights));
+        TS_ASSERT_EQUALS(factory.GetProblemSize(), weights.size());
+
+        unsigned local_weight = 0;
+        for (unsigned i=factory.GetLow(); i<factory.GetHigh(); i++)
+        {
+            local_weight += weights[i];
+        }
+        // The total weight is 50*num_procs, and no index outweighs 4
+        TS_ASSERT_LESS_THAN_EQUALS(local_weight, 54u);
+        TS_ASSERT_LESS_THAN_EQUALS(46u, local_weight);
+
+        // A single very expensive index still leaves every process something to own
+        std::vector<unsigned> one_heavy(2*num_procs, 1u);
+        one_heavy[0] = 1000u;
+        unsigned num_owned = DistributedVectorFactory::CalculateWeightedLocalOwnership(one_heavy);
+        TS_ASSERT_LESS_THAN_EQUALS(1u, num_owned);
+        if (PetscTools::IsParallel() && my_rank == 0u)
+        {
+            TS_ASSERT_EQUALS(num_owned, 1u);
+        }
+
+        // Weights for loading are off by default
+        TS_ASSERT(DistributedVectorFactory::rGetOwnershipWeightsOnLoad().empty());
+        DistributedVectorFactory::SetOwnershipWeightsOnLoad(weights);
+        TS_ASSERT_EQUALS(DistributedVectorFactory::rGetOwnershipWeightsOnLoad().size(), weights.size());
+        DistributedVectorFactory::SetOwnershipWeightsOnLoad(std::vector<unsigned>());
+        TS_ASSERT(DistributedVectorFactory::rGetOwnershipWeightsOnLoad().empty());
+    }
+
     void TestRead()
     {
         // WRITE VECTOR
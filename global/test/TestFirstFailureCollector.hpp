@@ -0,0 +1,104 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTFIRSTFAILURECOLLECTOR_HPP_
+#define TESTFIRSTFAILURECOLLECTOR_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <sstream>
+#include "FirstFailureCollector.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+class TestFirstFailureCollector : public CxxTest::TestSuite
+{
+public:
+
+    void TestRecordAndMerge()
+    {
+        FirstFailureCollector failures;
+        TS_ASSERT(!failures.HasFailed());
+        TS_ASSERT_EQUALS(failures.GetFirstFailedIndex(), UNSIGNED_UNSET);
+        TS_ASSERT_THROWS_NOTHING(failures.ThrowFirstFailure());
+
+        // Only the failure with the lowest index is kept, whatever the order they are recorded in
+        failures.RecordFailure(7u, Exception("Seventh", "file", 1u));
+        failures.RecordFailure(3u, Exception("Third", "file", 1u));
+        failures.RecordFailure(5u, Exception("Fifth", "file", 1u));
+        TS_ASSERT(failures.HasFailed());
+        TS_ASSERT_EQUALS(failures.GetFirstFailedIndex(), 3u);
+        TS_ASSERT_THROWS_THIS(failures.ThrowFirstFailure(), "Third");
+
+        // Merging an empty collector, or a later failure, changes nothing
+        FirstFailureCollector other_failures;
+        failures.Merge(other_failures);
+        other_failures.RecordFailure(4u, Exception("Fourth", "file", 1u));
+        failures.Merge(other_failures);
+        TS_ASSERT_THROWS_THIS(failures.ThrowFirstFailure(), "Third");
+
+        // Merging an earlier failure replaces it
+        other_failures.RecordFailure(1u, Exception("First", "file", 1u));
+        failures.Merge(other_failures);
+        TS_ASSERT_EQUALS(failures.GetFirstFailedIndex(), 1u);
+        TS_ASSERT_THROWS_THIS(failures.ThrowFirstFailure(), "First");
+    }
+
+    void TestParallelLoop()
+    {
+        // Every iteration from 10 on fails, and the failure from iteration 10 is the one thrown
+        FirstFailureCollector failures;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif // _OPENMP
+        for (int i=0; i<100; i++)
+        {
+            try
+            {
+                if (i >= 10)
+                {
+                    EXCEPTION("Iteration " << i << " failed");
+                }
+            }
+            catch (Exception& e)
+            {
+                failures.RecordFailure(i, e);
+            }
+        }
+
+        TS_ASSERT_EQUALS(failures.GetFirstFailedIndex(), 10u);
+        TS_ASSERT_THROWS_THIS(failures.ThrowFirstFailure(), "Iteration 10 failed");
+    }
+};
+
+#endif // TESTFIRSTFAILURECOLLECTOR_HPP_
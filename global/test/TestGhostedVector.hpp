@@ -0,0 +1,132 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTGHOSTEDVECTOR_HPP_
+#define TESTGHOSTEDVECTOR_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <algorithm>
+#include <petscvec.h>
+
+#include "PetscSetupAndFinalize.hpp"
+#include "GhostedVector.hpp"
+#include "PetscTools.hpp"
+
+class TestGhostedVector : public CxxTest::TestSuite
+{
+public:
+
+    void TestGhostUpdate()
+    {
+        for (unsigned vec_size=0; vec_size<10; vec_size++)
+        {
+            int lo, hi;
+            Vec temp_vec = PetscTools::CreateVec(vec_size);
+            VecGetOwnershipRange(temp_vec, &lo, &hi);
+            PetscTools::Destroy(temp_vec); // vector no longer needed
+
+            // Each process has the entries just either side of its ownership range as ghosts
+            std::vector<unsigned> ghosts;
+            if (lo > 0)
+            {
+                ghosts.push_back(lo-1);
+            }
+            if (hi < (int) vec_size && hi > lo)
+            {
+                ghosts.push_back(hi);
+            }
+
+            GhostedVector ghosted_vector;
+            ghosted_vector.Resize(lo, hi, vec_size, ghosts);
+            TS_ASSERT_EQUALS(ghosted_vector.GetSize(), vec_size);
+            TS_ASSERT_EQUALS(ghosted_vector.GetNumGhosts(), ghosts.size());
+
+            for (int global_index=lo; global_index<hi; global_index++)
+            {
+                ghosted_vector[global_index] = 2.0*global_index;
+            }
+            ghosted_vector.UpdateGhosts();
+
+            for (int global_index=lo; global_index<hi; global_index++)
+            {
+                TS_ASSERT_EQUALS(ghosted_vector[global_index], 2.0*global_index);
+            }
+            if (PetscTools::IsParallel())
+            {
+                for (unsigned i=0; i<ghosts.size(); i++)
+                {
+                    TS_ASSERT_EQUALS(ghosted_vector[ghosts[i]], 2.0*ghosts[i]);
+                }
+            }
+
+            // Only owned and ghost entries are stored
+            for (unsigned global_index=0; global_index<vec_size; global_index++)
+            {
+                bool is_ghost = (std::find(ghosts.begin(), ghosts.end(), global_index) != ghosts.end());
+                if (((int) global_index < lo || (int) global_index >= hi) && !is_ghost)
+                {
+                    TS_ASSERT_THROWS_CONTAINS(ghosted_vector[global_index], "is neither owned by this process nor a ghost");
+                }
+            }
+        }
+    }
+
+    void TestResize()
+    {
+        int lo, hi;
+        Vec temp_vec = PetscTools::CreateVec(10);
+        VecGetOwnershipRange(temp_vec, &lo, &hi);
+        PetscTools::Destroy(temp_vec);
+
+        GhostedVector ghosted_vector;
+        ghosted_vector.Resize(lo, hi, 10, std::vector<unsigned>());
+        for (int global_index=lo; global_index<hi; global_index++)
+        {
+            TS_ASSERT_EQUALS(ghosted_vector[global_index], 0.0);
+            ghosted_vector[global_index] = 1.0;
+        }
+
+        // Resizing resets the entries
+        ghosted_vector.Resize(lo, hi, 10, std::vector<unsigned>());
+        TS_ASSERT_EQUALS(ghosted_vector.GetNumGhosts(), 0u);
+        for (int global_index=lo; global_index<hi; global_index++)
+        {
+            TS_ASSERT_EQUALS(ghosted_vector[global_index], 0.0);
+        }
+    }
+};
+
+#endif /*TESTGHOSTEDVECTOR_HPP_*/
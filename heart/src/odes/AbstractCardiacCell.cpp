@@ -67,6 +67,11 @@ void AbstractCardiacCell::SetTimestep(double dt)
     mDt = dt;
 }
 
+double AbstractCardiacCell::GetTimestep()
+{
+    return mDt;
+}
+
 void AbstractCardiacCell::SolveAndUpdateState(double tStart, double tEnd)
 {
     mpOdeSolver->SolveAndUpdateStateVariable(this, tStart, tEnd, mDt);
@@ -124,6 +129,11 @@ std::vector<double> AbstractCardiacCell::GetStdVecStateVariables()
     return AbstractOdeSystem::GetStateVariables();
 }
 
+void AbstractCardiacCell::CopyStdVecStateVariables(std::vector<double>& rStateVariables)
+{
+    rStateVariables = AbstractOdeSystem::rGetStateVariables();
+}
+
 const std::vector<std::string>& AbstractCardiacCell::rGetStateVariableNames() const
 {
     return AbstractOdeSystem::rGetStateVariableNames();
@@ -172,6 +172,11 @@ public:
      */
     void SetTimestep(double dt);
 
+    /**
+     * @return the timestep used for simulating this cell.
+     */
+    double GetTimestep();
+
     /**
      * Simulate this cell's behaviour between the time interval [tStart, tEnd],
      * with timestemp #mDt, updating the internal state variable values.
@@ -246,6 +251,13 @@ public:
      */
     std::vector<double> GetStdVecStateVariables();
 
+    /**
+     * Copy the state variables into a std::vector without allocating, if it is already the right size.
+     *
+     * @param rStateVariables  filled in with the state variables
+     */
+    void CopyStdVecStateVariables(std::vector<double>& rStateVariables);
+
     /**
      * Just calls AbstractOdeSystem::rGetStateVariableNames().
      *
@@ -0,0 +1,90 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef ABSTRACTCARDIACCELLBLOCK_HPP_
+#define ABSTRACTCARDIACCELLBLOCK_HPP_
+
+#include "Exception.hpp"
+
+/**
+ * Common interface to a block of cardiac cells of the same model which are solved
+ * together, rather than one at a time, by AbstractCardiacTissue::SolveCellSystems().
+ *
+ * The cells remain the owners of their state, and are not owned by the block.
+ */
+class AbstractCardiacCellBlock
+{
+protected:
+    /** Index within the block of the cell whose solve last failed, or UNSIGNED_UNSET. */
+    unsigned mFailedCellIndex;
+
+public:
+    /** Default constructor. */
+    AbstractCardiacCellBlock()
+        : mFailedCellIndex(UNSIGNED_UNSET)
+    {
+    }
+
+    /** Virtual destructor. */
+    virtual ~AbstractCardiacCellBlock()
+    {
+    }
+
+    /** @return the number of cells in this block. */
+    virtual unsigned GetNumCells() const=0;
+
+    /**
+     * @return the index within the block of the cell which caused the last call of
+     * ComputeExceptVoltage() to throw.
+     */
+    unsigned GetFailedCellIndex() const
+    {
+        return mFailedCellIndex;
+    }
+
+    /**
+     * Simulate the cells between the time interval [tStart, tEnd], without updating
+     * their voltages, which should have been set on each cell beforehand.
+     *
+     * If a cell fails, this throws and GetFailedCellIndex() says which cell it was.
+     *
+     * @param tStart  beginning of the time interval to simulate
+     * @param tEnd  end of the time interval to simulate
+     */
+    virtual void ComputeExceptVoltage(double tStart, double tEnd)=0;
+};
+
+#endif // ABSTRACTCARDIACCELLBLOCK_HPP_
@@ -103,6 +103,12 @@ double AbstractCardiacCellInterface::GetIntracellularStimulus(double time)
 }
 
 
+bool AbstractCardiacCellInterface::IsIntracellularStimulusZeroBetween(double startTime, double endTime)
+{
+    return mpIntracellularStimulus->IsZeroBetween(startTime, endTime, 0.5*GetTimestep());
+}
+
+
 double AbstractCardiacCellInterface::GetIntracellularAreaStimulus(double time)
 {
     double stim;
@@ -84,6 +84,11 @@ public:
      */
     virtual void SetTimestep(double dt)=0;
 
+    /**
+     * @return the timestep (or maximum timestep when using CVODE) used for simulating this cell.
+     */
+    virtual double GetTimestep()=0;
+
     /**
      * All subclasses must implement this method to get the number of state variables.
      *
@@ -111,6 +116,15 @@ public:
      */
     virtual std::vector<double> GetStdVecStateVariables()=0;
 
+    /**
+     * Copy the state variables into a std::vector.  Unlike GetStdVecStateVariables() this
+     * doesn't allocate memory if the vector is already the right size, so is suitable for
+     * calling every time step.
+     *
+     * @param rStateVariables  filled in with the cell model's internal state variables
+     */
+    virtual void CopyStdVecStateVariables(std::vector<double>& rStateVariables)=0;
+
     /**
      * All subclasses must implement this method to get variable names.
      *
@@ -305,6 +319,16 @@ public:
      */
     double GetIntracellularStimulus(double time);
 
+    /**
+     * @return whether the intracellular stimulus is zero throughout [startTime, endTime].
+     * Stimuli that can only be sampled are sampled every half timestep (see GetTimestep()),
+     * so as to see what an explicit ODE solver would see at its stage times.
+     *
+     * @param startTime  the start of the interval
+     * @param endTime  the end of the interval
+     */
+    bool IsIntracellularStimulusZeroBetween(double startTime, double endTime);
+
     /**
      * @return the value of the intracellular stimulus.
      * This will always be in units of uA/cm^2.
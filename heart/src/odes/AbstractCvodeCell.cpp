@@ -157,6 +157,11 @@ std::vector<double> AbstractCvodeCell::GetStdVecStateVariables()
     return state_variables;
 }
 
+void AbstractCvodeCell::CopyStdVecStateVariables(std::vector<double>& rStateVariables)
+{
+    CopyToStdVector(AbstractCvodeSystem::rGetStateVariables(), rStateVariables);
+}
+
 const std::vector<std::string>& AbstractCvodeCell::rGetStateVariableNames() const
 {
     return AbstractCvodeSystem::rGetStateVariableNames();
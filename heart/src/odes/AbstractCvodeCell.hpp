@@ -231,6 +231,13 @@ public:
      */
     std::vector<double> GetStdVecStateVariables();
 
+    /**
+     * Copy the state variables into a std::vector without allocating, if it is already the right size.
+     *
+     * @param rStateVariables  filled in with the state variables
+     */
+    void CopyStdVecStateVariables(std::vector<double>& rStateVariables);
+
     /**
      * Just calls AbstractCvodeSystem::rGetStateVariableNames().
      *
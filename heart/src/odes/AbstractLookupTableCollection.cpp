@@ -35,7 +35,58 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractLookupTableCollection.hpp"
 
+#include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "ChasteSyscalls.hpp"
+#include "Exception.hpp"
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif // _MSC_VER
+
+/** Identifies lookup table cache files; change the version if the file format changes. */
+static const char CACHE_FILE_MAGIC[16] = "ChasteLUTv1";
+
+/**
+ * Size of the header of a lookup table cache file: magic string, 2 unsigned and 4 double
+ * table properties, padded to keep the tables suitably aligned.
+ */
+static const unsigned CACHE_FILE_HEADER_SIZE = 64u;
+
+/**
+ * Fill in the header for a lookup table cache file.
+ *
+ * @param pHeader  buffer of size CACHE_FILE_HEADER_SIZE to fill in
+ * @param numTables  number of tables keyed by this variable
+ * @param tableSize  number of entries in each table
+ * @param min  the lower table bound
+ * @param step  the table spacing
+ * @param max  the upper table bound
+ * @param dt  the timestep used in the tables
+ */
+static void FillCacheFileHeader(char* pHeader, unsigned numTables, unsigned tableSize,
+                                double min, double step, double max, double dt)
+{
+    memset(pHeader, 0, CACHE_FILE_HEADER_SIZE);
+    char* p_pos = pHeader;
+    memcpy(p_pos, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)); p_pos += sizeof(CACHE_FILE_MAGIC);
+    memcpy(p_pos, &numTables, sizeof(unsigned)); p_pos += sizeof(unsigned);
+    memcpy(p_pos, &tableSize, sizeof(unsigned)); p_pos += sizeof(unsigned);
+    memcpy(p_pos, &min, sizeof(double)); p_pos += sizeof(double);
+    memcpy(p_pos, &step, sizeof(double)); p_pos += sizeof(double);
+    memcpy(p_pos, &max, sizeof(double)); p_pos += sizeof(double);
+    memcpy(p_pos, &dt, sizeof(double)); p_pos += sizeof(double);
+    assert(p_pos <= pHeader + CACHE_FILE_HEADER_SIZE);
+}
+
+std::string AbstractLookupTableCollection::msCacheDirectory;
 
 AbstractLookupTableCollection::AbstractLookupTableCollection()
     : mDt(0.0)
@@ -107,8 +158,182 @@ unsigned AbstractLookupTableCollection::GetTableIndex(const std::string& rKeying
     return i;
 }
 
+void AbstractLookupTableCollection::SetCacheDirectory(const std::string& rPath)
+{
+    msCacheDirectory = rPath;
+}
+
+const std::string& AbstractLookupTableCollection::rGetCacheDirectory()
+{
+    return msCacheDirectory;
+}
+
+std::string AbstractLookupTableCollection::GetCacheFilePath(unsigned keyIndex) const
+{
+    std::stringstream path;
+    path << std::setprecision(17) << msCacheDirectory;
+    if (*(msCacheDirectory.rbegin()) != '/')
+    {
+        path << '/';
+    }
+    path << mCacheKey << "_" << mKeyingVariableNames[keyIndex]
+         << "_" << mTableMins[keyIndex] << "_" << mTableSteps[keyIndex] << "_" << mTableMaxs[keyIndex]
+         << "_" << mDt << ".lut";
+    return path.str();
+}
+
+double* AbstractLookupTableCollection::AllocateTables(unsigned keyIndex, unsigned tableSize, bool& rLoadedFromCache)
+{
+    assert(keyIndex < mKeyingVariableNames.size());
+    if (mTableMemory.size() != mKeyingVariableNames.size())
+    {
+        mTableMemory.resize(mKeyingVariableNames.size(), NULL);
+        mTableMemorySize.resize(mKeyingVariableNames.size(), 0u);
+        mTableMemoryIsMapped.resize(mKeyingVariableNames.size(), false);
+    }
+    FreeTables(keyIndex);
+
+    const unsigned num_doubles = tableSize * mNumberOfTables[keyIndex];
+    mTableMemorySize[keyIndex] = num_doubles;
+    rLoadedFromCache = false;
+
+    if (!msCacheDirectory.empty() && !mCacheKey.empty())
+    {
+        char expected_header[CACHE_FILE_HEADER_SIZE];
+        FillCacheFileHeader(expected_header, mNumberOfTables[keyIndex], tableSize,
+                            mTableMins[keyIndex], mTableSteps[keyIndex], mTableMaxs[keyIndex], mDt);
+        const std::string path = GetCacheFilePath(keyIndex);
+        const size_t file_size = CACHE_FILE_HEADER_SIZE + num_doubles*sizeof(double);
+#ifndef _MSC_VER
+        // Map the file read-only, so all processes on this node share the same pages
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd != -1)
+        {
+            struct stat file_info;
+            if (fstat(fd, &file_info) == 0 && (size_t)file_info.st_size == file_size)
+            {
+                void* p_map = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+                if (p_map != MAP_FAILED)
+                {
+                    if (memcmp(p_map, expected_header, CACHE_FILE_HEADER_SIZE) == 0)
+                    {
+                        mTableMemory[keyIndex] = reinterpret_cast<double*>(static_cast<char*>(p_map) + CACHE_FILE_HEADER_SIZE);
+                        mTableMemoryIsMapped[keyIndex] = true;
+                        rLoadedFromCache = true;
+                    }
+                    else
+                    {
+                        munmap(p_map, file_size);
+                    }
+                }
+            }
+            close(fd); // The mapping remains valid
+        }
+#else
+        // No memory mapping, but we can still save regenerating the tables
+        std::ifstream cache_file(path.c_str(), std::ios::binary);
+        char header[CACHE_FILE_HEADER_SIZE];
+        if (cache_file.read(header, CACHE_FILE_HEADER_SIZE)
+            && memcmp(header, expected_header, CACHE_FILE_HEADER_SIZE) == 0)
+        {
+            double* p_tables = new double[num_doubles];
+            if (cache_file.read(reinterpret_cast<char*>(p_tables), num_doubles*sizeof(double)))
+            {
+                mTableMemory[keyIndex] = p_tables;
+                rLoadedFromCache = true;
+            }
+            else
+            {
+                delete[] p_tables;
+            }
+        }
+#endif // _MSC_VER
+    }
+
+    if (!rLoadedFromCache)
+    {
+        mTableMemory[keyIndex] = new double[num_doubles];
+    }
+    return mTableMemory[keyIndex];
+}
+
+void AbstractLookupTableCollection::SaveTablesToCache(unsigned keyIndex)
+{
+    if (msCacheDirectory.empty() || mCacheKey.empty())
+    {
+        return;
+    }
+    assert(keyIndex < mTableMemory.size() && mTableMemory[keyIndex] != NULL);
+    assert(!mTableMemoryIsMapped[keyIndex]);
+
+    const unsigned num_doubles = mTableMemorySize[keyIndex];
+    const unsigned table_size = num_doubles / mNumberOfTables[keyIndex];
+    char header[CACHE_FILE_HEADER_SIZE];
+    FillCacheFileHeader(header, mNumberOfTables[keyIndex], table_size,
+                        mTableMins[keyIndex], mTableSteps[keyIndex], mTableMaxs[keyIndex], mDt);
+
+    /*
+     * Write to a file unique to this process, then rename it into place.  The rename is atomic,
+     * so other processes will only ever see a complete cache file, even if several are populating
+     * the cache at once (in which case they all write the same tables).
+     */
+    const std::string path = GetCacheFilePath(keyIndex);
+    std::stringstream temp_path;
+    temp_path << path << ".tmp";
+#ifndef _MSC_VER
+    char host_name[256];
+    if (gethostname(host_name, sizeof(host_name)) == 0)
+    {
+        host_name[sizeof(host_name)-1] = '\0';
+        temp_path << "." << host_name;
+    }
+#endif // _MSC_VER
+    temp_path << "." << getpid();
+
+    bool written;
+    {
+        std::ofstream cache_file(temp_path.str().c_str(), std::ios::binary);
+        written = cache_file.write(header, CACHE_FILE_HEADER_SIZE)
+                  && cache_file.write(reinterpret_cast<const char*>(mTableMemory[keyIndex]), num_doubles*sizeof(double));
+        cache_file.close();
+        written = written && cache_file.good();
+    }
+    // The cache is an optimisation, so failing to populate it isn't an error
+    if (!written || std::rename(temp_path.str().c_str(), path.c_str()) != 0)
+    {
+        std::remove(temp_path.str().c_str());
+    }
+}
+
+void AbstractLookupTableCollection::FreeTables(unsigned keyIndex)
+{
+    if (keyIndex >= mTableMemory.size() || mTableMemory[keyIndex] == NULL)
+    {
+        return;
+    }
+    if (mTableMemoryIsMapped[keyIndex])
+    {
+#ifndef _MSC_VER
+        munmap(reinterpret_cast<char*>(mTableMemory[keyIndex]) - CACHE_FILE_HEADER_SIZE,
+               CACHE_FILE_HEADER_SIZE + mTableMemorySize[keyIndex]*sizeof(double));
+#else
+        NEVER_REACHED;
+#endif // _MSC_VER
+    }
+    else
+    {
+        delete[] mTableMemory[keyIndex];
+    }
+    mTableMemory[keyIndex] = NULL;
+    mTableMemoryIsMapped[keyIndex] = false;
+}
+
 AbstractLookupTableCollection::~AbstractLookupTableCollection()
 {
+    for (unsigned i=0; i<mTableMemory.size(); i++)
+    {
+        FreeTables(i);
+    }
 }
 
 const char* AbstractLookupTableCollection::EventHandler::EventName[] =  {"GenTables"};
@@ -114,6 +114,28 @@ public:
     /** Virtual destructor since we have a virtual method. */
     virtual ~AbstractLookupTableCollection();
 
+    /**
+     * Set a directory in which to cache generated lookup tables, or an empty string (the default)
+     * for no caching.
+     *
+     * Tables are stored in files named for the cell model, table settings and timestep, so a cache
+     * directory can be shared by different models and simulations.  When a table is found in the
+     * cache it is mapped read-only into memory rather than regenerated, so processes on the same
+     * node share a single physical copy of each table.  The cache is populated by whichever process
+     * first generates a table, and is safe to use from many processes at once.
+     *
+     * This must be called before any cells using lookup tables are created, or tables regenerated,
+     * for it to take effect.
+     *
+     * @param rPath  absolute path to the cache directory, which must exist
+     */
+    static void SetCacheDirectory(const std::string& rPath);
+
+    /**
+     * @return the lookup table cache directory, or an empty string if tables aren't cached.
+     */
+    static const std::string& rGetCacheDirectory();
+
     /**
      * A little event handler with one event, to time table generation.
      */
@@ -138,6 +160,40 @@ protected:
      */
     unsigned GetTableIndex(const std::string& rKeyingVariableName) const;
 
+    /**
+     * Get memory for the lookup tables keyed by a given variable.  If tables with the current
+     * settings are in the cache, they will be mapped into memory and don't need generating;
+     * otherwise new memory is allocated for the subclass to fill in, after which it should
+     * call SaveTablesToCache().
+     *
+     * @return the memory for the tables, as a row-major tableSize by #mNumberOfTables array
+     *
+     * @param keyIndex  the index of the keying variable
+     * @param tableSize  the number of entries in each table
+     * @param rLoadedFromCache  will be set to whether the tables were found in the cache
+     */
+    double* AllocateTables(unsigned keyIndex, unsigned tableSize, bool& rLoadedFromCache);
+
+    /**
+     * Write newly generated tables to the cache, if one is in use.
+     *
+     * @param keyIndex  the index of the keying variable
+     */
+    void SaveTablesToCache(unsigned keyIndex);
+
+    /**
+     * Free (or unmap) the memory obtained from AllocateTables().
+     *
+     * @param keyIndex  the index of the keying variable
+     */
+    void FreeTables(unsigned keyIndex);
+
+    /**
+     * Identifies the generated lookup table code, for naming cache files.  Set by subclasses;
+     * if left empty the tables are never cached.
+     */
+    std::string mCacheKey;
+
     /** Names of variables used to index lookup tables */
     std::vector<std::string> mKeyingVariableNames;
 
@@ -161,6 +217,26 @@ protected:
 
     /** Timestep to use in lookup tables */
     double mDt;
+
+private:
+    /**
+     * @return the cache file name for the current settings of the tables keyed by a given variable.
+     *
+     * @param keyIndex  the index of the keying variable
+     */
+    std::string GetCacheFilePath(unsigned keyIndex) const;
+
+    /** Memory obtained from AllocateTables() for each keying variable, or NULL. */
+    std::vector<double*> mTableMemory;
+
+    /** Number of doubles in each entry of #mTableMemory. */
+    std::vector<unsigned> mTableMemorySize;
+
+    /** Whether each entry of #mTableMemory is mapped from a cache file (rather than allocated). */
+    std::vector<bool> mTableMemoryIsMapped;
+
+    /** The lookup table cache directory, if any. */
+    static std::string msCacheDirectory;
 };
 
 #endif // ABSTRACTLOOKUPTABLECOLLECTION_HPP_
@@ -36,11 +36,15 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CellMLToSharedLibraryConverter.hpp"
 
 #include <sstream>
+#include <fstream>
+#include <iomanip>
 #include <sys/stat.h> // For mkdir()
 #include <ctime>
+#include <cstdio> // For std::rename()
 #include <cstring> // For strerror()
 #include <cerrno> // For errno
 
+#include <boost/cstdint.hpp>
 #include <boost/foreach.hpp>
 
 #include "ChasteSyscalls.hpp"
@@ -50,6 +54,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscTools.hpp"
 #include "DynamicModelLoaderRegistry.hpp"
 #include "GetCurrentWorkingDirectory.hpp"
+#include "Version.hpp"
+
+#ifndef _MSC_VER
+#include <fcntl.h> // For fcntl() file locking
+#endif // _MSC_VER
 
 #define IGNORE_EXCEPTIONS(code) \
     try {                       \
@@ -67,6 +76,36 @@ const std::string CellMLToSharedLibraryConverter::msSoSuffix = "dylib";
 const std::string CellMLToSharedLibraryConverter::msSoSuffix = "so";
 #endif
 
+std::string CellMLToSharedLibraryConverter::msCacheDirectory = "";
+
+/**
+ * Add some bytes to a 64-bit FNV-1a hash.
+ *
+ * @param rHash  the hash so far
+ * @param pData  the bytes to add
+ * @param size  how many bytes there are
+ */
+static void AddToHash(boost::uint64_t& rHash, const char* pData, std::size_t size)
+{
+    for (std::size_t i=0; i<size; i++)
+    {
+        rHash ^= static_cast<unsigned char>(pData[i]);
+        rHash *= UINT64_C(1099511628211);
+    }
+}
+
+/**
+ * Add a string, followed by a terminator so that consecutive strings can't run together,
+ * to a 64-bit FNV-1a hash.
+ *
+ * @param rHash  the hash so far
+ * @param rString  the string to add
+ */
+static void AddToHash(boost::uint64_t& rHash, const std::string& rString)
+{
+    AddToHash(rHash, rString.c_str(), rString.size()+1);
+}
+
 CellMLToSharedLibraryConverter::CellMLToSharedLibraryConverter(bool preserveGeneratedSources,
                                                                std::string component)
     : mPreserveGeneratedSources(preserveGeneratedSources),
@@ -113,7 +152,31 @@ DynamicCellModelLoaderPtr CellMLToSharedLibraryConverter::Convert(const FileFind
         std::string so_path = folder + "lib" + leaf + msSoSuffix;
         // Does the .so file already exist (and was it modified after the .cellml?)
         FileFinder so_file(so_path, RelativeTo::Absolute);
-        if (!so_file.Exists() || rFilePath.IsNewerThan(so_file))
+        if (!msCacheDirectory.empty())
+        {
+            // Use the cached .so if there is one, otherwise convert and populate the cache
+            FileFinder cached_so = GetCachedSoPath(file_path_copy);
+            bool need_conversion = !cached_so.IsFile();
+            if (isCollective)
+            {
+                // Make sure all processes agree, in case the cache was populated while we looked
+                need_conversion = PetscTools::ReplicateBool(need_conversion);
+            }
+            if (need_conversion)
+            {
+                if (!isCollective)
+                {
+                    EXCEPTION("Unable to convert .cellml to .so unless called collectively, due to possible race conditions.");
+                }
+                ConvertCellmlToCachedSo(absolute_path, folder, cached_so);
+            }
+            // If the cache couldn't be populated, fall back to the .so alongside the .cellml
+            if (cached_so.IsFile())
+            {
+                so_file = cached_so;
+            }
+        }
+        else if (!so_file.Exists() || rFilePath.IsNewerThan(so_file))
         {
             if (!isCollective)
             {
@@ -240,6 +303,146 @@ void CellMLToSharedLibraryConverter::ConvertCellmlToSo(const std::string& rCellm
     PetscTools::ReplicateException(false);
 }
 
+FileFinder CellMLToSharedLibraryConverter::GetCachedSoPath(const FileFinder& rCellmlFile) const
+{
+    boost::uint64_t hash = UINT64_C(14695981039346656037);
+
+    // The .cellml file and anything else the conversion would pick up alongside it (e.g. -conf.xml),
+    // but not what previous conversions have produced
+    std::string leaf_name = rCellmlFile.GetLeafNameNoExtension();
+    std::vector<FileFinder> cellml_files = rCellmlFile.GetParent().FindMatches(leaf_name + "*");
+    BOOST_FOREACH(const FileFinder& r_file, cellml_files)
+    {
+        std::string extension = r_file.GetExtension();
+        if (!r_file.IsFile() || extension == ".cpp" || extension == ".hpp" || extension == "." + msSoSuffix)
+        {
+            continue;
+        }
+        AddToHash(hash, r_file.GetLeafName());
+        std::ifstream file(r_file.GetAbsolutePath().c_str(), std::ios::binary);
+        char buffer[4096];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        {
+            AddToHash(hash, buffer, file.gcount());
+        }
+    }
+
+    // How the model would be built
+    AddToHash(hash, mComponentName);
+    AddToHash(hash, ChasteBuildType());
+    AddToHash(hash, ChasteBuildInfo::GetVersionString());
+    AddToHash(hash, ChasteBuildInfo::GetCompilerType());
+    AddToHash(hash, ChasteBuildInfo::GetCompilerVersion());
+    AddToHash(hash, ChasteBuildInfo::GetCompilerFlags());
+
+    std::stringstream cached_path;
+    cached_path << msCacheDirectory << "/lib" << leaf_name << "_"
+                << std::hex << std::setw(16) << std::setfill('0') << hash << "." << msSoSuffix;
+    return FileFinder(cached_path.str(), RelativeTo::Absolute);
+}
+
+void CellMLToSharedLibraryConverter::ConvertCellmlToCachedSo(const std::string& rCellmlFullPath,
+                                                             const std::string& rCellmlFolder,
+                                                             const FileFinder& rCachedSo)
+{
+    const std::string cached_path = rCachedSo.GetAbsolutePath();
+    const std::string lock_path = cached_path.substr(0, cached_path.size() - msSoSuffix.size()) + "lock";
+
+    // Only the master takes the lock, so other simulations sharing the cache wait for ours to convert
+    int lock_fd = -1;
+    if (PetscTools::AmMaster())
+    {
+#ifndef _MSC_VER
+        lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT, 0666);
+        if (lock_fd != -1)
+        {
+            struct flock lock;
+            memset(&lock, 0, sizeof(lock));
+            lock.l_type = F_WRLCK;
+            lock.l_whence = SEEK_SET;
+            if (fcntl(lock_fd, F_SETLKW, &lock) == -1)
+            {
+                // No locking available, so just risk converting twice
+                close(lock_fd);
+                lock_fd = -1;
+            }
+        }
+#endif // _MSC_VER
+    }
+    // Did someone else convert the model while we waited?
+    bool need_conversion = PetscTools::ReplicateBool(PetscTools::AmMaster() && !rCachedSo.IsFile());
+
+    try
+    {
+        if (need_conversion)
+        {
+            ConvertCellmlToSo(rCellmlFullPath, rCellmlFolder);
+
+            if (PetscTools::AmMaster())
+            {
+                /*
+                 * Copy to a file unique to this process, then rename it into place.  The rename is atomic,
+                 * so other simulations will only ever see a complete library.
+                 */
+                std::string leaf = rCellmlFullPath.substr(rCellmlFolder.size());
+                std::string so_path = rCellmlFolder + "lib" + leaf.substr(0, leaf.find_last_of(".") + 1) + msSoSuffix;
+                std::stringstream temp_path;
+                temp_path << cached_path << ".tmp";
+#ifndef _MSC_VER
+                char host_name[256];
+                if (gethostname(host_name, sizeof(host_name)) == 0)
+                {
+                    host_name[sizeof(host_name)-1] = '\0';
+                    temp_path << "." << host_name;
+                }
+#endif // _MSC_VER
+                temp_path << "." << getpid();
+
+                bool written;
+                {
+                    std::ifstream source(so_path.c_str(), std::ios::binary);
+                    std::ofstream dest(temp_path.str().c_str(), std::ios::binary);
+                    written = source.good() && (dest << source.rdbuf());
+                    dest.close();
+                    written = written && dest.good();
+                }
+                // The cache is an optimisation, so failing to populate it isn't an error
+                if (!written || std::rename(temp_path.str().c_str(), cached_path.c_str()) != 0)
+                {
+                    std::remove(temp_path.str().c_str());
+                }
+            }
+        }
+    }
+    catch (const Exception&)
+    {
+#ifndef _MSC_VER
+        if (lock_fd != -1)
+        {
+            close(lock_fd); // Also releases the lock
+        }
+#endif // _MSC_VER
+        throw;
+    }
+#ifndef _MSC_VER
+    if (lock_fd != -1)
+    {
+        close(lock_fd); // Also releases the lock
+    }
+#endif // _MSC_VER
+    PetscTools::Barrier("CellMLToSharedLibraryConverter::ConvertCellmlToCachedSo");
+}
+
+void CellMLToSharedLibraryConverter::SetCacheDirectory(const std::string& rPath)
+{
+    msCacheDirectory = rPath;
+}
+
+const std::string& CellMLToSharedLibraryConverter::rGetCacheDirectory()
+{
+    return msCacheDirectory;
+}
+
 void CellMLToSharedLibraryConverter::CreateOptionsFile(const OutputFileHandler& rHandler,
                                                        const std::string& rModelName,
                                                        const std::vector<std::string>& rArgs,
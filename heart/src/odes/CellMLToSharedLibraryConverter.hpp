@@ -93,7 +93,52 @@ public:
                                   const std::vector<std::string>& rArgs,
                                   const std::string& rExtraXml="");
 
+    /**
+     * Set a directory in which to cache compiled cell models, or an empty string (the default)
+     * for no caching.
+     *
+     * A model is cached under a hash of the .cellml file and the other files used in its
+     * conversion (such as a PyCml options file), the component it is built in, and the
+     * Chaste version, build type and compiler settings.  A .cellml file whose model is in
+     * the cache is loaded straight from there, without running scons, wherever the file is.
+     * Otherwise the model is converted as usual and the result added to the cache.
+     *
+     * The cache is safe to share between many simulations at once: a lock file ensures only
+     * one of them converts any given model, and the others wait and then use its result.
+     *
+     * @param rPath  absolute path to the cache directory, which must exist
+     */
+    static void SetCacheDirectory(const std::string& rPath);
+
+    /**
+     * @return the compiled cell model cache directory, or an empty string if models aren't cached.
+     */
+    static const std::string& rGetCacheDirectory();
+
 private:
+    /**
+     * Work out where the given .cellml file's loadable module would be in the cache.
+     *
+     * @return the path of the cached module (which need not exist)
+     * @param rCellmlFile  the .cellml file
+     */
+    FileFinder GetCachedSoPath(const FileFinder& rCellmlFile) const;
+
+    /**
+     * Convert a .cellml file to a .so, as ConvertCellmlToSo(), and add the .so to the cache.
+     * Only one process (in any simulation) converts a given model at a time, and the
+     * conversion is skipped if another got there first.
+     *
+     * @note Must be called collectively.
+     *
+     * @param rCellmlFullPath  full path to the .cellml file
+     * @param rCellmlFolder  folder containing the CellML file, with trailing slash
+     * @param rCachedSo  where the .so should go in the cache (see GetCachedSoPath())
+     */
+    void ConvertCellmlToCachedSo(const std::string& rCellmlFullPath,
+                                 const std::string& rCellmlFolder,
+                                 const FileFinder& rCachedSo);
+
     /**
      * Helper method performing the actual conversion of a .cellml file to a .so.
      *
@@ -113,6 +158,9 @@ private:
 
     /** The .so suffix is nearly always "so" (as you might expect).  On Mac OSX this is redefined to "dylib" */
     static const std::string msSoSuffix;
+
+    /** The compiled cell model cache directory, if any. */
+    static std::string msCacheDirectory;
 };
 
 #endif /*CELLMLTOSHAREDLIBRARYCONVERTER_HPP_*/
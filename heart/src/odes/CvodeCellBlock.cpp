@@ -0,0 +1,404 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef CHASTE_CVODE
+
+#include "CvodeCellBlock.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <typeinfo>
+
+#include "CvodeAdaptor.hpp" // For CvodeErrorHandler
+#include "HeartConfig.hpp"
+#include "MathsCustomFunctions.hpp" // For tolerance comparison
+
+// CVODE headers
+#include <cvode/cvode.h>
+#include <cvode/cvode_band.h>
+
+/**
+ * Callback function provided to CVODE to evaluate the derivatives of a whole CvodeCellBlock.
+ *
+ * @param t  current time
+ * @param y  state variable vector
+ * @param ydot  derivatives vector to be filled in
+ * @param pData  pointer to the block being simulated
+ * @return 0 on success, or -1 if a cell threw
+ */
+int CvodeCellBlockRhsAdaptor(realtype t, N_Vector y, N_Vector ydot, void* pData)
+{
+    assert(pData != NULL);
+    CvodeCellBlock* p_block = (CvodeCellBlock*) pData;
+    try
+    {
+        p_block->EvaluateYDerivatives(t, y, ydot);
+    }
+    catch (const Exception&)
+    {
+        // The block will fall back to solving the cells individually, which reports the problem properly
+        return -1;
+    }
+    return 0;
+}
+
+#if CHASTE_SUNDIALS_VERSION >= 20400
+/**
+ * Callback function provided to CVODE to assemble the banded Jacobian of a CvodeCellBlock
+ * from the cells' analytic Jacobians.
+ *
+ * @param N  size of the system
+ * @param mupper  upper half-bandwidth
+ * @param mlower  lower half-bandwidth
+ * @param t  current time
+ * @param y  state variable vector
+ * @param ydot  derivatives at y
+ * @param jacobian  band matrix to fill in
+ * @param pData  pointer to the block being simulated
+ * @param tmp1  working memory (unused)
+ * @param tmp2  working memory (unused)
+ * @param tmp3  working memory (unused)
+ * @return 0 on success, or -1 if a cell threw
+ */
+#if CHASTE_SUNDIALS_VERSION >= 20500
+int CvodeCellBlockJacAdaptor(long int N, long int mupper, long int mlower,
+#else
+int CvodeCellBlockJacAdaptor(int N, int mupper, int mlower,
+#endif
+                             realtype t, N_Vector y, N_Vector ydot, DlsMat jacobian,
+                             void* pData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+    assert(pData != NULL);
+    CvodeCellBlock* p_block = (CvodeCellBlock*) pData;
+    try
+    {
+        p_block->EvaluateAnalyticJacobian(t, y, ydot, jacobian);
+    }
+    catch (const Exception&)
+    {
+        return -1;
+    }
+    return 0;
+}
+#endif // CHASTE_SUNDIALS_VERSION >= 20400
+
+CvodeCellBlock::CvodeCellBlock(const std::vector<AbstractCvodeCell*>& rCells)
+    : AbstractCardiacCellBlock(),
+      mCells(rCells),
+      mpCvodeMem(NULL),
+      mCellJacobian(NULL),
+      mLastSolutionTime(0.0),
+      mResetNeeded(true),
+      mNumIndividualFallbacks(0u)
+{
+    assert(!mCells.empty());
+    mNumberOfStateVariables = mCells[0]->GetNumberOfStateVariables();
+    mUseAnalyticJacobian = mCells[0]->GetUseAnalyticJacobian();
+#if CHASTE_SUNDIALS_VERSION < 20400
+    // We can only supply a banded Jacobian function with the newer interface
+    mUseAnalyticJacobian = false;
+#endif
+    for (unsigned c=1; c<mCells.size(); c++)
+    {
+        assert(IsSameModel(mCells[0], mCells[c]));
+    }
+
+    mStateVariables = N_VNew_Serial(mNumberOfStateVariables*mCells.size());
+    mCellStateView = N_VMake_Serial(mNumberOfStateVariables, NV_DATA_S(mStateVariables));
+    mCellDerivativesView = N_VMake_Serial(mNumberOfStateVariables, NV_DATA_S(mStateVariables));
+    if (mUseAnalyticJacobian)
+    {
+#if CHASTE_SUNDIALS_VERSION >= 20400
+        for (unsigned i=0; i<3; i++)
+        {
+            mCellWorkVectors.push_back(N_VNew_Serial(mNumberOfStateVariables));
+        }
+        mCellJacobian = NewDenseMat(mNumberOfStateVariables, mNumberOfStateVariables);
+#endif
+    }
+}
+
+CvodeCellBlock::~CvodeCellBlock()
+{
+    FreeCvodeMemory();
+#if CHASTE_SUNDIALS_VERSION >= 20400
+    if (mCellJacobian)
+    {
+        DestroyMat(mCellJacobian);
+    }
+#endif
+    for (unsigned i=0; i<mCellWorkVectors.size(); i++)
+    {
+        N_VDestroy_Serial(mCellWorkVectors[i]);
+    }
+    N_VDestroy_Serial(mCellDerivativesView);
+    N_VDestroy_Serial(mCellStateView);
+    N_VDestroy_Serial(mStateVariables);
+}
+
+AbstractCvodeCell* CvodeCellBlock::CanBeBlocked(AbstractCardiacCellInterface* pCell)
+{
+    AbstractCvodeCell* p_cell = dynamic_cast<AbstractCvodeCell*>(pCell);
+    if (p_cell == NULL || p_cell->GetNumberOfStateVariables() == 0)
+    {
+        return NULL;
+    }
+    return p_cell;
+}
+
+bool CvodeCellBlock::IsSameModel(AbstractCvodeCell* pCell, AbstractCvodeCell* pOtherCell)
+{
+    return (typeid(*pCell) == typeid(*pOtherCell)
+            && pCell->GetNumberOfStateVariables() == pOtherCell->GetNumberOfStateVariables()
+            && pCell->GetVoltageIndex() == pOtherCell->GetVoltageIndex()
+            && pCell->GetTimestep() == pOtherCell->GetTimestep()
+            && pCell->GetRelativeTolerance() == pOtherCell->GetRelativeTolerance()
+            && pCell->GetAbsoluteTolerance() == pOtherCell->GetAbsoluteTolerance()
+            && pCell->GetMaxSteps() == pOtherCell->GetMaxSteps()
+            && pCell->GetUseAnalyticJacobian() == pOtherCell->GetUseAnalyticJacobian());
+}
+
+unsigned CvodeCellBlock::GetNumCells() const
+{
+    return mCells.size();
+}
+
+unsigned CvodeCellBlock::GetNumIndividualFallbacks() const
+{
+    return mNumIndividualFallbacks;
+}
+
+void CvodeCellBlock::ResetSolver()
+{
+    mResetNeeded = true;
+}
+
+void CvodeCellBlock::LoadStateFromCells()
+{
+    realtype* p_block_state = NV_DATA_S(mStateVariables);
+    for (unsigned c=0; c<mCells.size(); c++)
+    {
+        const realtype* p_cell_state = NV_DATA_S(mCells[c]->rGetStateVariables());
+        std::copy(p_cell_state, p_cell_state + mNumberOfStateVariables, p_block_state + c*mNumberOfStateVariables);
+    }
+}
+
+void CvodeCellBlock::StoreStateToCells()
+{
+    const realtype* p_block_state = NV_DATA_S(mStateVariables);
+    for (unsigned c=0; c<mCells.size(); c++)
+    {
+        realtype* p_cell_state = NV_DATA_S(mCells[c]->rGetStateVariables());
+        std::copy(p_block_state + c*mNumberOfStateVariables, p_block_state + (c+1)*mNumberOfStateVariables, p_cell_state);
+    }
+}
+
+void CvodeCellBlock::EvaluateYDerivatives(double time, N_Vector y, N_Vector ydot)
+{
+    for (unsigned c=0; c<mCells.size(); c++)
+    {
+        NV_DATA_S(mCellStateView) = NV_DATA_S(y) + c*mNumberOfStateVariables;
+        NV_DATA_S(mCellDerivativesView) = NV_DATA_S(ydot) + c*mNumberOfStateVariables;
+        mCells[c]->EvaluateYDerivatives(time, mCellStateView, mCellDerivativesView);
+    }
+}
+
+#if CHASTE_SUNDIALS_VERSION >= 20400
+void CvodeCellBlock::EvaluateAnalyticJacobian(double time, N_Vector y, N_Vector ydot, DlsMat jacobian)
+{
+    assert(mCellJacobian != NULL);
+    for (unsigned c=0; c<mCells.size(); c++)
+    {
+        NV_DATA_S(mCellStateView) = NV_DATA_S(y) + c*mNumberOfStateVariables;
+        NV_DATA_S(mCellDerivativesView) = NV_DATA_S(ydot) + c*mNumberOfStateVariables;
+        SetToZero(mCellJacobian);
+        mCells[c]->EvaluateAnalyticJacobian(mNumberOfStateVariables, time, mCellStateView, mCellDerivativesView,
+                                            mCellJacobian, mCellWorkVectors[0], mCellWorkVectors[1], mCellWorkVectors[2]);
+
+        const unsigned offset = c*mNumberOfStateVariables;
+        for (unsigned j=0; j<mNumberOfStateVariables; j++)
+        {
+            for (unsigned i=0; i<mNumberOfStateVariables; i++)
+            {
+                BAND_ELEM(jacobian, offset+i, offset+j) = DENSE_ELEM(mCellJacobian, i, j);
+            }
+        }
+    }
+}
+#endif // CHASTE_SUNDIALS_VERSION >= 20400
+
+void CvodeCellBlock::SetupCvode(double tStart, double maxDt)
+{
+    const bool reinit = mResetNeeded || !CompareDoubles::WithinAnyTolerance(tStart, mLastSolutionTime);
+
+    // Scale the tolerances so the block's error norm bounds that of every cell (see class documentation)
+    const double scaling = 1.0/sqrt((double) mCells.size());
+    double rel_tol = scaling*mCells[0]->GetRelativeTolerance();
+    double abs_tol = scaling*mCells[0]->GetAbsoluteTolerance();
+
+    if (!mpCvodeMem)
+    {
+        mpCvodeMem = CVodeCreate(CV_BDF, CV_NEWTON);
+        if (mpCvodeMem == NULL) EXCEPTION("Failed to SetupCvode CVODE"); // in one line to avoid coverage problem!
+
+        CVodeSetErrHandlerFn(mpCvodeMem, CvodeErrorHandler, NULL);
+#if CHASTE_SUNDIALS_VERSION >= 20400
+        CVodeSetUserData(mpCvodeMem, (void*)(this));
+        CVodeInit(mpCvodeMem, CvodeCellBlockRhsAdaptor, tStart, mStateVariables);
+        CVodeSStolerances(mpCvodeMem, rel_tol, abs_tol);
+#else
+        CVodeSetFdata(mpCvodeMem, (void*)(this));
+        CVodeMalloc(mpCvodeMem, CvodeCellBlockRhsAdaptor, tStart, mStateVariables,
+                    CV_SS, rel_tol, &abs_tol);
+#endif
+        // The Jacobian is block diagonal, so fits in a band of half-width one less than the block size
+        const long int half_bandwidth = mNumberOfStateVariables - 1;
+        CVBand(mpCvodeMem, NV_LENGTH_S(mStateVariables), half_bandwidth, half_bandwidth);
+#if CHASTE_SUNDIALS_VERSION >= 20400
+        if (mUseAnalyticJacobian)
+        {
+            CVDlsSetBandJacFn(mpCvodeMem, CvodeCellBlockJacAdaptor);
+        }
+#endif
+    }
+    else if (reinit)
+    {
+#if CHASTE_SUNDIALS_VERSION >= 20400
+        CVodeReInit(mpCvodeMem, tStart, mStateVariables);
+        CVodeSStolerances(mpCvodeMem, rel_tol, abs_tol);
+#else
+        CVodeReInit(mpCvodeMem, CvodeCellBlockRhsAdaptor, tStart, mStateVariables,
+                    CV_SS, rel_tol, &abs_tol);
+#endif
+    }
+    mResetNeeded = false;
+
+    CVodeSetMaxStep(mpCvodeMem, maxDt);
+    long int max_steps = mCells[0]->GetMaxSteps();
+    if (max_steps > 0)
+    {
+        CVodeSetMaxNumSteps(mpCvodeMem, max_steps);
+        CVodeSetMaxErrTestFails(mpCvodeMem, 15);
+    }
+}
+
+void CvodeCellBlock::FreeCvodeMemory()
+{
+    if (mpCvodeMem)
+    {
+        CVodeFree(&mpCvodeMem);
+    }
+    mpCvodeMem = NULL;
+    mResetNeeded = true;
+}
+
+void CvodeCellBlock::ComputeExceptVoltage(double tStart, double tEnd)
+{
+    assert(tEnd >= tStart);
+    mFailedCellIndex = UNSIGNED_UNSET;
+    const unsigned num_cells = mCells.size();
+
+    double max_dt = mCells[0]->GetTimestep();
+    if (max_dt == DOUBLE_UNSET)
+    {
+        // As in AbstractCvodeCell::SolveAndUpdateState
+        max_dt = HeartConfig::Instance()->GetPrintingTimeStep();
+    }
+
+    LoadStateFromCells();
+    SetupCvode(tStart, max_dt);
+
+    std::vector<double> saved_voltages(num_cells);
+    for (unsigned c=0; c<num_cells; c++)
+    {
+        saved_voltages[c] = mCells[c]->GetVoltage();
+        // Note that this also resets the cell's own solver, which we don't use
+        mCells[c]->SetVoltageDerivativeToZero(true);
+    }
+    int ierr = CVodeSetStopTime(mpCvodeMem, tEnd);
+    assert(ierr == CV_SUCCESS); UNUSED_OPT(ierr); // avoid unused var warning
+    double cvode_stopped_at;
+    ierr = CVode(mpCvodeMem, tEnd, mStateVariables, &cvode_stopped_at, CV_NORMAL);
+
+    for (unsigned c=0; c<num_cells; c++)
+    {
+        mCells[c]->SetVoltageDerivativeToZero(false);
+    }
+
+    if (ierr < 0)
+    {
+        // The cells still hold their state at tStart, so solve them one at a time to find the culprit
+        FreeCvodeMemory();
+        mNumIndividualFallbacks++;
+        for (unsigned c=0; c<num_cells; c++)
+        {
+            try
+            {
+                mCells[c]->SetVoltage(saved_voltages[c]);
+                mCells[c]->ComputeExceptVoltage(tStart, tEnd);
+            }
+            catch (Exception&)
+            {
+                mFailedCellIndex = c;
+                throw;
+            }
+        }
+        return;
+    }
+    // Not root finding, so should have reached requested time
+    assert(fabs(cvode_stopped_at - tEnd) < DBL_EPSILON);
+    mLastSolutionTime = cvode_stopped_at;
+
+    StoreStateToCells();
+    for (unsigned c=0; c<num_cells; c++)
+    {
+        mCells[c]->SetVoltage(saved_voltages[c]); // In case of naughty models
+#ifndef NDEBUG
+        try
+        {
+            mCells[c]->VerifyStateVariables();
+        }
+        catch (Exception&)
+        {
+            mFailedCellIndex = c;
+            throw;
+        }
+#endif // NDEBUG
+    }
+}
+
+#endif // CHASTE_CVODE
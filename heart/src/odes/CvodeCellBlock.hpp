@@ -0,0 +1,209 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef CHASTE_CVODE
+#ifndef CVODECELLBLOCK_HPP_
+#define CVODECELLBLOCK_HPP_
+
+#include <vector>
+
+#include "AbstractCardiacCellBlock.hpp"
+#include "AbstractCvodeCell.hpp"
+
+/**
+ * A block of CVODE cells of the same model which are integrated together as a single
+ * block-diagonal ODE system.
+ *
+ * Rather than each cell having its own CVODE memory, state vector and dense Jacobian,
+ * the block owns one of each.  The state of cell c occupies entries [c*n, (c+1)*n) of
+ * the block's state vector, where n is the number of state variables of the model, so
+ * the Jacobian is block diagonal and is stored and factorised by CVODE's banded linear
+ * solver with bandwidth n-1.  This means a single CVodeReInit() and a single linear
+ * solver setup per block, rather than per cell.  If the cells have an analytic Jacobian
+ * it is assembled block by block from the cells' own EvaluateAnalyticJacobian()
+ * (Sundials 2.4 and later); otherwise CVODE uses difference quotients.
+ *
+ * All the cells share CVODE's step size and error test.  The tolerances given to CVODE
+ * are those of the cells scaled by 1/sqrt(number of cells), so that the weighted RMS norm
+ * of the error over the block bounds the norm for every individual cell: each cell is
+ * solved at least as accurately as it would be on its own.  The price is that a cell
+ * which needs short steps (e.g. during an upstroke) imposes them on the whole block, so
+ * blocks should be small and made of cells which are close together.
+ *
+ * As for a cell set up by AbstractCardiacCellFactory, CVODE is only re-initialised when
+ * the block is asked to solve from a different time from where the last solve finished,
+ * or after ResetSolver().  If CVODE fails for the block, the cells are solved one by one
+ * with their own solvers instead, so that any failure can be attributed to a cell.
+ */
+class CvodeCellBlock : public AbstractCardiacCellBlock
+{
+private:
+    /** The cells in this block.  Not owned by the block. */
+    std::vector<AbstractCvodeCell*> mCells;
+
+    /** Number of state variables in each cell of the block. */
+    unsigned mNumberOfStateVariables;
+
+    /** Whether the cells' analytic Jacobians are used. */
+    bool mUseAnalyticJacobian;
+
+    /** CVODE's internal data for the whole block. */
+    void* mpCvodeMem;
+
+    /** State variables of all the cells, with cell c's stored contiguously from c*#mNumberOfStateVariables. */
+    N_Vector mStateVariables;
+
+    /** View (not owning its data) of one cell's state, pointed into a block vector as needed. */
+    N_Vector mCellStateView;
+
+    /** View (not owning its data) of one cell's derivatives, pointed into a block vector as needed. */
+    N_Vector mCellDerivativesView;
+
+    /** Working memory for evaluating a cell's analytic Jacobian. */
+    std::vector<N_Vector> mCellWorkVectors;
+
+    /** Working memory for a cell's dense analytic Jacobian, if used. */
+    CHASTE_CVODE_DENSE_MATRIX mCellJacobian;
+
+    /** Where the last successful solve finished, so we know whether to re-initialise CVODE. */
+    double mLastSolutionTime;
+
+    /** Whether CVODE must be re-initialised before the next solve. */
+    bool mResetNeeded;
+
+    /** Number of times CVODE has failed for the block, so that the cells were solved individually. */
+    unsigned mNumIndividualFallbacks;
+
+    /** Copy the state of the cells into #mStateVariables. */
+    void LoadStateFromCells();
+
+    /** Copy #mStateVariables back into the cells. */
+    void StoreStateToCells();
+
+    /**
+     * Create or re-initialise CVODE as needed to solve from the given time.
+     *
+     * @param tStart  start time of the solve
+     * @param maxDt  maximum time step to take
+     */
+    void SetupCvode(double tStart, double maxDt);
+
+    /** Free CVODE's memory for the block. */
+    void FreeCvodeMemory();
+
+public:
+    /**
+     * Create a block from some cells.  The cells must all be the same model, with the
+     * same solver settings.  Use CanBeBlocked() and IsSameModel() to check this first.
+     *
+     * @param rCells  the cells to put in the block
+     */
+    CvodeCellBlock(const std::vector<AbstractCvodeCell*>& rCells);
+
+    /** Destructor frees the CVODE memory and vectors. */
+    ~CvodeCellBlock();
+
+    /**
+     * @return the cell as an AbstractCvodeCell if it may be put in a block, i.e. it is
+     * a CVODE cell with state variables; NULL otherwise.
+     *
+     * @param pCell  the cell to check
+     */
+    static AbstractCvodeCell* CanBeBlocked(AbstractCardiacCellInterface* pCell);
+
+    /**
+     * @return whether two cells (which can be blocked) may share a block: they must be the
+     * same model, with the same maximum time step, tolerances, maximum number of steps and
+     * choice of Jacobian.
+     *
+     * @param pCell  a cell
+     * @param pOtherCell  another cell
+     */
+    static bool IsSameModel(AbstractCvodeCell* pCell, AbstractCvodeCell* pOtherCell);
+
+    /** @return the number of cells in this block. */
+    unsigned GetNumCells() const;
+
+    /**
+     * @return the number of times CVODE failed for the whole block, so the cells were
+     * solved individually instead.
+     */
+    unsigned GetNumIndividualFallbacks() const;
+
+    /**
+     * Force CVODE to be re-initialised from the cells' state on the next solve, e.g.
+     * after the cells' parameters or state have been changed.
+     */
+    void ResetSolver();
+
+    /**
+     * Simulate the cells between the time interval [tStart, tEnd], without updating
+     * their voltages, which should have been set on each cell beforehand.
+     *
+     * This gives the same results, within the solver tolerances, as calling
+     * AbstractCvodeCell::ComputeExceptVoltage on each cell.  If a cell fails, the cells
+     * which were solved individually after it are left at their state at tStart.
+     *
+     * @param tStart  beginning of the time interval to simulate
+     * @param tEnd  end of the time interval to simulate
+     */
+    void ComputeExceptVoltage(double tStart, double tEnd);
+
+    /**
+     * Evaluate the derivatives of every cell in the block.  Called by CVODE.
+     *
+     * @param time  the current time
+     * @param y  the state variables of the block
+     * @param ydot  to be filled in with the derivatives
+     */
+    void EvaluateYDerivatives(double time, N_Vector y, N_Vector ydot);
+
+#if CHASTE_SUNDIALS_VERSION >= 20400
+    /**
+     * Fill in the block-diagonal Jacobian, stored as a band matrix, from the cells'
+     * analytic Jacobians.  Called by CVODE.
+     *
+     * @param time  the current time
+     * @param y  the state variables of the block
+     * @param ydot  the derivatives of the block at y
+     * @param jacobian  the band matrix to fill in, which CVODE has zeroed
+     */
+    void EvaluateAnalyticJacobian(double time, N_Vector y, N_Vector ydot, DlsMat jacobian);
+#endif
+};
+
+#endif // CVODECELLBLOCK_HPP_
+#endif // CHASTE_CVODE
@@ -214,7 +214,9 @@ void AbstractCardiacProblem<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::Initialise()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
 void AbstractCardiacProblem<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::CreateMeshFromHeartConfig()
 {
-    mpMesh = new DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>(HeartConfig::Instance()->GetMeshPartitioning());
+    DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* p_mesh = new DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>(HeartConfig::Instance()->GetMeshPartitioning());
+    p_mesh->SetReorderForLocality(HeartConfig::Instance()->GetReorderMeshForLocality());
+    mpMesh = p_mesh;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
@@ -833,7 +835,9 @@ bool AbstractCardiacProblem<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::InitialiseWriter
                                   HeartConfig::Instance()->GetOutputDirectory(),
                                   HeartConfig::Instance()->GetOutputFilenamePrefix(),
                                   !extend_file, // don't clear directory if extension requested
-                                  extend_file);
+                                  extend_file,
+                                  "Data",
+                                  HeartConfig::Instance()->GetUseHdf5DataWriterCache());
 
 
     // Define columns, or get the variable IDs from the writer
@@ -852,6 +856,12 @@ bool AbstractCardiacProblem<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::InitialiseWriter
 
     if (!extend_file)
     {
+        // Optionally store the results compressed, and/or in single precision
+        if (HeartConfig::Instance()->GetHdf5DataCompression() > 0u)
+        {
+            mpWriter->SetCompression(HeartConfig::Instance()->GetHdf5DataCompression());
+        }
+        mpWriter->SetUseSinglePrecision(HeartConfig::Instance()->GetUseSinglePrecisionHdf5Data());
         mpWriter->EndDefineMode();
     }
 
@@ -114,7 +114,8 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Load(const FileFinder&
 
 
 template<class PROBLEM_CLASS>
-PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinder& rDirectory)
+PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinder& rDirectory,
+                                                                  const std::vector<unsigned>& rNodeWeights)
 {
     // Check the directory exists
     std::string dir_path = rDirectory.GetAbsolutePath();
@@ -140,7 +141,9 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinde
     // and make it get the original DistributedVectorFactory from the archive so we can compare against
     // num_procs.
     DistributedVectorFactory::SetCheckNumberOfProcessesOnLoad(false);
-    // Put what follows in a try-catch to make sure we reset this
+    // Any node weights give the ownership of the loaded factory, and hence the mesh partition
+    DistributedVectorFactory::SetOwnershipWeightsOnLoad(rNodeWeights);
+    // Put what follows in a try-catch to make sure we reset these
     try
     {
         // Figure out which process-specific archive to load first.  If we're loading on the same number of
@@ -175,11 +178,13 @@ PROBLEM_CLASS* CardiacSimulationArchiver<PROBLEM_CLASS>::Migrate(const FileFinde
     catch (Exception &e)
     {
         DistributedVectorFactory::SetCheckNumberOfProcessesOnLoad(true);
+        DistributedVectorFactory::SetOwnershipWeightsOnLoad(std::vector<unsigned>());
         throw e;
     }
 
     // Done.
     DistributedVectorFactory::SetCheckNumberOfProcessesOnLoad(true);
+    DistributedVectorFactory::SetOwnershipWeightsOnLoad(std::vector<unsigned>());
     return p_unarchived_simulation;
 }
 
@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define CARDIACSIMULATIONARCHIVER_HPP_
 
 #include <string>
+#include <vector>
 
 #include "FileFinder.hpp"
 
@@ -104,12 +105,23 @@ public:
      *
      * Uses a dumb partition to work out how to distribute the mesh and cells over
      * the processes.  If we are loading on the same number of processes as the
-     * simulation was saved on, it uses exactly the same distribution as before.
+     * simulation was saved on, it uses exactly the same distribution as before,
+     * unless node weights are given.
+     *
+     * Node weights (e.g. from AbstractCardiacTissue::GetNodeWeightsFromCellCosts() in the
+     * saved simulation, called with originalNodeOrdering false) make the dumb partition
+     * give each process a contiguous block of nodes with roughly equal total weight, and
+     * the cells are moved to their new owners.
+     * This allows a simulation to be rebalanced after a warm-up period by checkpointing it
+     * and loading it again.
      *
      * @param rDirectory directory where the multiple files defining the checkpoint are located
+     * @param rNodeWeights the weight of each node, indexed by global node index in the saved
+     *     simulation, or an empty vector for an even partition
      * @return a pointer to the migrated cardiac problem class
      */
-    static PROBLEM_CLASS* Migrate(const FileFinder& rDirectory);
+    static PROBLEM_CLASS* Migrate(const FileFinder& rDirectory,
+                                  const std::vector<unsigned>& rNodeWeights=std::vector<unsigned>());
 };
 
 #endif /*CARDIACSIMULATIONARCHIVER_HPP_*/
@@ -216,8 +216,20 @@ HeartConfig* HeartConfig::Instance()
 HeartConfig::HeartConfig()
     : mUseMassLumping(false),
       mUseMassLumpingForPrecond(false),
+      mUsePrecomputedNeumannTerms(false),
+      mUseHdf5DataWriterCache(false),
+      mHdf5DataCompression(0u),
+      mUseSinglePrecisionHdf5Data(false),
+      mUseCrankNicolsonOperatorSplitting(false),
+      mMergeOperatorSplittingOdeHalfSteps(false),
+      mSkipQuiescentCells(false),
+      mQuiescentCellVoltageTolerance(0.1),
+      mQuiescentCellDerivativeTolerance(1e-5),
+      mReorderMeshForLocality(false),
       mUseFixedNumberIterations(false),
-      mEvaluateNumItsEveryNSolves(UINT_MAX)
+      mEvaluateNumItsEveryNSolves(UINT_MAX),
+      mBidomainInitialGuess(BidomainInitialGuessType::PREVIOUS_SOLUTION),
+      mBidomainInitialGuessHistoryLength(3u)
 {
     assert(mpInstance.get() == NULL);
     mUseFixedSchemaLocation = true;
@@ -2901,6 +2913,50 @@ bool HeartConfig::GetUseMassLumpingForPrecond()
     return mUseMassLumpingForPrecond;
 }
 
+void HeartConfig::SetUsePrecomputedNeumannTerms(bool usePrecomputedNeumannTerms)
+{
+    mUsePrecomputedNeumannTerms = usePrecomputedNeumannTerms;
+}
+
+bool HeartConfig::GetUsePrecomputedNeumannTerms()
+{
+    return mUsePrecomputedNeumannTerms;
+}
+
+void HeartConfig::SetUseHdf5DataWriterCache(bool useCache)
+{
+    mUseHdf5DataWriterCache = useCache;
+}
+
+bool HeartConfig::GetUseHdf5DataWriterCache()
+{
+    return mUseHdf5DataWriterCache;
+}
+
+void HeartConfig::SetHdf5DataCompression(unsigned deflateLevel)
+{
+    if (deflateLevel > 9u)
+    {
+        EXCEPTION("The HDF5 compression level must be between 0 and 9.");
+    }
+    mHdf5DataCompression = deflateLevel;
+}
+
+unsigned HeartConfig::GetHdf5DataCompression()
+{
+    return mHdf5DataCompression;
+}
+
+void HeartConfig::SetUseSinglePrecisionHdf5Data(bool useSinglePrecision)
+{
+    mUseSinglePrecisionHdf5Data = useSinglePrecision;
+}
+
+bool HeartConfig::GetUseSinglePrecisionHdf5Data()
+{
+    return mUseSinglePrecisionHdf5Data;
+}
+
 void HeartConfig::SetUseReactionDiffusionOperatorSplitting(bool useOperatorSplitting)
 {
     mUseReactionDiffusionOperatorSplitting = useOperatorSplitting;
@@ -2911,6 +2967,66 @@ bool HeartConfig::GetUseReactionDiffusionOperatorSplitting()
     return mUseReactionDiffusionOperatorSplitting;
 }
 
+void HeartConfig::SetUseCrankNicolsonOperatorSplitting(bool useCrankNicolson)
+{
+    mUseCrankNicolsonOperatorSplitting = useCrankNicolson;
+}
+
+bool HeartConfig::GetUseCrankNicolsonOperatorSplitting()
+{
+    return mUseCrankNicolsonOperatorSplitting;
+}
+
+void HeartConfig::SetMergeOperatorSplittingOdeHalfSteps(bool mergeHalfSteps)
+{
+    mMergeOperatorSplittingOdeHalfSteps = mergeHalfSteps;
+}
+
+bool HeartConfig::GetMergeOperatorSplittingOdeHalfSteps()
+{
+    return mMergeOperatorSplittingOdeHalfSteps;
+}
+
+void HeartConfig::SetSkipQuiescentCells(bool skipQuiescentCells, double voltageTolerance, double derivativeTolerance)
+{
+    if (voltageTolerance < 0.0 || derivativeTolerance < 0.0)
+    {
+        EXCEPTION("The tolerances for skipping quiescent cells must be non-negative.");
+    }
+    mSkipQuiescentCells = skipQuiescentCells;
+    mQuiescentCellVoltageTolerance = voltageTolerance;
+    mQuiescentCellDerivativeTolerance = derivativeTolerance;
+}
+
+bool HeartConfig::GetSkipQuiescentCells()
+{
+    return mSkipQuiescentCells;
+}
+
+double HeartConfig::GetQuiescentCellVoltageTolerance()
+{
+    return mQuiescentCellVoltageTolerance;
+}
+
+double HeartConfig::GetQuiescentCellDerivativeTolerance()
+{
+    return mQuiescentCellDerivativeTolerance;
+}
+
+void HeartConfig::SetReorderMeshForLocality(bool reorderForLocality)
+{
+    mReorderMeshForLocality = reorderForLocality;
+    if (reorderForLocality)
+    {
+        SetOutputUsingOriginalNodeOrdering(true);
+    }
+}
+
+bool HeartConfig::GetReorderMeshForLocality() const
+{
+    return mReorderMeshForLocality;
+}
+
 void HeartConfig::SetUseFixedNumberIterationsLinearSolver(bool useFixedNumberIterations, unsigned evaluateNumItsEveryNSolves)
 {
     mUseFixedNumberIterations = useFixedNumberIterations;
@@ -2927,6 +3043,26 @@ unsigned HeartConfig::GetEvaluateNumItsEveryNSolves()
     return mEvaluateNumItsEveryNSolves;
 }
 
+void HeartConfig::SetBidomainInitialGuess(BidomainInitialGuessType::type guessType, unsigned historyLength)
+{
+    if (historyLength == 0u)
+    {
+        EXCEPTION("The bidomain initial guess must use at least one previous solution.");
+    }
+    mBidomainInitialGuess = guessType;
+    mBidomainInitialGuessHistoryLength = historyLength;
+}
+
+BidomainInitialGuessType::type HeartConfig::GetBidomainInitialGuess() const
+{
+    return mBidomainInitialGuess;
+}
+
+unsigned HeartConfig::GetBidomainInitialGuessHistoryLength() const
+{
+    return mBidomainInitialGuessHistoryLength;
+}
+
 //
 // Purkinje methods
 //
@@ -53,6 +53,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ChasteCuboid.hpp"
 #include "ChasteEllipsoid.hpp"
 #include "DistributedTetrahedralMeshPartitionType.hpp"
+#include "BidomainInitialGuessType.hpp"
 #include "PetscTools.hpp"
 #include "FileFinder.hpp"
 
@@ -555,6 +556,12 @@ public:
 
     DistributedTetrahedralMeshPartitionType::type GetMeshPartitioning() const; /**< @return the mesh partitioning method to use */
 
+    /**
+     * @return whether meshes created from the configuration are reordered for locality within
+     * each partition (see SetReorderMeshForLocality()).
+     */
+    bool GetReorderMeshForLocality() const;
+
     // Adaptivity
     /**
      * Adaptivity is now deprecated.  This method now gives a warning before returning true.
@@ -699,12 +706,66 @@ public:
      */
     bool GetUseMassLumpingForPrecond();
 
+    /**
+     * @return whether the cardiac solvers assemble the Neumann boundary condition terms
+     * once and re-use them (see SetUsePrecomputedNeumannTerms()).
+     */
+    bool GetUsePrecomputedNeumannTerms();
+
+    /**
+     * @return whether the results file writer keeps several time steps of output in memory
+     * and writes them together (see SetUseHdf5DataWriterCache()).
+     */
+    bool GetUseHdf5DataWriterCache();
+
+    /**
+     * @return the gzip compression level for the HDF5 results file, 0 meaning no compression
+     * (see SetHdf5DataCompression()).
+     */
+    unsigned GetHdf5DataCompression();
+
+    /**
+     * @return whether the HDF5 results file stores single precision values (see
+     * SetUseSinglePrecisionHdf5Data()).
+     */
+    bool GetUseSinglePrecisionHdf5Data();
+
     /**
      *  @return whether to use Strang operator splitting of the reaction and diffusion terms (see
      *  Set method documentation).
      */
     bool GetUseReactionDiffusionOperatorSplitting();
 
+    /**
+     * @return whether the diffusion step of operator splitting uses Crank-Nicolson (see
+     * SetUseCrankNicolsonOperatorSplitting()).
+     */
+    bool GetUseCrankNicolsonOperatorSplitting();
+
+    /**
+     * @return whether operator splitting merges consecutive half-step ODE solves (see
+     * SetMergeOperatorSplittingOdeHalfSteps()).
+     */
+    bool GetMergeOperatorSplittingOdeHalfSteps();
+
+    /**
+     * @return whether the tissue skips the ODE solve for quiescent cells (see
+     * SetSkipQuiescentCells()).
+     */
+    bool GetSkipQuiescentCells();
+
+    /**
+     * @return the largest change in voltage (mV) since its last solve for which a quiescent
+     * cell is still skipped (see SetSkipQuiescentCells()).
+     */
+    double GetQuiescentCellVoltageTolerance();
+
+    /**
+     * @return the largest rate of change of any state variable (per ms) for which a cell is
+     * considered quiescent (see SetSkipQuiescentCells()).
+     */
+    double GetQuiescentCellDerivativeTolerance();
+
     /**
      *  @return whether to use a fixed number of iterations in the linear solver
      */
@@ -715,6 +776,16 @@ public:
      */
     unsigned GetEvaluateNumItsEveryNSolves();
 
+    /**
+     *  @return how the initial guess for each bidomain linear solve is chosen (see SetBidomainInitialGuess()).
+     */
+    BidomainInitialGuessType::type GetBidomainInitialGuess() const;
+
+    /**
+     *  @return how many previous solutions the bidomain initial guess is built from.
+     */
+    unsigned GetBidomainInitialGuessHistoryLength() const;
+
 
     ///////////////////////////////////////////////////////////////
     //
@@ -1010,6 +1081,17 @@ public:
      */
     void SetMeshPartitioning(const char* meshPartioningMethod);
 
+    /**
+     * Set whether meshes created from the configuration should renumber the nodes owned by each
+     * process along a space-filling curve, for better cache use in assembly and linear solves
+     * (see DistributedTetrahedralMesh::SetReorderForLocality()).  Turning reordering on also
+     * calls SetOutputUsingOriginalNodeOrdering(), so that results are still written in the
+     * original node order; turning it off leaves the output ordering as it is.
+     *
+     * @param reorderForLocality  whether to reorder the mesh for locality
+     */
+    void SetReorderMeshForLocality(bool reorderForLocality = true);
+
     /** Set the parameters of the apd map requested
      *
      *  @param rApdMaps  each entry is a request for a map with
@@ -1127,6 +1209,55 @@ public:
      */
     void SetUseMassLumpingForPrecond(bool useMassLumping = true);
 
+    /**
+     * Set whether the cardiac solvers should assemble the surface integrals coming from Neumann
+     * boundary conditions once and add the stored vector to the right-hand side on each time step,
+     * rather than looping over the boundary elements every time step.  (The volume terms of the
+     * right-hand side are always computed as a product with the mass matrix.)
+     *
+     * Only use this if the Neumann boundary conditions are constant in time.  Switching between
+     * boundary conditions containers, as Electrodes do, is fine, but a StimulusBoundaryCondition
+     * is not.  Must be set before the problem is solved.
+     *
+     * @param usePrecomputedNeumannTerms Whether to do so
+     */
+    void SetUsePrecomputedNeumannTerms(bool usePrecomputedNeumannTerms = true);
+
+    /**
+     * Set whether the HDF5 results writer should keep the output for several time steps in
+     * memory, and write them to the file in one (collective) operation, rather than writing
+     * every printing time step as soon as it is computed.  This reduces the number of
+     * (synchronising) parallel writes, at the cost of up to about 64 MB of memory per process.
+     *
+     * The cache is written whenever it fills up, and whatever is left is written when the
+     * writer is closed, which happens at the end of each call to Solve() (or when Solve()
+     * throws).  A later call to Solve() re-opens the results file to extend it, and caches
+     * again from its first new time step, so each Solve() leaves a complete file behind it.
+     * Until they are written the most recent time steps are only held in memory, so are
+     * missing from the results file if the simulation is killed.
+     *
+     * @param useCache Whether to do so
+     */
+    void SetUseHdf5DataWriterCache(bool useCache = true);
+
+    /**
+     * Set whether to compress the HDF5 results file, and how hard to try.  The compression is
+     * lossless, and transparent to Hdf5DataReader and the converters.  In parallel this needs
+     * HDF5 1.10.2 or later (see Hdf5DataWriter::SetCompression()).  Files being extended when a
+     * simulation is resumed keep the settings they were created with.
+     *
+     * @param deflateLevel  the gzip compression level, from 1 (fastest) to 9 (smallest), or 0 for none
+     */
+    void SetHdf5DataCompression(unsigned deflateLevel);
+
+    /**
+     * Set whether to store the HDF5 results file in single precision, halving its size (see
+     * Hdf5DataWriter::SetUseSinglePrecision()).
+     *
+     * @param useSinglePrecision Whether to do so
+     */
+    void SetUseSinglePrecisionHdf5Data(bool useSinglePrecision = true);
+
     /**
      * Use Strang operator splitting of the diffusion (conductivity) term and the reaction (ionic current) term,
      * instead of solving the full reaction-diffusion PDE. This does NOT refer to operator splitting of the
@@ -1137,6 +1268,44 @@ public:
      */
     void SetUseReactionDiffusionOperatorSplitting(bool useOperatorSplitting = true);
 
+    /**
+     * Set whether the diffusion step of reaction-diffusion operator splitting (see
+     * SetUseReactionDiffusionOperatorSplitting()) uses Crank-Nicolson rather than backward
+     * Euler.  With backward Euler the diffusion step is first order in time, which limits the
+     * whole Strang splitting to first order; Crank-Nicolson makes it second order, so larger
+     * PDE time steps can be taken for the same accuracy.
+     *
+     * @param useCrankNicolson Whether to use Crank-Nicolson (defaults to true).
+     */
+    void SetUseCrankNicolsonOperatorSplitting(bool useCrankNicolson = true);
+
+    /**
+     * Set whether reaction-diffusion operator splitting (see
+     * SetUseReactionDiffusionOperatorSplitting()) solves the second half-step of the cell
+     * models at one PDE time step together with the first half-step at the next.  This halves
+     * the number of cell model solves, and lets the cells take steps of up to a whole PDE time
+     * step, while giving the same splitting.  The half-steps are only kept separate at the end
+     * of each printing time step, when the voltage must be up to date.
+     *
+     * @param mergeHalfSteps Whether to merge the half-steps (defaults to true).
+     */
+    void SetMergeOperatorSplittingOdeHalfSteps(bool mergeHalfSteps = true);
+
+    /**
+     * Set whether the tissue should skip the ODE solve for cells at rest.  A cell is quiescent
+     * after a solve in which none of its state variables changed faster than
+     * derivativeTolerance and it had no stimulus.  Its state is then frozen, and it is not
+     * solved again until its voltage moves by more than voltageTolerance from the value at its
+     * last solve, or it is stimulated.  This trades a little accuracy for speed in simulations
+     * where most of the tissue is at rest most of the time (see
+     * AbstractCardiacTissue::SetSkipQuiescentCells()).
+     *
+     * @param skipQuiescentCells  whether to skip quiescent cells
+     * @param voltageTolerance  the change in voltage (mV) which re-activates a cell
+     * @param derivativeTolerance  the rate of change (per ms) below which a cell is quiescent
+     */
+    void SetSkipQuiescentCells(bool skipQuiescentCells = true, double voltageTolerance = 0.1, double derivativeTolerance = 1e-5);
+
     /**
      * Set the use of fixed number of iterations in the linear solver
      *
@@ -1145,6 +1314,18 @@ public:
      */
     void SetUseFixedNumberIterationsLinearSolver(bool useFixedNumberIterations = true, unsigned evaluateNumItsEveryNSolves=UINT_MAX);
 
+    /**
+     * Set how the initial guess for the linear solve of each bidomain time step is chosen.
+     * By default the solution at the start of the time step is used.  POLYNOMIAL_EXTRAPOLATION
+     * extrapolates the last historyLength solutions in time, and SUBSPACE_PROJECTION uses the
+     * combination of the last historyLength solutions which minimises the residual of the new
+     * system.  Both can cut the number of Krylov iterations as the wavefront moves steadily.
+     *
+     * @param guessType  the initial guess strategy
+     * @param historyLength  how many previous solutions to use (at least 1)
+     */
+    void SetBidomainInitialGuess(BidomainInitialGuessType::type guessType, unsigned historyLength=3u);
+
     /**
      * @return whether HeartConfig has a drug concentration and any IC50s set up
      */
@@ -1287,12 +1468,50 @@ private:
      */
     bool mUseMassLumpingForPrecond;
 
+    /**
+     * Flag telling whether the cardiac solvers should store the Neumann boundary condition terms.
+     */
+    bool mUsePrecomputedNeumannTerms;
+
+    /**
+     * Flag telling whether the HDF5 results writer should cache several time steps before writing them.
+     */
+    bool mUseHdf5DataWriterCache;
+
+    /**
+     * The gzip compression level for the HDF5 results file (0 for none).
+     */
+    unsigned mHdf5DataCompression;
+
+    /**
+     * Flag telling whether the HDF5 results file should be stored in single precision.
+     */
+    bool mUseSinglePrecisionHdf5Data;
+
     /**
      *  @return whether to use Strang operator splitting of the diffusion and reaction terms (see
      *  Set method documentation).
      */
     bool mUseReactionDiffusionOperatorSplitting;
 
+    /** Whether the diffusion step of operator splitting uses Crank-Nicolson. */
+    bool mUseCrankNicolsonOperatorSplitting;
+
+    /** Whether operator splitting merges consecutive half-step ODE solves. */
+    bool mMergeOperatorSplittingOdeHalfSteps;
+
+    /** Whether the tissue skips the ODE solve for quiescent cells. */
+    bool mSkipQuiescentCells;
+
+    /** The change in voltage (mV) which re-activates a quiescent cell. */
+    double mQuiescentCellVoltageTolerance;
+
+    /** The rate of change (per ms) of the state variables below which a cell is quiescent. */
+    double mQuiescentCellDerivativeTolerance;
+
+    /** Whether meshes created from the configuration are reordered for locality within each partition. */
+    bool mReorderMeshForLocality;
+
     /**
      *  Map defining bath conductivity for multiple bath regions
      */
@@ -1320,6 +1539,12 @@ private:
      */
     unsigned mEvaluateNumItsEveryNSolves;
 
+    /** How the initial guess for each bidomain linear solve is chosen. */
+    BidomainInitialGuessType::type mBidomainInitialGuess;
+
+    /** How many previous solutions the bidomain initial guess is built from. */
+    unsigned mBidomainInitialGuessHistoryLength;
+
     /**
      * CheckSimulationIsDefined is a convenience method for checking if the "<"Simulation">" element
      * has been defined and therefore is safe to use the Simulation().get() pointer to access
@@ -55,6 +55,16 @@ protected:
     /** Local cache of the configuration singleton pointer*/
     HeartConfig* mpConfig;
 
+    /**
+     * @return true unless the tissue has a conductivity modifier.  The cardiac assemblers
+     * only read the tissue's conductivity tensors, but a modifier may compute the modified
+     * tensor into its own storage, so cannot be used by several threads at once.
+     */
+    virtual bool CanAssembleElementsConcurrently()
+    {
+        return !mpCardiacTissue->HasConductivityModifier();
+    }
+
 public:
 
     /**
@@ -86,6 +86,14 @@ protected:
      */
     bool ElementAssemblyCriterion(Element<ELEM_DIM,SPACE_DIM>& rElement);
 
+    /**
+     * @return false, as the interpolated quantities are stored in this class.
+     */
+    bool CanAssembleElementsConcurrently()
+    {
+        return false;
+    }
+
 public:
 
     /**
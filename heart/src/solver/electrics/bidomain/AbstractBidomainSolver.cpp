@@ -38,6 +38,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TetrahedralMesh.hpp"
 #include "PetscMatTools.hpp"
 #include "PetscVecTools.hpp"
+#include "LogFile.hpp"
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/lu.hpp>
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::InitialiseForSolve(Vec initialSolution)
@@ -279,11 +282,20 @@ AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::AbstractBidomainSolver(
 
     mRowForAverageOfPhiZeroed = INT_MAX; //this->mpLinearSystem->GetSize() - 1;
     mpConfig = HeartConfig::Instance();
+
+    mInitialGuess = NULL;
+    mTotalNumKspIterations = 0u;
+    mNumLinearSolves = 0u;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::~AbstractBidomainSolver()
 {
+    ClearSolutionHistory();
+    if (mInitialGuess)
+    {
+        PetscTools::Destroy(mInitialGuess);
+    }
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -416,6 +428,184 @@ void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::FinaliseForBath(bool compute
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::GetTotalNumKspIterations() const
+{
+    return mTotalNumKspIterations;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::GetNumLinearSolves() const
+{
+    return mNumLinearSolves;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::ClearSolutionHistory()
+{
+    for (unsigned i=0; i<mSolutionHistory.size(); i++)
+    {
+        PetscTools::Destroy(mSolutionHistory[i]);
+    }
+    mSolutionHistory.clear();
+    mSolutionHistoryTimes.clear();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+Vec AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::GetInitialGuessForSolve(Vec currentSolution)
+{
+    BidomainInitialGuessType::type guess_type = mpConfig->GetBidomainInitialGuess();
+    if (guess_type == BidomainInitialGuessType::PREVIOUS_SOLUTION)
+    {
+        return currentSolution;
+    }
+
+    // The history is only of use if it ends with the solution we are stepping on from
+    // (it won't after the solver is restarted from a different time or initial condition)
+    if (!mSolutionHistory.empty() && fabs(mSolutionHistoryTimes.back() - PdeSimulationTime::GetTime()) > 1e-10)
+    {
+        ClearSolutionHistory();
+    }
+    if (mSolutionHistory.size() < 2u)
+    {
+        return currentSolution;
+    }
+
+    if (mInitialGuess == NULL)
+    {
+        VecDuplicate(currentSolution, &mInitialGuess);
+    }
+
+    if (guess_type == BidomainInitialGuessType::POLYNOMIAL_EXTRAPOLATION)
+    {
+        ExtrapolateSolutionHistory(PdeSimulationTime::GetNextTime());
+    }
+    else
+    {
+        assert(guess_type == BidomainInitialGuessType::SUBSPACE_PROJECTION);
+        if (!ProjectOntoSolutionHistory())
+        {
+            return currentSolution;
+        }
+    }
+    return mInitialGuess;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::ExtrapolateSolutionHistory(double time)
+{
+    unsigned num_solutions = mSolutionHistory.size();
+    std::vector<double> weights(num_solutions, 1.0);
+    for (unsigned j=0; j<num_solutions; j++)
+    {
+        for (unsigned m=0; m<num_solutions; m++)
+        {
+            if (m != j)
+            {
+                weights[j] *= (time - mSolutionHistoryTimes[m])/(mSolutionHistoryTimes[j] - mSolutionHistoryTimes[m]);
+            }
+        }
+    }
+
+    VecSet(mInitialGuess, 0.0);
+    VecMAXPY(mInitialGuess, num_solutions, &weights[0], &mSolutionHistory[0]);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::ProjectOntoSolutionHistory()
+{
+    // Orthonormalise the stored solutions by modified Gram-Schmidt, dropping any that
+    // are (nearly) linearly dependent on the others
+    std::vector<Vec> basis;
+    for (unsigned i=0; i<mSolutionHistory.size(); i++)
+    {
+        Vec direction;
+        VecDuplicate(mSolutionHistory[i], &direction);
+        VecCopy(mSolutionHistory[i], direction);
+        double original_norm;
+        VecNorm(direction, NORM_2, &original_norm);
+        for (unsigned j=0; j<basis.size(); j++)
+        {
+            double component;
+            VecDot(direction, basis[j], &component);
+            VecAXPY(direction, -component, basis[j]);
+        }
+        double norm;
+        VecNorm(direction, NORM_2, &norm);
+        if (norm > 1e-8*original_norm)
+        {
+            VecScale(direction, 1.0/norm);
+            basis.push_back(direction);
+        }
+        else
+        {
+            PetscTools::Destroy(direction);
+        }
+    }
+
+    // Minimise |A Q c - b| over the coefficients c via the normal equations
+    unsigned basis_size = basis.size();
+    std::vector<Vec> images(basis_size);
+    for (unsigned i=0; i<basis_size; i++)
+    {
+        VecDuplicate(basis[i], &images[i]);
+        MatMult(this->mpLinearSystem->rGetLhsMatrix(), basis[i], images[i]);
+    }
+    boost::numeric::ublas::matrix<double> gram(basis_size, basis_size);
+    boost::numeric::ublas::vector<double> coefficients(basis_size);
+    for (unsigned i=0; i<basis_size; i++)
+    {
+        for (unsigned j=0; j<=i; j++)
+        {
+            VecDot(images[i], images[j], &gram(i,j));
+            gram(j,i) = gram(i,j);
+        }
+        VecDot(images[i], this->mpLinearSystem->rGetRhsVector(), &coefficients(i));
+    }
+
+    boost::numeric::ublas::permutation_matrix<std::size_t> pivots(basis_size);
+    bool usable = (basis_size > 0u) && (boost::numeric::ublas::lu_factorize(gram, pivots) == 0u);
+    if (usable)
+    {
+        boost::numeric::ublas::lu_substitute(gram, pivots, coefficients);
+        VecSet(mInitialGuess, 0.0);
+        VecMAXPY(mInitialGuess, basis_size, &coefficients(0), &basis[0]);
+    }
+
+    for (unsigned i=0; i<basis_size; i++)
+    {
+        PetscTools::Destroy(basis[i]);
+        PetscTools::Destroy(images[i]);
+    }
+    return usable;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::FollowingSolveLinearSystem(Vec currentSolution)
+{
+    unsigned num_iterations = this->mpLinearSystem->GetNumIterations();
+    mTotalNumKspIterations += num_iterations;
+    mNumLinearSolves++;
+    LOG(2, "Bidomain linear solve " << mNumLinearSolves << " at time " << PdeSimulationTime::GetNextTime()
+            << " took " << num_iterations << " iterations");
+
+    if (mpConfig->GetBidomainInitialGuess() != BidomainInitialGuessType::PREVIOUS_SOLUTION)
+    {
+        Vec solution_copy;
+        VecDuplicate(currentSolution, &solution_copy);
+        VecCopy(currentSolution, solution_copy);
+        mSolutionHistory.push_back(solution_copy);
+        mSolutionHistoryTimes.push_back(PdeSimulationTime::GetNextTime());
+
+        while (mSolutionHistory.size() > mpConfig->GetBidomainInitialGuessHistoryLength())
+        {
+            PetscTools::Destroy(mSolutionHistory.front());
+            mSolutionHistory.erase(mSolutionHistory.begin());
+            mSolutionHistoryTimes.erase(mSolutionHistoryTimes.begin());
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////
 // explicit instantiation
 ///////////////////////////////////////////////////////
@@ -76,6 +76,62 @@ protected:
      */
     unsigned mRowForAverageOfPhiZeroed;
 
+    /**
+     * Copies of the most recent solutions (oldest first), kept when the initial guess is
+     * built from the solution history (see HeartConfig::SetBidomainInitialGuess()).
+     */
+    std::vector<Vec> mSolutionHistory;
+
+    /** The times of the solutions in #mSolutionHistory. */
+    std::vector<double> mSolutionHistoryTimes;
+
+    /** Storage for the initial guess built from the solution history (NULL until first needed). */
+    Vec mInitialGuess;
+
+    /** The total number of Krylov iterations taken by the linear solves so far. */
+    unsigned mTotalNumKspIterations;
+
+    /** The number of linear solves so far. */
+    unsigned mNumLinearSolves;
+
+    /**
+     * Destroy the stored solution history.
+     */
+    void ClearSolutionHistory();
+
+    /**
+     * Fill #mInitialGuess by extrapolating the Lagrange polynomial through the stored
+     * solutions to the given time.
+     *
+     * @param time  the time to extrapolate to
+     */
+    void ExtrapolateSolutionHistory(double time);
+
+    /**
+     * Fill #mInitialGuess with the combination of the stored solutions whose residual
+     * in the current linear system is smallest in the 2-norm.
+     *
+     * @return false if the stored solutions do not give a usable basis
+     */
+    bool ProjectOntoSolutionHistory();
+
+    /**
+     * Provide the initial guess for the linear solve, as chosen by
+     * HeartConfig::SetBidomainInitialGuess().
+     *
+     * @param currentSolution  the solution at the start of the time step
+     * @return the initial guess to pass to the linear solver
+     */
+    virtual Vec GetInitialGuessForSolve(Vec currentSolution);
+
+    /**
+     * Log the number of iterations the linear solve took and, if the initial guess
+     * uses the solution history, store the new solution.
+     *
+     * @param currentSolution  the solution of the linear system just solved
+     */
+    virtual void FollowingSolveLinearSystem(Vec currentSolution);
+
     /**
      * Create the linear system object if it hasn't been already.
      * Can use an initial solution as PETSc template, or base it on the mesh size.
@@ -186,6 +242,16 @@ public:
      */
      void SetRowForAverageOfPhiZeroed(unsigned rowMeanPhiEZero);
 
+    /**
+     * @return the total number of Krylov iterations taken by the linear solves of this solver
+     */
+    unsigned GetTotalNumKspIterations() const;
+
+    /**
+     * @return the number of linear solves performed by this solver
+     */
+    unsigned GetNumLinearSolves() const;
+
     /**
      *  @return the boundary conditions being used
      */
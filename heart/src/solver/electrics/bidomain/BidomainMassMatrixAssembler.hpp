@@ -90,6 +90,14 @@ protected:
             c_matrix<double,2,DIM> &rGradU /* not used */,
             Element<DIM,DIM>* pElement);
 
+    /**
+     * @return true, as ComputeMatrixTerm() only reads the state of this class.
+     */
+    bool CanAssembleElementsConcurrently()
+    {
+        return true;
+    }
+
 public:
 
     /**
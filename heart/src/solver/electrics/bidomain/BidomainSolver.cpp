@@ -222,6 +222,10 @@ BidomainSolver<ELEMENT_DIM,SPACE_DIM>::BidomainSolver(
 
 
     mpBidomainNeumannSurfaceTermAssembler = new BidomainNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM>(pMesh,pBoundaryConditions);
+    if (HeartConfig::Instance()->GetUsePrecomputedNeumannTerms())
+    {
+        mpBidomainNeumannSurfaceTermAssembler->SetPrecomputeSurfaceTerms(true);
+    }
 
     if(HeartConfig::Instance()->GetUseStateVariableInterpolation())
     {
@@ -207,6 +207,10 @@ ExtendedBidomainSolver<ELEMENT_DIM,SPACE_DIM>::ExtendedBidomainSolver(
     }
 
     mpExtendedBidomainNeumannSurfaceTermAssembler = new ExtendedBidomainNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM>(pMesh,pBoundaryConditions);
+    if (HeartConfig::Instance()->GetUsePrecomputedNeumannTerms())
+    {
+        mpExtendedBidomainNeumannSurfaceTermAssembler->SetPrecomputeSurfaceTerms(true);
+    }
 
 }
 
@@ -194,6 +194,10 @@ MonodomainSolver<ELEMENT_DIM,SPACE_DIM>::MonodomainSolver(
 
     mpMonodomainAssembler = new MonodomainAssembler<ELEMENT_DIM,SPACE_DIM>(this->mpMesh,this->mpMonodomainTissue);
     mpNeumannSurfaceTermsAssembler = new NaturalNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM,1>(pMesh,pBoundaryConditions);
+    if (HeartConfig::Instance()->GetUsePrecomputedNeumannTerms())
+    {
+        mpNeumannSurfaceTermsAssembler->SetPrecomputeSurfaceTerms(true);
+    }
 
 
     // Tell tissue there's no need to replicate ionic caches
@@ -34,6 +34,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "OperatorSplittingMonodomainSolver.hpp"
+#include "MonodomainStiffnessMatrixAssembler.hpp"
+#include "PetscVecTools.hpp"
 
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -56,6 +58,22 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem
 
         this->mpLinearSystem->FinaliseLhsMatrix();
         PetscMatTools::Finalise(mMassMatrix);
+
+        if (mUseCrankNicolson)
+        {
+            // The monodomain assembler gives Am*Cm/dt M + K, but Crank-Nicolson wants Am*Cm/dt M + K/2
+            MonodomainStiffnessMatrixAssembler<ELEMENT_DIM,SPACE_DIM> stiffness_matrix_assembler(this->mpMesh, mpMonodomainTissue);
+            stiffness_matrix_assembler.SetMatrixToAssemble(mStiffnessMatrix);
+            stiffness_matrix_assembler.Assemble();
+            PetscMatTools::Finalise(mStiffnessMatrix);
+
+#if (PETSC_VERSION_MAJOR == 2 && PETSC_VERSION_MINOR == 2) //PETSc 2.2
+            PetscScalar minus_half = -0.5;
+            MatAXPY(&minus_half, mStiffnessMatrix, this->mpLinearSystem->rGetLhsMatrix(), DIFFERENT_NONZERO_PATTERN);
+#else
+            MatAXPY(this->mpLinearSystem->rGetLhsMatrix(), -0.5, mStiffnessMatrix, DIFFERENT_NONZERO_PATTERN);
+#endif
+        }
     }
 
     HeartEventHandler::BeginEvent(HeartEventHandler::ASSEMBLE_RHS);
@@ -91,6 +109,13 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem
     //////////////////////////////////////////
     MatMult(mMassMatrix, mVecForConstructingRhs, this->mpLinearSystem->rGetRhsVector());
 
+    if (mUseCrankNicolson)
+    {
+        // b = Mz - K V/2, re-using z as workspace
+        MatMult(mStiffnessMatrix, currentSolution, mVecForConstructingRhs);
+        PetscVecTools::AddScaledVector(this->mpLinearSystem->rGetRhsVector(), mVecForConstructingRhs, -0.5);
+    }
+
     // assembling RHS is not finished yet, as Neumann bcs are added below, but
     // the event will be begun again inside mpMonodomainAssembler->AssembleVector();
     HeartEventHandler::EndEvent(HeartEventHandler::ASSEMBLE_RHS);
@@ -110,7 +135,15 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::PrepareForSetupLi
 {
     double time = PdeSimulationTime::GetTime();
     double dt = PdeSimulationTime::GetPdeTimeStep();
-    mpMonodomainTissue->SolveCellSystems(currentSolution, time, time+dt/2.0, true);
+
+    // Include the second half-step of the previous time step, if it was deferred
+    double ode_start_time = time;
+    if (mDeferredOdeStartTime != DOUBLE_UNSET)
+    {
+        ode_start_time = mDeferredOdeStartTime;
+        mDeferredOdeStartTime = DOUBLE_UNSET;
+    }
+    mpMonodomainTissue->SolveCellSystems(currentSolution, ode_start_time, time+dt/2.0, true);
 }
 
 
@@ -120,6 +153,15 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::FollowingSolveLin
     // solve cell models for second half timestep
     double time = PdeSimulationTime::GetTime();
     double dt = PdeSimulationTime::GetPdeTimeStep();
+
+    // The voltage must be up to date at the end of Solve(), and whenever the base class writes output
+    bool is_last_step = (PdeSimulationTime::GetNextTime() >= this->mTend);
+    bool writes_output = (this->mOutputToVtk || this->mOutputToParallelVtk || this->mOutputToTxt);
+    if (mMergeOdeHalfSteps && !is_last_step && !writes_output)
+    {
+        mDeferredOdeStartTime = time + dt/2;
+        return;
+    }
     mpMonodomainTissue->SolveCellSystems(currentSolution, time + dt/2, PdeSimulationTime::GetNextTime(), true);
 }
 
@@ -127,6 +169,9 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::FollowingSolveLin
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::InitialiseForSolve(Vec initialSolution)
 {
+    // Each Solve() call starts with the cells up to date with the initial condition
+    mDeferredOdeStartTime = DOUBLE_UNSET;
+
     if (this->mpLinearSystem != NULL)
     {
         return;
@@ -163,6 +208,12 @@ void OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::InitialiseForSolv
     PetscTools::SetupMat(mMassMatrix, this->mpMesh->GetNumNodes(), this->mpMesh->GetNumNodes(),
                          this->mpMesh->CalculateMaximumNodeConnectivityPerProcess(),
                          local_size, local_size);
+    if (mUseCrankNicolson)
+    {
+        PetscTools::SetupMat(mStiffnessMatrix, this->mpMesh->GetNumNodes(), this->mpMesh->GetNumNodes(),
+                             this->mpMesh->CalculateMaximumNodeConnectivityPerProcess(),
+                             local_size, local_size);
+    }
 }
 
 
@@ -174,7 +225,11 @@ OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::OperatorSplittingMonod
             BoundaryConditionsContainer<ELEMENT_DIM,SPACE_DIM,1>* pBoundaryConditions)
     : AbstractDynamicLinearPdeSolver<ELEMENT_DIM,SPACE_DIM,1>(pMesh),
       mpBoundaryConditions(pBoundaryConditions),
-      mpMonodomainTissue(pTissue)
+      mpMonodomainTissue(pTissue),
+      mUseCrankNicolson(HeartConfig::Instance()->GetUseCrankNicolsonOperatorSplitting()),
+      mStiffnessMatrix(NULL),
+      mMergeOdeHalfSteps(HeartConfig::Instance()->GetMergeOperatorSplittingOdeHalfSteps()),
+      mDeferredOdeStartTime(DOUBLE_UNSET)
 {
     assert(pTissue);
     assert(pBoundaryConditions);
@@ -182,6 +237,10 @@ OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::OperatorSplittingMonod
 
     mpMonodomainAssembler = new MonodomainAssembler<ELEMENT_DIM,SPACE_DIM>(this->mpMesh,this->mpMonodomainTissue);
     mpNeumannSurfaceTermsAssembler = new NaturalNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM,1>(pMesh,pBoundaryConditions);
+    if (HeartConfig::Instance()->GetUsePrecomputedNeumannTerms())
+    {
+        mpNeumannSurfaceTermsAssembler->SetPrecomputeSurfaceTerms(true);
+    }
 
     // Tell tissue there's no need to replicate ionic caches
     pTissue->SetCacheReplication(false);
@@ -198,6 +257,10 @@ OperatorSplittingMonodomainSolver<ELEMENT_DIM,SPACE_DIM>::~OperatorSplittingMono
     {
         PetscTools::Destroy(mVecForConstructingRhs);
         PetscTools::Destroy(mMassMatrix);
+        if (mUseCrankNicolson)
+        {
+            PetscTools::Destroy(mStiffnessMatrix);
+        }
     }
 }
 
@@ -58,15 +58,19 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  *  Notes
  *   (a)  Stages (iii) and (i) can normally be solved together in one go, except just before/after printing the voltage to file.
- *        However for simplicity of code this has not been implemented
+ *        This is done if HeartConfig::SetMergeOperatorSplittingOdeHalfSteps() has been called: stage (iii) is then
+ *        deferred to the next time step, unless this is the last time step of the Solve() call.
  *   (b)  Therefore, the effective ODE timestep will be:  min(ode_dt, pde_dt/2), where ode_dt and pde_dt are those
- *        given via HeartConfig.
+ *        given via HeartConfig, or min(ode_dt, pde_dt) between printing times if the half-steps are merged.
  *   (c)  This solver is FOR COMPARING ACCURACY, NOT PERFORMANCE. It has not been optimised and may or may not
  *        perform well in parallel.
  *   (d)  We don't implement the simpler form of operator splitting, Godunov splitting, where the ODEs are
  *        solved for one timestep and the PDEs are solved for one timestep, since this is formally equivalent
  *        to the default implementation where the ionic current is interpolated from the nodal values
  *        (ie ICI - see ICI/SVI discussion in documentation)
+ *   (e)  Stage (ii) uses backward Euler by default, which is only first order in time, so the splitting as a whole is
+ *        first order.  If HeartConfig::SetUseCrankNicolsonOperatorSplitting() has been called it uses Crank-Nicolson
+ *        instead, i.e. solves (Am*Cm/dt M + K/2) V^{n+1} = (Am*Cm/dt M - K/2) V^n, giving a second order scheme.
  */
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 class OperatorSplittingMonodomainSolver : public AbstractDynamicLinearPdeSolver<ELEMENT_DIM,SPACE_DIM,1>
@@ -97,6 +101,24 @@ private:
      */
     Vec mVecForConstructingRhs;
 
+    /** Whether the diffusion stage uses Crank-Nicolson rather than backward Euler (see note (e)). */
+    bool mUseCrankNicolson;
+
+    /**
+     *  The stiffness matrix K, without any mass matrix terms.  Only used (and set up) if
+     *  #mUseCrankNicolson is set, to compute the explicit half of the diffusion term.
+     */
+    Mat mStiffnessMatrix;
+
+    /** Whether to merge the second ODE half-step with the first half-step of the next time step (see note (a)). */
+    bool mMergeOdeHalfSteps;
+
+    /**
+     *  The start time of an ODE half-step which was deferred to be solved together with the next
+     *  time step's first half-step, or DOUBLE_UNSET if there is none.
+     */
+    double mDeferredOdeStartTime;
+
     /**
      *  Implementation of SetupLinearSystem() which uses the assembler to compute the
      *  LHS matrix, but sets up the RHS vector using the mass-matrix (constructed
@@ -114,7 +136,8 @@ private:
     void PrepareForSetupLinearSystem(Vec currentSolution);
 
     /**
-     *  Called after solving the linear system, used to solve the cell models for second half timestep (step (iii) above)
+     *  Called after solving the linear system, used to solve the cell models for second half timestep (step (iii) above),
+     *  or to defer this to the next time step if the half-steps are being merged.
      *  @param currentSolution the latest solution vector (ie the solution of the linear system).
      */
     void FollowingSolveLinearSystem(Vec currentSolution);
@@ -122,7 +145,7 @@ private:
 public:
 
     /** Overloaded InitialiseForSolve() which calls base version but also
-     *  initialises #mMassMatrix and #mVecForConstructingRhs.
+     *  initialises #mMassMatrix, #mVecForConstructingRhs and (if needed) #mStiffnessMatrix.
      *
      *  @param initialSolution  initial solution
      */
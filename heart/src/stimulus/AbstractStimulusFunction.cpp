@@ -35,6 +35,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractStimulusFunction.hpp"
 
+#include <cassert>
+
 #include "PetscTools.hpp"
 
 
@@ -42,6 +44,19 @@ AbstractStimulusFunction::~AbstractStimulusFunction()
 {
 }
 
+bool AbstractStimulusFunction::IsZeroBetween(double startTime, double endTime, double sampleInterval)
+{
+    assert(sampleInterval > 0.0);
+    for (double time=startTime; time<endTime; time+=sampleInterval)
+    {
+        if (GetStimulus(time) != 0.0)
+        {
+            return false;
+        }
+    }
+    return (GetStimulus(endTime) == 0.0);
+}
+
 void AbstractStimulusFunction::Clear()
 {
     //Needed in one or more derived classes
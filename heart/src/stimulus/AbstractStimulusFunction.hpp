@@ -73,6 +73,19 @@ public:
      */
     virtual double GetStimulus(double time) = 0;
 
+    /**
+     * @return whether the stimulus is zero at every time in the interval [startTime, endTime].
+     *
+     * This default implementation can only sample the stimulus, at startTime, endTime and every
+     * sampleInterval in between, so a pulse shorter than sampleInterval may be missed.  Subclasses
+     * that know the shape of their stimulus should override it to give an exact answer.
+     *
+     * @param startTime  the start of the interval
+     * @param endTime  the end of the interval
+     * @param sampleInterval  how often to sample the stimulus, e.g. the ODE time step
+     */
+    virtual bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
+
     /**
      * Destructor.
      */
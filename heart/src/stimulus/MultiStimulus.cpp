@@ -53,6 +53,18 @@ double MultiStimulus::GetStimulus(double time)
     return total_stimulus;
 }
 
+bool MultiStimulus::IsZeroBetween(double startTime, double endTime, double sampleInterval)
+{
+    for (unsigned stimulus_index = 0; stimulus_index < mStimuli.size(); ++stimulus_index)
+    {
+        if (!mStimuli[stimulus_index]->IsZeroBetween(startTime, endTime, sampleInterval))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 MultiStimulus::~MultiStimulus()
 {
     Clear();
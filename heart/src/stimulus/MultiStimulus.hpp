@@ -98,6 +98,15 @@ public:
      */
      virtual double GetStimulus(double time);
 
+     /**
+      * @return whether all the stimuli are zero throughout [startTime, endTime].
+      *
+      * @param startTime  the start of the interval
+      * @param endTime  the end of the interval
+      * @param sampleInterval  how often to sample any stimuli which can only be sampled
+      */
+     virtual bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
+
      /**
       * Clear is responsible for managing the memory of
       * delegated stimuli
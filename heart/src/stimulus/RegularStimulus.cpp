@@ -36,6 +36,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "RegularStimulus.hpp"
 #include <cmath>
+#include <algorithm>
 #include <cassert>
 
 #include <iostream>
@@ -80,6 +81,28 @@ double RegularStimulus::GetStimulus(double time)
     }
 }
 
+bool RegularStimulus::IsZeroBetween(double startTime, double endTime, double sampleInterval)
+{
+    if (mMagnitudeOfStimulus == 0.0)
+    {
+        return true;
+    }
+    // The part of the interval in which pulses may be applied
+    const double first_time = std::max(startTime, mStartTime);
+    const double last_time = std::min(endTime, mStopTime);
+    if (first_time > last_time)
+    {
+        return true;
+    }
+    // Either a pulse is on at first_time, or the next one must start after last_time
+    const double beat_time = fmod(first_time-mStartTime, mPeriod);
+    if (beat_time <= mDuration)
+    {
+        return false;
+    }
+    return (first_time + (mPeriod - beat_time) > last_time);
+}
+
 double RegularStimulus::GetPeriod()
 {
     return mPeriod;
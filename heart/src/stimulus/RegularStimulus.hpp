@@ -101,6 +101,16 @@ public:
      */
     double GetStimulus(double time);
 
+    /**
+     * @return whether the stimulus is zero throughout [startTime, endTime], i.e. whether
+     * the interval misses every pulse.
+     *
+     * @param startTime  the start of the interval
+     * @param endTime  the end of the interval
+     * @param sampleInterval  not used, since the answer is exact
+     */
+    bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
+
     /**
      * @return the pacing cycle length or period of the stimulus.
      */
@@ -63,6 +63,11 @@ double S1S2Stimulus::GetStimulus(double time)
     return this->mStimuli[mS2Index]->GetStimulus(time);
 }
 
+bool S1S2Stimulus::IsZeroBetween(double startTime, double endTime, double sampleInterval)
+{
+    return this->mStimuli[mS2Index]->IsZeroBetween(startTime, endTime, sampleInterval);
+}
+
 void S1S2Stimulus::SetS2ExperimentPeriodIndex(unsigned index)
 {
     if (index < mNumS2FrequencyValues)
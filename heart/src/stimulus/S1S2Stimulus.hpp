@@ -114,6 +114,15 @@ public:
      */
      double GetStimulus(double time);
 
+     /**
+      * @return whether the stimulus for the current S2 frequency is zero throughout [startTime, endTime].
+      *
+      * @param startTime  the start of the interval
+      * @param endTime  the end of the interval
+      * @param sampleInterval  passed on to the stimulus for the current S2 frequency
+      */
+     bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
+
      /**
       * Allows us to move to the 'next' S2 frequency.
       *
@@ -75,6 +75,13 @@ double SimpleStimulus::GetStimulus(double time)
     }
 }
 
+bool SimpleStimulus::IsZeroBetween(double startTime, double endTime, double sampleInterval)
+{
+    return (mMagnitudeOfStimulus == 0.0
+            || endTime < mTimeOfStimulus
+            || mTimeOfStimulus + mDuration < startTime);
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
@@ -101,6 +101,16 @@ public:
      * @param time  time at which to return the stimulus
      */
     double GetStimulus(double time);
+
+    /**
+     * @return whether the stimulus is zero throughout [startTime, endTime], i.e. whether
+     * the interval misses the pulse.
+     *
+     * @param startTime  the start of the interval
+     * @param endTime  the end of the interval
+     * @param sampleInterval  not used, since the answer is exact
+     */
+    bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
 };
 
 
@@ -67,6 +67,15 @@ public:
     virtual ~ZeroStimulus();
 
     double GetStimulus(double time);
+
+    /**
+     * @return true: this stimulus is always zero.
+     *
+     * @param startTime  the start of the interval
+     * @param endTime  the end of the interval
+     * @param sampleInterval  not used
+     */
+    bool IsZeroBetween(double startTime, double endTime, double sampleInterval);
 };
 
 #include "SerializationExportWrapper.hpp"
@@ -35,18 +35,23 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractCardiacTissue.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <boost/scoped_array.hpp>
 
 #include "DistributedVector.hpp"
 #include "AxisymmetricConductivityTensors.hpp"
 #include "OrthotropicConductivityTensors.hpp"
 #include "Exception.hpp"
+#include "FirstFailureCollector.hpp"
 #include "ChastePoint.hpp"
 #include "AbstractChasteRegion.hpp"
 #include "HeartEventHandler.hpp"
 #include "PetscTools.hpp"
 #include "PetscVecTools.hpp"
 #include "AbstractCvodeCell.hpp"
+#include "CvodeCellBlock.hpp"
+#include "Timer.hpp"
 #include "Warnings.hpp"
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
@@ -59,7 +64,13 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(
       mHasPurkinje(false),
       mDoCacheReplication(true),
       mMeshUnarchived(false),
-      mExchangeHalos(exchangeHalos)
+      mExchangeHalos(exchangeHalos),
+      mUseCellBlocks(false),
+      mSkipQuiescentCells(false),
+      mQuiescentVoltageTolerance(0.0),
+      mQuiescentDerivativeTolerance(0.0),
+      mNumQuiescentCheckSteps(0u),
+      mMeasureCellCosts(false)
 {
     //This constructor is called from the Initialise() method of the CardiacProblem class
     assert(pCellFactory != NULL);
@@ -154,13 +165,15 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(
     SetUpHaloCells(pCellFactory);
 
     HeartEventHandler::BeginEvent(HeartEventHandler::COMMUNICATION);
-    mIionicCacheReplicated.Resize( pCellFactory->GetNumberOfCells() );
-    mIntracellularStimulusCacheReplicated.Resize( pCellFactory->GetNumberOfCells() );
+    CalculateCacheHaloNodes();
+    InitialiseCache(mIionicCacheReplicated);
+    InitialiseCache(mIntracellularStimulusCacheReplicated);
 
     if (mHasPurkinje)
     {
-        mPurkinjeIionicCacheReplicated.Resize( pCellFactory->GetNumberOfCells() );
-        mPurkinjeIntracellularStimulusCacheReplicated.Resize( pCellFactory->GetNumberOfCells() );
+        // The Purkinje caches are never replicated (see ReplicateCaches())
+        InitialiseCache(mPurkinjeIionicCacheReplicated, false);
+        InitialiseCache(mPurkinjeIntracellularStimulusCacheReplicated, false);
     }
     HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
 
@@ -174,6 +187,10 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(
         mFibreFilePathNoExtension = "";
     }
     CreateIntracellularConductivityTensor();
+
+    SetSkipQuiescentCells(HeartConfig::Instance()->GetSkipQuiescentCells(),
+                          HeartConfig::Instance()->GetQuiescentCellVoltageTolerance(),
+                          HeartConfig::Instance()->GetQuiescentCellDerivativeTolerance());
 }
 
 // Constructor used for archiving
@@ -184,13 +201,24 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(AbstractTetr
       mHasPurkinje(false),
       mDoCacheReplication(true),
       mMeshUnarchived(true),
-      mExchangeHalos(false)
+      mExchangeHalos(false),
+      mUseCellBlocks(false),
+      mSkipQuiescentCells(false),
+      mQuiescentVoltageTolerance(0.0),
+      mQuiescentDerivativeTolerance(0.0),
+      mNumQuiescentCheckSteps(0u),
+      mMeasureCellCosts(false)
 {
-    mIionicCacheReplicated.Resize(mpDistributedVectorFactory->GetProblemSize());
-    mIntracellularStimulusCacheReplicated.Resize(mpDistributedVectorFactory->GetProblemSize());
+    CalculateCacheHaloNodes();
+    InitialiseCache(mIionicCacheReplicated);
+    InitialiseCache(mIntracellularStimulusCacheReplicated);
 
     mFibreFilePathNoExtension = ArchiveLocationInfo::GetArchiveDirectory() + ArchiveLocationInfo::GetMeshFilename();
     CreateIntracellularConductivityTensor();
+
+    SetSkipQuiescentCells(HeartConfig::Instance()->GetSkipQuiescentCells(),
+                          HeartConfig::Instance()->GetQuiescentCellVoltageTolerance(),
+                          HeartConfig::Instance()->GetQuiescentCellDerivativeTolerance());
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
@@ -360,6 +388,147 @@ bool AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetDoCacheReplication()
     return mDoCacheReplication;
 }
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetUseCellBlocks(bool useCellBlocks)
+{
+    mUseCellBlocks = useCellBlocks;
+    mCellBlocks.clear();
+    mCellBlockStarts.clear();
+    mCellIsInBlock.assign(mCellsDistributed.size(), false);
+    if (!mUseCellBlocks)
+    {
+        return;
+    }
+
+#ifdef CHASTE_CVODE
+    // CVODE cells in a block share a step size, so a cell which is firing slows the others down
+    const unsigned max_block_size = 32u;
+
+    unsigned local_index = 0;
+    while (local_index < mCellsDistributed.size())
+    {
+        unsigned run_length = 1u;
+
+        AbstractCvodeCell* p_first_cell = CvodeCellBlock::CanBeBlocked(mCellsDistributed[local_index]);
+        if (p_first_cell != NULL)
+        {
+            std::vector<AbstractCvodeCell*> block_cells(1u, p_first_cell);
+            while (block_cells.size() < max_block_size && local_index + block_cells.size() < mCellsDistributed.size())
+            {
+                AbstractCvodeCell* p_cell = CvodeCellBlock::CanBeBlocked(mCellsDistributed[local_index + block_cells.size()]);
+                if (p_cell == NULL || !CvodeCellBlock::IsSameModel(p_first_cell, p_cell))
+                {
+                    break;
+                }
+                block_cells.push_back(p_cell);
+            }
+            run_length = block_cells.size();
+            // A block of one cell would just add overhead
+            if (run_length > 1u)
+            {
+                mCellBlocks.push_back(boost::shared_ptr<AbstractCardiacCellBlock>(new CvodeCellBlock(block_cells)));
+                mCellBlockStarts.push_back(local_index);
+                for (unsigned i=0; i<run_length; i++)
+                {
+                    mCellIsInBlock[local_index + i] = true;
+                }
+            }
+        }
+        local_index += run_length;
+    }
+#endif // CHASTE_CVODE
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetSkipQuiescentCells(bool skipQuiescentCells,
+                                                                         double voltageTolerance,
+                                                                         double derivativeTolerance)
+{
+    mSkipQuiescentCells = skipQuiescentCells;
+    mQuiescentVoltageTolerance = voltageTolerance;
+    mQuiescentDerivativeTolerance = derivativeTolerance;
+    // The per-cell data are (re)created by SolveCellSystems(), since the archiving constructor has no cells yet
+    mQuiescentVoltages.clear();
+    mNumSkippedSolves.clear();
+    mNumQuiescentCheckSteps = 0u;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetQuiescentCellStatistics(std::map<unsigned, unsigned>& rNumCellSolves,
+                                                                              std::map<unsigned, unsigned>& rNumSkippedCellSolves)
+{
+    rNumCellSolves.clear();
+    rNumSkippedCellSolves.clear();
+    const unsigned index_low = mpDistributedVectorFactory->GetLow();
+    for (unsigned local_index=0; local_index<mNumSkippedSolves.size(); local_index++)
+    {
+        unsigned region = mpMesh->GetNode(index_low + local_index)->GetRegion();
+        rNumCellSolves[region] += mNumQuiescentCheckSteps;
+        rNumSkippedCellSolves[region] += mNumSkippedSolves[local_index];
+    }
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetMeasureCellCosts(bool measureCellCosts)
+{
+    mMeasureCellCosts = measureCellCosts;
+    if (mMeasureCellCosts)
+    {
+        mCellCosts.assign(mpDistributedVectorFactory->GetLocalOwnership(), 0.0);
+    }
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+std::vector<unsigned> AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetNodeWeightsFromCellCosts(unsigned maxWeight, bool originalNodeOrdering)
+{
+    assert(maxWeight > 0u);
+    if (mCellCosts.size() != mpDistributedVectorFactory->GetLocalOwnership())
+    {
+        // Costs were never measured on this process
+        mCellCosts.assign(mpDistributedVectorFactory->GetLocalOwnership(), 0.0);
+    }
+
+    Vec costs = mpDistributedVectorFactory->CreateVec();
+    DistributedVector dist_costs = mpDistributedVectorFactory->CreateDistributedVector(costs);
+    for (DistributedVector::Iterator index = dist_costs.Begin();
+         index != dist_costs.End();
+         ++index)
+    {
+        dist_costs[index] = mCellCosts[index.Local];
+    }
+    dist_costs.Restore();
+    ReplicatableVector costs_replicated(costs);
+    PetscTools::Destroy(costs);
+
+    double max_cost = 0.0;
+    for (unsigned i=0; i<costs_replicated.GetSize(); i++)
+    {
+        max_cost = std::max(max_cost, costs_replicated[i]);
+    }
+
+    std::vector<unsigned> weights(costs_replicated.GetSize(), 1u);
+    if (max_cost > 0.0)
+    {
+        for (unsigned i=0; i<weights.size(); i++)
+        {
+            unsigned weight = (unsigned) floor(maxWeight*costs_replicated[i]/max_cost + 0.5);
+            weights[i] = std::max(1u, weight);
+        }
+    }
+
+    const std::vector<unsigned>& r_permutation = mpMesh->rGetNodePermutation();
+    if (originalNodeOrdering && !r_permutation.empty())
+    {
+        // r_permutation[original_index] is the current index of that node
+        std::vector<unsigned> permuted_weights(weights);
+        for (unsigned original_index=0; original_index<weights.size(); original_index++)
+        {
+            weights[original_index] = permuted_weights[r_permutation[original_index]];
+        }
+    }
+    return weights;
+}
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 const c_matrix<double, SPACE_DIM, SPACE_DIM>& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularConductivityTensor(unsigned elementIndex)
 {
@@ -431,6 +600,40 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::CalculateHaloNodesFromNodeExc
 }
 
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::CalculateCacheHaloNodes()
+{
+    mCacheHaloNodes.clear();
+    if (PetscTools::IsSequential())
+    {
+        return;
+    }
+    if (mExchangeHalos)
+    {
+        mCacheHaloNodes = mHaloNodes;
+        return;
+    }
+
+    std::vector<std::vector<unsigned> > nodes_to_send_per_process;
+    std::vector<std::vector<unsigned> > nodes_to_receive_per_process;
+    mpMesh->CalculateNodeExchange(nodes_to_send_per_process, nodes_to_receive_per_process);
+    std::set<unsigned> halos_as_set;
+    for (unsigned proc=0; proc<PetscTools::GetNumProcs(); proc++)
+    {
+        halos_as_set.insert(nodes_to_receive_per_process[proc].begin(), nodes_to_receive_per_process[proc].end());
+    }
+    mCacheHaloNodes.assign(halos_as_set.begin(), halos_as_set.end());
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::InitialiseCache(GhostedVector& rCache, bool withHaloNodes)
+{
+    rCache.Resize(mpDistributedVectorFactory->GetLow(),
+                  mpDistributedVectorFactory->GetHigh(),
+                  mpDistributedVectorFactory->GetProblemSize(),
+                  withHaloNodes ? mCacheHaloNodes : std::vector<unsigned>());
+}
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetUpHaloCells(AbstractCardiacCellFactory<ELEMENT_DIM,SPACE_DIM>* pCellFactory)
 {
@@ -479,18 +682,90 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
     // Solve cell models (except purkinje cell models)
     /////////////////////////////////////////////////////////////
     DistributedVector::Stripe voltage(dist_solution, 0);
-    try
+    const unsigned index_low = mpDistributedVectorFactory->GetLow();
+    const int num_local_cells = (int) mpDistributedVectorFactory->GetLocalOwnership();
+
+    /*
+     * The cells owned by this process may be solved by several OpenMP threads (see
+     * the 'openmp' build option).  Exceptions must not escape a parallel region, so each
+     * thread records its failures and we only report them once all threads have finished.
+     * Of all the failures we keep the one at the lowest local index, and CVODE reset
+     * warnings are issued in node order, so the outcome is the same as a serial solve
+     * whatever the number of threads or the order in which they ran.
+     *
+     * Note that a thread is handed its chunks in increasing index order, so once a thread
+     * has had a failure it can skip the rest of its individual cells without changing which
+     * failure is reported.  Cell blocks are solved after all the individual cells.
+     */
+    const bool use_cell_blocks = mUseCellBlocks && !updateVoltage;
+    const int num_cell_blocks = (int) mCellBlocks.size();
+
+    /*
+     * Quiescent cells are not solved at all: their state is left as it was, which CVODE
+     * cells cope with since they re-initialise when asked to solve from a different time.
+     */
+    if (mSkipQuiescentCells)
     {
-        double voltage_before_update;
-        for (DistributedVector::Iterator index = dist_solution.Begin();
-             index != dist_solution.End();
-             ++index)
+        if (mQuiescentVoltages.size() != (unsigned) num_local_cells)
         {
-            voltage_before_update = voltage[index];
-            mCellsDistributed[index.Local]->SetVoltage( voltage_before_update );
+            mQuiescentVoltages.assign(num_local_cells, DOUBLE_UNSET);
+            mNumSkippedSolves.assign(num_local_cells, 0u);
+        }
+        mNumQuiescentCheckSteps++;
+    }
+    if (mMeasureCellCosts && mCellCosts.size() != (unsigned) num_local_cells)
+    {
+        mCellCosts.assign(num_local_cells, 0.0);
+    }
+    FirstFailureCollector failures;
+    std::vector<unsigned> cvode_reset_local_indices;
 
-            // Added a try-catch here to provide more output to screen when an error occurs.
-            /// \todo This may want to go to std::cerr ??
+#ifdef _OPENMP
+#pragma omp parallel
+#endif // _OPENMP
+    {
+        FirstFailureCollector thread_failures;
+        std::vector<unsigned> thread_cvode_resets;
+        // Reused for every cell on this thread, so that checking for quiescence doesn't allocate
+        std::vector<double> thread_state_before_solve;
+        std::vector<double> thread_state_after_solve;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif // _OPENMP
+        for (int local_index=0; local_index<num_local_cells; local_index++)
+        {
+            if (thread_failures.HasFailed()
+                || (use_cell_blocks && mCellIsInBlock[local_index]))
+            {
+                continue;
+            }
+            unsigned global_index = index_low + local_index;
+            AbstractCardiacCellInterface* p_cell = mCellsDistributed[local_index];
+            p_cell->SetVoltage( voltage[global_index] );
+
+            bool check_quiescence = false;
+            if (mSkipQuiescentCells)
+            {
+                // A stimulus pulse anywhere in the interval must be applied, even if it is off at both ends
+                const bool is_unstimulated = p_cell->IsIntracellularStimulusZeroBetween(time, nextTime);
+                if (is_unstimulated
+                    && mQuiescentVoltages[local_index] != DOUBLE_UNSET
+                    && fabs(voltage[global_index] - mQuiescentVoltages[local_index]) <= mQuiescentVoltageTolerance)
+                {
+                    mNumSkippedSolves[local_index]++;
+                    UpdateCaches(global_index, local_index, nextTime);
+                    continue;
+                }
+                mQuiescentVoltages[local_index] = DOUBLE_UNSET;
+                if (is_unstimulated)
+                {
+                    p_cell->CopyStdVecStateVariables(thread_state_before_solve);
+                    check_quiescence = true;
+                }
+            }
+
+            const double solve_start_time = mMeasureCellCosts ? Timer::GetWallTime() : 0.0;
             try
             {
                 if (!updateVoltage)
@@ -498,26 +773,24 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
                     // solve ODE system at this node.
                     // Note: Voltage is not being updated. The voltage is updated in the PDE solve.
 #ifndef CHASTE_CVODE
-                    mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
+                    p_cell->ComputeExceptVoltage(time, nextTime);
 #else
                     // If CVODE is enabled, and this is a CVODE cell
                     // there's a chance we can recover this by doing a reset so put the above call in a try...catch.
                     try
                     {
-                        mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
+                        p_cell->ComputeExceptVoltage(time, nextTime);
                     }
                     catch (Exception &e)
                     {
                         // Try an 'emergency' reset if this is a CVODE cell.
                         // See #2594 for why we think this may be necessary.
-                        if(dynamic_cast<AbstractCvodeCell*>(mCellsDistributed[index.Local]))
+                        if (dynamic_cast<AbstractCvodeCell*>(p_cell))
                         {
                             // Reset the CVODE cell, this leads to a call to CVodeReInit.
-                            static_cast<AbstractCvodeCell*>(mCellsDistributed[index.Local])->ResetSolver();
-                            mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
-                            WARNING("Global node " << index.Global << " had an ODE solving problem in t = [" << time <<
-                                    ", " << nextTime << "] ms. This was fixed by a reset of CVODE, but may suggest PDE time"
-                                    " step should be reduced, or CVODE tolerances relaxed.");
+                            static_cast<AbstractCvodeCell*>(p_cell)->ResetSolver();
+                            p_cell->ComputeExceptVoltage(time, nextTime);
+                            thread_cvode_resets.push_back(local_index);
                         }
                         else
                         {
@@ -529,50 +802,142 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
                 else
                 {
                     // solve, including updating the voltage (for the operator-splitting implementation of the monodomain solver)
-                    mCellsDistributed[index.Local]->SolveAndUpdateState(time, nextTime);
-                    voltage[index] = mCellsDistributed[index.Local]->GetVoltage();
+                    p_cell->SolveAndUpdateState(time, nextTime);
+                    voltage[global_index] = p_cell->GetVoltage();
                 }
             }
             catch (Exception &e)
             {
-                std::cout << std::setprecision(16);
-                std::cout << "Global node " << index.Global << " had problems with ODE solve between "
-                        "t = " << time << " and " << nextTime << "ms.\n";
+                thread_failures.RecordFailure(local_index, e);
+                continue;
+            }
+            if (mMeasureCellCosts)
+            {
+                mCellCosts[local_index] += Timer::GetWallTime() - solve_start_time;
+            }
 
-                std::cout << "Voltage at this node before solve was " << voltage_before_update << "mV\n"
-                        "(this SHOULD NOT necessarily be the same as the one in the state variables,\n"
-                        "which can be ignored and stay at the initial condition - the voltage is dictated by PDE instead of state variable.)\n";
+            if (check_quiescence)
+            {
+                // Mark the cell as quiescent if no state variable moved faster than the tolerance
+                p_cell->CopyStdVecStateVariables(thread_state_after_solve);
+                const double max_change = mQuiescentDerivativeTolerance*(nextTime - time);
+                bool is_quiescent = true;
+                for (unsigned i=0; i<thread_state_after_solve.size() && is_quiescent; i++)
+                {
+                    is_quiescent = (fabs(thread_state_after_solve[i] - thread_state_before_solve[i]) <= max_change);
+                }
+                if (is_quiescent)
+                {
+                    mQuiescentVoltages[local_index] = voltage[global_index];
+                }
+            }
 
-                std::cout << "Stimulus current (NB converted to micro-Amps per cm^3) applied here is equal to:\n\t"
-                    << mCellsDistributed[index.Local]->GetIntracellularStimulus(time) << " at t = " << time     << "ms,\n\t"
-                    << mCellsDistributed[index.Local]->GetIntracellularStimulus(nextTime) << " at t = " << nextTime << "ms.\n";
+            // update the Iionic and stimulus caches
+            UpdateCaches(global_index, local_index, nextTime);
+        }
 
-                std::cout << "Cell model: " << dynamic_cast<AbstractUntemplatedParameterisedSystem*>(mCellsDistributed[index.Local])->GetSystemName() << "\n";
+        if (use_cell_blocks)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif // _OPENMP
+            for (int block_index=0; block_index<num_cell_blocks; block_index++)
+            {
+                AbstractCardiacCellBlock& r_block = *(mCellBlocks[block_index]);
+                const unsigned block_start = mCellBlockStarts[block_index];
+                const unsigned block_size = r_block.GetNumCells();
+                for (unsigned i=0; i<block_size; i++)
+                {
+                    mCellsDistributed[block_start + i]->SetVoltage( voltage[index_low + block_start + i] );
+                }
 
-                std::cout << "All state variables are now:\n";
-                std::vector<double> state_vars = mCellsDistributed[index.Local]->GetStdVecStateVariables();
-                std::vector<std::string> state_var_names = mCellsDistributed[index.Local]->rGetStateVariableNames();
-                for (unsigned i=0; i<state_vars.size(); i++)
+                const double block_start_time = mMeasureCellCosts ? Timer::GetWallTime() : 0.0;
+                try
+                {
+                    r_block.ComputeExceptVoltage(time, nextTime);
+                }
+                catch (Exception &e)
+                {
+                    thread_failures.RecordFailure(block_start + r_block.GetFailedCellIndex(), e);
+                    continue;
+                }
+                if (mMeasureCellCosts)
                 {
-                    std::cout << "\t" << state_var_names[i] << "\t:\t" << state_vars[i] << "\n";
+                    const double cost_per_cell = (Timer::GetWallTime() - block_start_time)/block_size;
+                    for (unsigned i=0; i<block_size; i++)
+                    {
+                        mCellCosts[block_start + i] += cost_per_cell;
+                    }
                 }
-                std::cout << std::flush;
 
-                throw e;
+                for (unsigned i=0; i<block_size; i++)
+                {
+                    UpdateCaches(index_low + block_start + i, block_start + i, nextTime);
+                }
             }
-            // update the Iionic and stimulus caches
-            UpdateCaches(index.Global, index.Local, nextTime);
         }
 
-        if (updateVoltage)
+        failures.Merge(thread_failures);
+#ifdef _OPENMP
+#pragma omp critical(AbstractCardiacTissueCvodeResets)
+#endif // _OPENMP
         {
-            dist_solution.Restore();
+            cvode_reset_local_indices.insert(cvode_reset_local_indices.end(), thread_cvode_resets.begin(), thread_cvode_resets.end());
         }
     }
-    catch (Exception &e)
+
+    const unsigned first_failed_local_index = failures.GetFirstFailedIndex();
+    std::sort(cvode_reset_local_indices.begin(), cvode_reset_local_indices.end());
+    for (unsigned i=0; i<cvode_reset_local_indices.size(); i++)
     {
+        if (cvode_reset_local_indices[i] > first_failed_local_index)
+        {
+            // A serial solve would have stopped before reaching this node
+            break;
+        }
+        WARNING("Global node " << index_low + cvode_reset_local_indices[i] << " had an ODE solving problem in t = [" << time <<
+                ", " << nextTime << "] ms. This was fixed by a reset of CVODE, but may suggest PDE time"
+                " step should be reduced, or CVODE tolerances relaxed.");
+    }
+
+    if (failures.HasFailed())
+    {
+        // Provide more output to screen about the failure.
+        /// \todo This may want to go to std::cerr ??
+        unsigned global_index = index_low + first_failed_local_index;
+        AbstractCardiacCellInterface* p_cell = mCellsDistributed[first_failed_local_index];
+
+        std::cout << std::setprecision(16);
+        std::cout << "Global node " << global_index << " had problems with ODE solve between "
+                "t = " << time << " and " << nextTime << "ms.\n";
+
+        // The voltage is only written back once a solve has succeeded, so this is still the value before the solve
+        std::cout << "Voltage at this node before solve was " << voltage[global_index] << "mV\n"
+                "(this SHOULD NOT necessarily be the same as the one in the state variables,\n"
+                "which can be ignored and stay at the initial condition - the voltage is dictated by PDE instead of state variable.)\n";
+
+        std::cout << "Stimulus current (NB converted to micro-Amps per cm^3) applied here is equal to:\n\t"
+            << p_cell->GetIntracellularStimulus(time) << " at t = " << time     << "ms,\n\t"
+            << p_cell->GetIntracellularStimulus(nextTime) << " at t = " << nextTime << "ms.\n";
+
+        std::cout << "Cell model: " << dynamic_cast<AbstractUntemplatedParameterisedSystem*>(p_cell)->GetSystemName() << "\n";
+
+        std::cout << "All state variables are now:\n";
+        std::vector<double> state_vars = p_cell->GetStdVecStateVariables();
+        std::vector<std::string> state_var_names = p_cell->rGetStateVariableNames();
+        for (unsigned i=0; i<state_vars.size(); i++)
+        {
+            std::cout << "\t" << state_var_names[i] << "\t:\t" << state_vars[i] << "\n";
+        }
+        std::cout << std::flush;
+
         PetscTools::ReplicateException(true);
-        throw e;
+        failures.ThrowFirstFailure();
+    }
+
+    if (updateVoltage)
+    {
+        dist_solution.Restore();
     }
 
     /////////////////////////////////////////////////////////////
@@ -699,26 +1064,26 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIionicCacheReplicated()
+GhostedVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIionicCacheReplicated()
 {
     return mIionicCacheReplicated;
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularStimulusCacheReplicated()
+GhostedVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularStimulusCacheReplicated()
 {
     return mIntracellularStimulusCacheReplicated;
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIionicCacheReplicated()
+GhostedVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIionicCacheReplicated()
 {
     EXCEPT_IF_NOT(mHasPurkinje);
     return mPurkinjeIionicCacheReplicated;
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIntracellularStimulusCacheReplicated()
+GhostedVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIntracellularStimulusCacheReplicated()
 {
     EXCEPT_IF_NOT(mHasPurkinje);
     return mPurkinjeIntracellularStimulusCacheReplicated;
@@ -743,17 +1108,13 @@ template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::ReplicateCaches()
 {
     // ReplicateCaches only needed for SVI (and non-matrix based assembly which is no longer in code)
-    // which is not implemented with purkinje. See commented code below if introducing this.
+    // which is not implemented with purkinje. The Purkinje caches would need halo entries
+    // (see InitialiseCache()) if introducing this.
     assert(!mHasPurkinje);
 
-    mIionicCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
-    mIntracellularStimulusCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
-
-    //if (mHasPurkinje)
-    //{
-    //    mPurkinjeIionicCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
-    //    mPurkinjeIntracellularStimulusCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
-    //}
+    // Only the entries for halo nodes are communicated, and only between neighbouring processes
+    mIionicCacheReplicated.UpdateGhosts();
+    mIntracellularStimulusCacheReplicated.UpdateGhosts();
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
@@ -784,6 +1145,12 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetConductivityModifier(Abstr
     mpConductivityModifier = pModifier;
 }
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+bool AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::HasConductivityModifier() const
+{
+    return (mpConductivityModifier != NULL);
+}
+
 
 /////////////////////////////////////////////////////////////////////
 // Explicit instantiation
@@ -56,11 +56,13 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractConductivityTensors.hpp"
 #include "AbstractPurkinjeCellFactory.hpp"
 #include "ReplicatableVector.hpp"
+#include "GhostedVector.hpp"
 #include "HeartConfig.hpp"
 #include "ArchiveLocationInfo.hpp"
 #include "AbstractDynamicallyLoadableEntity.hpp"
 #include "DynamicModelLoaderRegistry.hpp"
 #include "AbstractConductivityModifier.hpp"
+#include "AbstractCardiacCellBlock.hpp"
 
 /**
  * Class containing "tissue-like" functionality used in monodomain and bidomain
@@ -169,7 +171,8 @@ private:
             archive & mHasPurkinje;
             if (mHasPurkinje)
             {
-                mPurkinjeIionicCacheReplicated.Resize(mpDistributedVectorFactory->GetProblemSize());
+                InitialiseCache(mPurkinjeIionicCacheReplicated, false);
+                InitialiseCache(mPurkinjeIntracellularStimulusCacheReplicated, false);
             }
         }
         if (version >= 2)
@@ -239,28 +242,33 @@ protected:
     std::vector< AbstractCardiacCellInterface* > mPurkinjeCellsDistributed;
 
     /**
-     *  Cache containing all the ionic currents for each node,
-     *  replicated over all processes.
+     *  Cache containing the ionic currents for each local node and each of
+     *  #mCacheHaloNodes.
      */
-    ReplicatableVector mIionicCacheReplicated;
+    GhostedVector mIionicCacheReplicated;
 
     /**
-     *  Cache containing all the ionic currents for each purkinje node,
-     *  replicated over all processes.
+     *  Cache containing the ionic currents for each local purkinje node.
      */
-    ReplicatableVector mPurkinjeIionicCacheReplicated;
+    GhostedVector mPurkinjeIionicCacheReplicated;
 
     /**
-     *  Cache containing all the stimulus currents for each node,
-     *  replicated over all processes.
+     *  Cache containing the stimulus currents for each local node and each of
+     *  #mCacheHaloNodes.
      */
-    ReplicatableVector mIntracellularStimulusCacheReplicated;
+    GhostedVector mIntracellularStimulusCacheReplicated;
 
     /**
-     *  Cache containing all the stimulus currents for each Purkinje node,
-     *  replicated over all processes.
+     *  Cache containing the stimulus currents for each local Purkinje node.
      */
-    ReplicatableVector mPurkinjeIntracellularStimulusCacheReplicated;
+    GhostedVector mPurkinjeIntracellularStimulusCacheReplicated;
+
+    /**
+     * The nodes owned by other processes which are in elements containing nodes owned
+     * by this process.  These are the entries of the caches which ReplicateCaches()
+     * fills in, since they are all that element assembly on this process reads.
+     */
+    std::vector<unsigned> mCacheHaloNodes;
 
     /** Local pointer to the HeartConfig singleton instance, for convenience. */
     HeartConfig* mpConfig;
@@ -291,7 +299,8 @@ protected:
     bool mHasPurkinje;
 
     /**
-     * Whether we need to replicate the caches.
+     * Whether we need to replicate the caches, that is fill in their entries for
+     * halo nodes (see ReplicateCaches()).
      *
      * When doing matrix-based RHS assembly, we only actually need information from
      * cells/nodes local to the processor, so replicating the caches is an
@@ -312,6 +321,61 @@ protected:
      */
     bool mExchangeHalos;
 
+    /**
+     * Whether to solve runs of local CVODE cells of the same model together as CvodeCellBlock
+     * objects, when the voltage is not being updated by the cells.  Not archived.
+     *
+     * Defaults to false.
+     */
+    bool mUseCellBlocks;
+
+    /** Blocks of local cells solved together, if #mUseCellBlocks is set. */
+    std::vector<boost::shared_ptr<AbstractCardiacCellBlock> > mCellBlocks;
+
+    /** Local index of the first cell in each of #mCellBlocks. */
+    std::vector<unsigned> mCellBlockStarts;
+
+    /** Whether each local cell is in one of #mCellBlocks. */
+    std::vector<bool> mCellIsInBlock;
+
+    /**
+     * Whether to skip the ODE solve for quiescent cells (see SetSkipQuiescentCells()).
+     * Not archived; set from HeartConfig by the constructors.
+     */
+    bool mSkipQuiescentCells;
+
+    /** The change in voltage (mV) since its last solve which re-activates a quiescent cell. */
+    double mQuiescentVoltageTolerance;
+
+    /** The rate of change (per ms) of the state variables below which a cell is quiescent. */
+    double mQuiescentDerivativeTolerance;
+
+    /**
+     * For each local cell, the voltage after its last solve if the cell was quiescent in
+     * that solve, or DOUBLE_UNSET if it is active.
+     */
+    std::vector<double> mQuiescentVoltages;
+
+    /** For each local cell, the number of solves skipped since #mSkipQuiescentCells was set. */
+    std::vector<unsigned> mNumSkippedSolves;
+
+    /** The number of calls to SolveCellSystems() since #mSkipQuiescentCells was set. */
+    unsigned mNumQuiescentCheckSteps;
+
+    /**
+     * Whether to time the ODE solve of each local cell (see SetMeasureCellCosts()).
+     * Not archived.
+     */
+    bool mMeasureCellCosts;
+
+    /** For each local cell, the wall-clock time (s) spent solving it since #mMeasureCellCosts was set. */
+    std::vector<double> mCellCosts;
+
+    /**
+     * Work out #mCacheHaloNodes.  Uses #mHaloNodes if it has been set up already.
+     */
+    void CalculateCacheHaloNodes();
+
     /** Vector of halo node indices for current process */
     std::vector<unsigned> mHaloNodes;
 
@@ -376,7 +440,7 @@ public:
     bool HasPurkinje();
 
     /**
-     * Set whether or not to replicate the caches across all processors.
+     * Set whether or not to replicate the halo node entries of the caches.
      *
      * See also mDoCacheReplication.
      * @param doCacheReplication - true if the cache needs to be replicated
@@ -390,6 +454,77 @@ public:
      */
     bool GetDoCacheReplication();
 
+    /**
+     * Set whether to solve the cells in blocks.  Each maximal run (up to a fixed size) of
+     * consecutive local CVODE cells with the same model and solver settings is put in a
+     * CvodeCellBlock, which integrates them as one block-diagonal system with a single CVODE
+     * solver.  Other cells are solved individually as usual, as are all cells if Chaste is
+     * built without CVODE.
+     *
+     * Call this after any changes to the cells, since the blocks are created here.
+     *
+     * @param useCellBlocks  whether to use cell blocks
+     */
+    void SetUseCellBlocks(bool useCellBlocks);
+
+    /**
+     * Set whether to skip the ODE solve for cells at rest.  After each solve, a cell with no
+     * stimulus whose state variables all changed by less than derivativeTolerance per ms is
+     * marked quiescent.  A quiescent cell keeps its state, and only has its caches updated,
+     * until its voltage moves more than voltageTolerance from the value after its last solve
+     * or it is stimulated at any time during a step (see
+     * AbstractStimulusFunction::IsZeroBetween()).  Cells in blocks (see SetUseCellBlocks()) and Purkinje cells are
+     * always solved.
+     *
+     * The constructors call this with the settings from HeartConfig::SetSkipQuiescentCells().
+     * Calling it again resets the statistics (see GetQuiescentCellStatistics()).
+     *
+     * @param skipQuiescentCells  whether to skip quiescent cells
+     * @param voltageTolerance  the change in voltage (mV) which re-activates a cell
+     * @param derivativeTolerance  the rate of change (per ms) below which a cell is quiescent
+     */
+    void SetSkipQuiescentCells(bool skipQuiescentCells, double voltageTolerance, double derivativeTolerance);
+
+    /**
+     * Get how many cell solves were skipped on this process, by node region (see
+     * Node::GetRegion()), since SetSkipQuiescentCells() was last called.
+     *
+     * @param rNumCellSolves  filled in with the number of solves of local cells in each region
+     *     there would have been without skipping
+     * @param rNumSkippedCellSolves  filled in with the number of these which were skipped
+     */
+    void GetQuiescentCellStatistics(std::map<unsigned, unsigned>& rNumCellSolves,
+                                    std::map<unsigned, unsigned>& rNumSkippedCellSolves);
+
+    /**
+     * Set whether to time the ODE solve of each cell in SolveCellSystems(), for example over
+     * a warm-up period, so that the mesh can be partitioned by measured cost.  Cells solved
+     * in a block (see SetUseCellBlocks()) are each given an equal share of the block's time.
+     * Switching measurement on resets the measured costs.
+     *
+     * @param measureCellCosts  whether to measure cell costs
+     */
+    void SetMeasureCellCosts(bool measureCellCosts=true);
+
+    /**
+     * Convert the cell costs measured since SetMeasureCellCosts() was called into integer node
+     * weights, scaled so that the most expensive cell has weight maxWeight and every cell has
+     * weight at least 1.
+     *
+     * If the mesh has been permuted (e.g. by partitioning), its current global node indices differ
+     * from those in the mesh file.  By default the weights are indexed as in the mesh file, as
+     * DistributedTetrahedralMesh::SetNodeWeights() expects when the mesh is read again.  With
+     * originalNodeOrdering false they are indexed by current global node index instead, as
+     * CardiacSimulationArchiver::Migrate() expects when repartitioning a checkpoint of this simulation.
+     *
+     * @note Must be called collectively.
+     *
+     * @param maxWeight  the weight given to the most expensive cell
+     * @param originalNodeOrdering  whether to index the weights as in the mesh file
+     * @return the weight of each node in the mesh, on all processes
+     */
+    std::vector<unsigned> GetNodeWeightsFromCellCosts(unsigned maxWeight=100u, bool originalNodeOrdering=true);
+
     /** @return the intracellular conductivity tensor for the given element
      * @param elementIndex  index of the element of interest
      */
@@ -438,6 +573,15 @@ public:
      * Integrate the cell ODEs and update ionic current etc for each of the
      * cells, between the two times provided.
      *
+     * If Chaste is built with the 'openmp' build option, the cells owned by this
+     * process are shared dynamically between OMP_NUM_THREADS threads.  The Euler,
+     * Heun, RK2 and RK4 solvers don't share working memory between threads, so one instance may be shared by all the cells (as the cell factories do),
+     * as may the cells with their own solvers (CVODE and backward Euler cells).  Every other
+     * AbstractIvpOdeSolver (e.g. GRL1/2, BackwardEulerIvpOdeSolver, RKF45 or CvodeAdaptor)
+     * keeps working memory in members, so each cell must then be given its own instance.
+     * Any failure is reported as for a serial solve: the first failing node in index order
+     * is reported, and CVODE reset warnings are issued in node order up to that node.
+     *
      * @param existingSolution  the current voltage solution vector
      * @param time  the current simulation time
      * @param nextTime  when to simulate the cells until
@@ -445,17 +589,32 @@ public:
      */
     virtual void SolveCellSystems(Vec existingSolution, double time, double nextTime, bool updateVoltage=false);
 
-    /** @return the entire ionic current cache */
-    ReplicatableVector& rGetIionicCacheReplicated();
+    /**
+     * @return the ionic current cache.  Entries for local nodes are always available, and
+     * those for halo nodes are too if #mDoCacheReplication is set.
+     */
+    GhostedVector& rGetIionicCacheReplicated();
 
-    /** @return the entire stimulus current cache */
-    ReplicatableVector& rGetIntracellularStimulusCacheReplicated();
+    /**
+     * @return the stimulus current cache.  Entries for local nodes are always available, and
+     * those for halo nodes are too if #mDoCacheReplication is set.
+     */
+    GhostedVector& rGetIntracellularStimulusCacheReplicated();
 
-    /** @return the entire Purkinje ionic current cache */
-    ReplicatableVector& rGetPurkinjeIionicCacheReplicated();
+    /** @return the Purkinje ionic current cache (local nodes only) */
+    GhostedVector& rGetPurkinjeIionicCacheReplicated();
 
-    /** @return the entire Purkinje stimulus current cache */
-    ReplicatableVector& rGetPurkinjeIntracellularStimulusCacheReplicated();
+    /** @return the Purkinje stimulus current cache (local nodes only) */
+    GhostedVector& rGetPurkinjeIntracellularStimulusCacheReplicated();
+
+    /**
+     * Size a cache to hold entries for the nodes owned by this process and, optionally,
+     * for #mCacheHaloNodes.  This is collective.
+     *
+     * @param rCache  the cache
+     * @param withHaloNodes  whether to store entries for the halo nodes too.  Defaults to true.
+     */
+    void InitialiseCache(GhostedVector& rCache, bool withHaloNodes=true);
 
 
     /**
@@ -477,7 +636,8 @@ public:
     void UpdatePurkinjeCaches(unsigned globalIndex, unsigned localIndex, double nextTime);
 
     /**
-     *  Replicate the Iionic and intracellular stimulus caches.
+     *  Fill in the halo node entries of the Iionic and intracellular stimulus caches
+     *  from the processes which own those nodes.
      */
     void ReplicateCaches();
 
@@ -505,6 +665,11 @@ public:
      */
     void SetConductivityModifier(AbstractConductivityModifier<ELEMENT_DIM,SPACE_DIM>* pModifier);
 
+    /**
+     * @return whether a conductivity modifier has been set with SetConductivityModifier().
+     */
+    bool HasConductivityModifier() const;
+
     /**
      * Save our tissue to an archive.
      *
@@ -102,10 +102,10 @@ ExtendedBidomainTissue<SPACE_DIM>::ExtendedBidomainTissue(AbstractCardiacCellFac
     PetscTools::ReplicateException(false);
 
     HeartEventHandler::BeginEvent(HeartEventHandler::COMMUNICATION);
-    mIionicCacheReplicatedSecondCell.Resize( pCellFactory->GetNumberOfCells() );
-    mIntracellularStimulusCacheReplicatedSecondCell.Resize( pCellFactorySecondCell->GetNumberOfCells() );
-    mGgapCacheReplicated.Resize(pCellFactorySecondCell->GetNumberOfCells());//this is a bit of a hack...
-    mExtracellularStimulusCacheReplicated.Resize(pExtracellularStimulusFactory->GetNumberOfCells());
+    this->InitialiseCache(mIionicCacheReplicatedSecondCell);
+    this->InitialiseCache(mIntracellularStimulusCacheReplicatedSecondCell);
+    this->InitialiseCache(mGgapCacheReplicated);
+    this->InitialiseCache(mExtracellularStimulusCacheReplicated);
     HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
 
     //Create the extracellular conductivity tensor
@@ -133,10 +133,10 @@ ExtendedBidomainTissue<SPACE_DIM>::ExtendedBidomainTissue(std::vector<AbstractCa
     assert(mExtracellularStimuliDistributed.size() > 0);
     assert(mGgapDistributed.size() > 0);
     //allocate memory for the caches
-    mIionicCacheReplicatedSecondCell.Resize( this->mpDistributedVectorFactory->GetProblemSize());
-    mIntracellularStimulusCacheReplicatedSecondCell.Resize( this->mpDistributedVectorFactory->GetProblemSize() );
-    mGgapCacheReplicated.Resize(this->mpDistributedVectorFactory->GetProblemSize());
-    mExtracellularStimulusCacheReplicated.Resize(this->mpDistributedVectorFactory->GetProblemSize());
+    this->InitialiseCache(mIionicCacheReplicatedSecondCell);
+    this->InitialiseCache(mIntracellularStimulusCacheReplicatedSecondCell);
+    this->InitialiseCache(mGgapCacheReplicated);
+    this->InitialiseCache(mExtracellularStimulusCacheReplicated);
 
     CreateIntracellularConductivityTensorSecondCell();
     CreateExtracellularConductivityTensors();
@@ -568,32 +568,32 @@ void ExtendedBidomainTissue<SPACE_DIM>::UpdateAdditionalCaches(unsigned globalIn
 template <unsigned SPACE_DIM>
 void ExtendedBidomainTissue<SPACE_DIM>::ReplicateAdditionalCaches()
 {
-    mIionicCacheReplicatedSecondCell.Replicate(this->mpDistributedVectorFactory->GetLow(), this->mpDistributedVectorFactory->GetHigh());
-    mIntracellularStimulusCacheReplicatedSecondCell.Replicate(this->mpDistributedVectorFactory->GetLow(), this->mpDistributedVectorFactory->GetHigh());
-    mExtracellularStimulusCacheReplicated.Replicate(this->mpDistributedVectorFactory->GetLow(), this->mpDistributedVectorFactory->GetHigh());
-    mGgapCacheReplicated.Replicate(this->mpDistributedVectorFactory->GetLow(), this->mpDistributedVectorFactory->GetHigh());
+    mIionicCacheReplicatedSecondCell.UpdateGhosts();
+    mIntracellularStimulusCacheReplicatedSecondCell.UpdateGhosts();
+    mExtracellularStimulusCacheReplicated.UpdateGhosts();
+    mGgapCacheReplicated.UpdateGhosts();
 }
 
 template <unsigned SPACE_DIM>
-ReplicatableVector& ExtendedBidomainTissue<SPACE_DIM>::rGetIionicCacheReplicatedSecondCell()
+GhostedVector& ExtendedBidomainTissue<SPACE_DIM>::rGetIionicCacheReplicatedSecondCell()
 {
     return mIionicCacheReplicatedSecondCell;
 }
 
 template <unsigned SPACE_DIM>
-ReplicatableVector& ExtendedBidomainTissue<SPACE_DIM>::rGetIntracellularStimulusCacheReplicatedSecondCell()
+GhostedVector& ExtendedBidomainTissue<SPACE_DIM>::rGetIntracellularStimulusCacheReplicatedSecondCell()
 {
     return mIntracellularStimulusCacheReplicatedSecondCell;
 }
 
 template <unsigned SPACE_DIM>
-ReplicatableVector& ExtendedBidomainTissue<SPACE_DIM>::rGetExtracellularStimulusCacheReplicated()
+GhostedVector& ExtendedBidomainTissue<SPACE_DIM>::rGetExtracellularStimulusCacheReplicated()
 {
     return mExtracellularStimulusCacheReplicated;
 }
 
 template <unsigned SPACE_DIM>
-ReplicatableVector& ExtendedBidomainTissue<SPACE_DIM>::rGetGgapCacheReplicated()
+GhostedVector& ExtendedBidomainTissue<SPACE_DIM>::rGetGgapCacheReplicated()
 {
     return mGgapCacheReplicated;
 }
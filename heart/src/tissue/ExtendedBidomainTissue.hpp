@@ -116,28 +116,28 @@ private:
     AbstractConductivityTensors<SPACE_DIM, SPACE_DIM> *mpExtracellularConductivityTensors;
 
     /**
-     *  Cache containing all the stimulus currents for each node,
-     *  replicated over all processes.
+     *  Cache containing the extracellular stimulus currents for each local
+     *  and halo node.
      */
-    ReplicatableVector mExtracellularStimulusCacheReplicated;
+    GhostedVector mExtracellularStimulusCacheReplicated;
 
     /**
-     *  Cache containing all the stimulus currents for each node,
-     *  replicated over all processes.
+     *  Cache containing the gap junction conductivities for each local
+     *  and halo node.
      */
-    ReplicatableVector mGgapCacheReplicated;
+    GhostedVector mGgapCacheReplicated;
 
     /**
-     *  Cache containing all the ionic currents for each node for the seconed cell,
-     *  replicated over all processes.
+     *  Cache containing the ionic currents for each local and halo node for
+     *  the second cell.
      */
-    ReplicatableVector mIionicCacheReplicatedSecondCell;
+    GhostedVector mIionicCacheReplicatedSecondCell;
 
     /**
-     *  Cache containing all the stimulus currents for each node for the second cell,
-     *  replicated over all processes.
+     *  Cache containing the stimulus currents for each local and halo node for
+     *  the second cell.
      */
-    ReplicatableVector mIntracellularStimulusCacheReplicatedSecondCell;
+    GhostedVector mIntracellularStimulusCacheReplicatedSecondCell;
 
     /** The vector of cells (the second one). Distributed. */
     std::vector< AbstractCardiacCellInterface* > mCellsDistributedSecondCell;
@@ -319,17 +319,17 @@ public:
       const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetIntracellularConductivityTensorSecondCell(unsigned elementIndex);
 
 
-     /** @return the entire ionic current cache for the second cell*/
-     ReplicatableVector& rGetIionicCacheReplicatedSecondCell();
+     /** @return the ionic current cache for the second cell*/
+     GhostedVector& rGetIionicCacheReplicatedSecondCell();
 
-     /** @return the entire stimulus current cache for the second cell*/
-     ReplicatableVector& rGetIntracellularStimulusCacheReplicatedSecondCell();
+     /** @return the stimulus current cache for the second cell*/
+     GhostedVector& rGetIntracellularStimulusCacheReplicatedSecondCell();
 
      /** @return the extracellular stimulus*/
-     ReplicatableVector& rGetExtracellularStimulusCacheReplicated();
+     GhostedVector& rGetExtracellularStimulusCacheReplicated();
 
      /** @return the values of ggap*/
-     ReplicatableVector& rGetGgapCacheReplicated();
+     GhostedVector& rGetGgapCacheReplicated();
 
      /**
       * @return Am for the first cell
@@ -44,6 +44,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Exception.hpp"
 #include "DistributedVector.hpp"
 #include "DistributedVectorFactory.hpp"
+#include "ReplicatableVector.hpp"
 #include "ArchiveOpener.hpp"
 #include "ChasteSyscalls.hpp"
 
@@ -1332,6 +1333,76 @@ cp /tmp/$USER/testoutput/TestCreateArchiveForMigrateAfterSolve/archive/?* ./hear
         DoSimulationsAfterMigrationAndCompareResults(p_problem, source_directory, ref_archive_dir, new_archive_dir, 1, 0.2);
     }
 
+    void TestRepartitionUsingMeasuredCellCosts() throw (Exception)
+    {
+        std::string directory = "TestRepartitionUsingMeasuredCellCosts";
+        HeartConfig::Instance()->Reset();
+        HeartConfig::Instance()->SetSimulationDuration(0.1); //ms
+        HeartConfig::Instance()->SetOutputDirectory(directory);
+        HeartConfig::Instance()->SetOutputFilenamePrefix("simulation");
+
+        TrianglesMeshReader<1,1> reader("mesh/test/data/1D_0_to_1_100_elements");
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructFromMeshReader(reader);
+        const unsigned num_nodes = mesh.GetNumNodes();
+
+        PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 1> cell_factory;
+        MonodomainProblem<1> monodomain_problem( &cell_factory );
+        monodomain_problem.SetMesh(&mesh);
+        monodomain_problem.Initialise();
+
+        // Time the cells over a short warm-up
+        monodomain_problem.GetTissue()->SetMeasureCellCosts();
+        monodomain_problem.Solve();
+        std::vector<unsigned> measured_weights = monodomain_problem.GetTissue()->GetNodeWeightsFromCellCosts(50u, false);
+        TS_ASSERT_EQUALS(measured_weights.size(), num_nodes);
+        unsigned max_weight = 0u;
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_LESS_THAN_EQUALS(1u, measured_weights[i]);
+            max_weight = std::max(max_weight, measured_weights[i]);
+        }
+        TS_ASSERT_EQUALS(max_weight, 50u);
+
+        CardiacSimulationArchiver<MonodomainProblem<1> >::Save(monodomain_problem, directory + "/archive");
+        ReplicatableVector saved_solution(monodomain_problem.GetSolution());
+
+        // Timings are not reproducible, so repartition with weights making the left half expensive
+        std::vector<unsigned> weights(num_nodes, 1u);
+        for (unsigned i=0; i<num_nodes/2; i++)
+        {
+            weights[i] = 10u;
+        }
+        FileFinder archive_dir(directory + "/archive", RelativeTo::ChasteTestOutput);
+        MonodomainProblem<1>* p_problem = CardiacSimulationArchiver<MonodomainProblem<1> >::Migrate(archive_dir, weights);
+        TS_ASSERT(DistributedVectorFactory::rGetOwnershipWeightsOnLoad().empty());
+
+        DistributedVectorFactory* p_factory = p_problem->rGetMesh().GetDistributedVectorFactory();
+        TS_ASSERT_EQUALS(p_factory->GetProblemSize(), num_nodes);
+        TS_ASSERT_EQUALS(p_factory->GetLocalOwnership(), DistributedVectorFactory::CalculateWeightedLocalOwnership(weights));
+        TS_ASSERT_EQUALS(p_problem->rGetMesh().GetNumLocalNodes(), p_factory->GetLocalOwnership());
+
+        // The state has moved with the nodes
+        ReplicatableVector loaded_solution(p_problem->GetSolution());
+        TS_ASSERT_EQUALS(loaded_solution.GetSize(), saved_solution.GetSize());
+        for (unsigned i=0; i<saved_solution.GetSize(); i++)
+        {
+            TS_ASSERT_DELTA(loaded_solution[i], saved_solution[i], 1e-12);
+        }
+        for (unsigned i=p_factory->GetLow(); i<p_factory->GetHigh(); i++)
+        {
+            TS_ASSERT(p_problem->GetTissue()->GetCardiacCell(i) != NULL);
+        }
+
+        // Weights of the wrong size are rejected
+        weights.resize(num_nodes+1, 1u);
+        TS_ASSERT_THROWS_THIS(CardiacSimulationArchiver<MonodomainProblem<1> >::Migrate(archive_dir, weights),
+                              "The ownership weights given for loading do not match the archived problem size.");
+        TS_ASSERT(DistributedVectorFactory::rGetOwnershipWeightsOnLoad().empty());
+
+        delete p_problem;
+    }
+
     /*
      *  Check that we can read for a permuted mesh (or permuted archive) and then correctly record that it was permuted
      */
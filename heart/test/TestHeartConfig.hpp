@@ -986,6 +986,15 @@ public:
         HeartConfig::Instance()->SetOutputUsingOriginalNodeOrdering(false);
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetOutputUsingOriginalNodeOrdering(), false);
 
+        // Reordering the mesh for locality also writes output in the original node order
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetReorderMeshForLocality(), false);
+        HeartConfig::Instance()->SetReorderMeshForLocality();
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetReorderMeshForLocality(), true);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetOutputUsingOriginalNodeOrdering(), true);
+        HeartConfig::Instance()->SetReorderMeshForLocality(false);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetReorderMeshForLocality(), false);
+        HeartConfig::Instance()->SetOutputUsingOriginalNodeOrdering(false);
+
         HeartConfig::Instance()->SetIntracellularConductivities(Create_c_vector(-6.0, -5.0, -4.0));
 
         c_vector<double, 3> intra;
@@ -1241,6 +1250,18 @@ public:
         HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting(false);
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseReactionDiffusionOperatorSplitting(), false);
 
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCrankNicolsonOperatorSplitting(), false);
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting();
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCrankNicolsonOperatorSplitting(), true);
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting(false);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseCrankNicolsonOperatorSplitting(), false);
+
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetMergeOperatorSplittingOdeHalfSteps(), false);
+        HeartConfig::Instance()->SetMergeOperatorSplittingOdeHalfSteps();
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetMergeOperatorSplittingOdeHalfSteps(), true);
+        HeartConfig::Instance()->SetMergeOperatorSplittingOdeHalfSteps(false);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetMergeOperatorSplittingOdeHalfSteps(), false);
+
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseMassLumpingForPrecond(), false);
         HeartConfig::Instance()->SetUseMassLumpingForPrecond();
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseMassLumpingForPrecond(), true);
@@ -1252,6 +1273,19 @@ public:
         HeartConfig::Instance()->SetUseFixedNumberIterationsLinearSolver(true, 20);
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetUseFixedNumberIterationsLinearSolver(), true);
         TS_ASSERT_EQUALS(HeartConfig::Instance()->GetEvaluateNumItsEveryNSolves(), 20u);
+
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetSkipQuiescentCells(), false);
+        HeartConfig::Instance()->SetSkipQuiescentCells();
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetSkipQuiescentCells(), true);
+        TS_ASSERT_DELTA(HeartConfig::Instance()->GetQuiescentCellVoltageTolerance(), 0.1, 1e-12);
+        TS_ASSERT_DELTA(HeartConfig::Instance()->GetQuiescentCellDerivativeTolerance(), 1e-5, 1e-12);
+        HeartConfig::Instance()->SetSkipQuiescentCells(true, 0.5, 1e-3);
+        TS_ASSERT_DELTA(HeartConfig::Instance()->GetQuiescentCellVoltageTolerance(), 0.5, 1e-12);
+        TS_ASSERT_DELTA(HeartConfig::Instance()->GetQuiescentCellDerivativeTolerance(), 1e-3, 1e-12);
+        TS_ASSERT_THROWS_THIS(HeartConfig::Instance()->SetSkipQuiescentCells(true, -1.0),
+                              "The tolerances for skipping quiescent cells must be non-negative.");
+        HeartConfig::Instance()->SetSkipQuiescentCells(false);
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetSkipQuiescentCells(), false);
     }
 
     void TestPostProcessingFunctions() throw (Exception)
@@ -461,6 +461,70 @@ public:
         HeartEventHandler::Enable();
     }
 
+    void TestBidomainInitialGuessFromSolutionHistory() throw(Exception)
+    {
+        TS_ASSERT_EQUALS(HeartConfig::Instance()->GetBidomainInitialGuess(), BidomainInitialGuessType::PREVIOUS_SOLUTION);
+        TS_ASSERT_THROWS_THIS(HeartConfig::Instance()->SetBidomainInitialGuess(BidomainInitialGuessType::POLYNOMIAL_EXTRAPOLATION, 0u),
+                              "The bidomain initial guess must use at least one previous solution.");
+
+        HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+        HeartConfig::Instance()->SetMeshFileName("mesh/test/data/1D_0_to_1_100_elements");
+        HeartConfig::Instance()->SetOutputDirectory("BidomainInitialGuess");
+        HeartConfig::Instance()->SetOutputFilenamePrefix("BidomainLR91_1d");
+
+        BidomainInitialGuessType::type guess_types[3] = {BidomainInitialGuessType::PREVIOUS_SOLUTION,
+                                                         BidomainInitialGuessType::POLYNOMIAL_EXTRAPOLATION,
+                                                         BidomainInitialGuessType::SUBSPACE_PROJECTION};
+        unsigned num_iterations[3];
+        std::vector<double> solutions[3];
+        for (unsigned type_index=0; type_index<3; type_index++)
+        {
+            HeartConfig::Instance()->SetBidomainInitialGuess(guess_types[type_index], 3u);
+            TS_ASSERT_EQUALS(HeartConfig::Instance()->GetBidomainInitialGuess(), guess_types[type_index]);
+            TS_ASSERT_EQUALS(HeartConfig::Instance()->GetBidomainInitialGuessHistoryLength(), 3u);
+
+            PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 1> cell_factory;
+            BidomainProblem<1> bidomain_problem( &cell_factory );
+            bidomain_problem.Initialise();
+
+            // Drive the solver directly so that its iteration counts can be inspected
+            BoundaryConditionsContainer<1,1,2> container;
+            BidomainSolver<1,1> bidomain_solver(false,
+                                                &bidomain_problem.rGetMesh(),
+                                                bidomain_problem.GetBidomainTissue(),
+                                                &container);
+            Vec initial_condition = bidomain_problem.CreateInitialCondition();
+            bidomain_solver.SetTimes(0.0, HeartConfig::Instance()->GetSimulationDuration());
+            bidomain_solver.SetTimeStep(HeartConfig::Instance()->GetPdeTimeStep());
+            bidomain_solver.SetInitialCondition(initial_condition);
+            Vec solution = bidomain_solver.Solve();
+
+            TS_ASSERT_EQUALS(bidomain_solver.GetNumLinearSolves(), 200u);
+            num_iterations[type_index] = bidomain_solver.GetTotalNumKspIterations();
+            ReplicatableVector solution_replicated(solution);
+            for (unsigned index=0; index<solution_replicated.GetSize(); index++)
+            {
+                solutions[type_index].push_back(solution_replicated[index]);
+            }
+            PetscTools::Destroy(solution);
+            PetscTools::Destroy(initial_condition);
+        }
+
+        // Only the starting point of each linear solve differs, so the answers agree to the solver tolerance...
+        for (unsigned type_index=1; type_index<3; type_index++)
+        {
+            TS_ASSERT_EQUALS(solutions[type_index].size(), solutions[0].size());
+            for (unsigned index=0; index<solutions[0].size(); index++)
+            {
+                TS_ASSERT_DELTA(solutions[type_index][index], solutions[0][index], 1e-2);
+            }
+        }
+
+        // ...but the better guesses save iterations
+        TS_ASSERT_LESS_THAN(num_iterations[1], num_iterations[0]);
+        TS_ASSERT_LESS_THAN(num_iterations[2], num_iterations[0]);
+    }
+
     /*
      * The monodomain equations are obtained by taking the limit of the bidomain
      * equations as sigma_e tends to infinity (corresponding to the extracellular
@@ -54,6 +54,41 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "OdePdeConvergenceTester.hpp"
 #include "PetscSetupAndFinalize.hpp"
 
+/**
+ * Runs PDE time steps 0.04, 0.02 and 0.01ms, whatever the differences between them, and
+ * records the differences so that the observed order of convergence can be calculated.
+ */
+template<class CELL, class CARDIAC_PROBLEM, unsigned DIM, unsigned PROBLEM_DIM>
+class PdeOrderConvergenceTester : public PdeConvergenceTester<CELL, CARDIAC_PROBLEM, DIM, PROBLEM_DIM>
+{
+public:
+    /** The difference between each pair of successive runs */
+    std::vector<double> Differences;
+
+    /** Record the difference from the last run (if there was a previous run) before halving the time step. */
+    void UpdateConvergenceParameters()
+    {
+        if (this->PdeTimeStep < 0.04)
+        {
+            Differences.push_back(this->LastDifference);
+        }
+        PdeConvergenceTester<CELL, CARDIAC_PROBLEM, DIM, PROBLEM_DIM>::UpdateConvergenceParameters();
+    }
+
+    /** @return true once the 0.01ms run has been done */
+    bool GiveUpConvergence()
+    {
+        return (this->PdeTimeStep < 0.01);
+    }
+
+    /** @return log2 of the ratio of the two recorded differences */
+    double ObservedOrder()
+    {
+        assert(Differences.size() == 2u);
+        return log(Differences[0]/Differences[1])/log(2.0);
+    }
+};
+
 
 class TestConvergenceTester : public CxxTest::TestSuite
 {
@@ -139,6 +174,37 @@ public:
 
 
 
+    void Test1DPdeTimeOperatorSplitting() throw(Exception)
+    {
+        HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting();
+
+        PdeOrderConvergenceTester<CellLuoRudy1991FromCellMLBackwardEuler, MonodomainProblem<1>, 1, 1> backward_euler_tester;
+        backward_euler_tester.MeshNum=1;
+        backward_euler_tester.AbsoluteStimulus = -8e6; // The default of -1e7 causes V to go out of range for lookup tables
+        backward_euler_tester.RelativeConvergenceCriterion=1e-10; // Never met, so all three time steps are run
+        backward_euler_tester.Converge(__FUNCTION__);
+        TS_ASSERT(!backward_euler_tester.Converged);
+
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting();
+        PdeOrderConvergenceTester<CellLuoRudy1991FromCellMLBackwardEuler, MonodomainProblem<1>, 1, 1> crank_nicolson_tester;
+        crank_nicolson_tester.MeshNum=1;
+        crank_nicolson_tester.AbsoluteStimulus = -8e6;
+        crank_nicolson_tester.RelativeConvergenceCriterion=1e-10;
+        crank_nicolson_tester.Converge(std::string(__FUNCTION__) + "CrankNicolson");
+        TS_ASSERT(!crank_nicolson_tester.Converged);
+
+        double backward_euler_order = backward_euler_tester.ObservedOrder();
+        double crank_nicolson_order = crank_nicolson_tester.ObservedOrder();
+        std::cout << "Observed order: backward Euler " << backward_euler_order
+                  << ", Crank-Nicolson " << crank_nicolson_order << "\n";
+
+        // Strang splitting with Crank-Nicolson diffusion is second order, with backward Euler only first order
+        TS_ASSERT_LESS_THAN(backward_euler_order + 0.5, crank_nicolson_order);
+
+        HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting(false);
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting(false);
+    }
+
     void TestSpaceConvergenceMonoIn1DWithRelativeTolerance() throw(Exception)
     {
         SpaceConvergenceTester<CellLuoRudy1991FromCellMLBackwardEuler, MonodomainProblem<1>, 1, 1> tester;
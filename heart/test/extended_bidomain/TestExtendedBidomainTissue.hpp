@@ -225,16 +225,22 @@ public:
         extended_bidomain_potentials.Restore();
         extended_bidomain_tissue.SolveCellSystems(extended_vec, 0.0, 0.5);
 
-        //Check ionic currents against hardcoded values
-        TS_ASSERT_DELTA(extended_bidomain_tissue.rGetIionicCacheReplicated()[0], 0.0034, 1e-4);
-        TS_ASSERT_DELTA(extended_bidomain_tissue.rGetIionicCacheReplicatedSecondCell()[0], 0.0034, 1e-4);
-
-        // Check that the first cell and extracellular stimulus have the right stimulus value at node 0 and 1
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularStimulusCacheReplicated()[0], -105.0*1400);
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularStimulusCacheReplicated()[0], -428000);
+        // The caches only hold entries for local and halo nodes
+        if (p_factory->IsGlobalIndexLocal(0))
+        {
+            //Check ionic currents against hardcoded values
+            TS_ASSERT_DELTA(extended_bidomain_tissue.rGetIionicCacheReplicated()[0], 0.0034, 1e-4);
+            TS_ASSERT_DELTA(extended_bidomain_tissue.rGetIionicCacheReplicatedSecondCell()[0], 0.0034, 1e-4);
 
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularStimulusCacheReplicated()[1], 0);
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularStimulusCacheReplicated()[1], 0);
+            // Check that the first cell and extracellular stimulus have the right stimulus value at node 0 and 1
+            TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularStimulusCacheReplicated()[0], -105.0*1400);
+            TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularStimulusCacheReplicated()[0], -428000);
+        }
+        if (p_factory->IsGlobalIndexLocal(1))
+        {
+            TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularStimulusCacheReplicated()[1], 0);
+            TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularStimulusCacheReplicated()[1], 0);
+        }
 
         // Second cell is unstimulated throughout
         for (unsigned node_index = mesh.GetDistributedVectorFactory()->GetLow();
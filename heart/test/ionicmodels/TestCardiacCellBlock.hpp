@@ -0,0 +1,137 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTCARDIACCELLBLOCK_HPP_
+#define TESTCARDIACCELLBLOCK_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "CvodeCellBlock.hpp"
+#include "LuoRudy1991.hpp"
+#include "LuoRudy1991Cvode.hpp"
+#include "EulerIvpOdeSolver.hpp"
+#include "SimpleStimulus.hpp"
+#include "ZeroStimulus.hpp"
+
+//This test is always run sequentially (never in parallel)
+#include "FakePetscSetup.hpp"
+
+class TestCardiacCellBlock : public CxxTest::TestSuite
+{
+public:
+    void TestCvodeBlockMatchesIndividualCells() throw (Exception)
+    {
+#ifdef CHASTE_CVODE
+        boost::shared_ptr<EulerIvpOdeSolver> p_solver(new EulerIvpOdeSolver);
+        boost::shared_ptr<SimpleStimulus> p_stimulus(new SimpleStimulus(-25.5, 2.0, 1.0));
+        boost::shared_ptr<ZeroStimulus> p_zero_stimulus(new ZeroStimulus);
+
+        // Only CVODE cells with the same settings go in a CVODE block
+        CellLuoRudy1991FromCellMLCvode lr91(p_solver, p_zero_stimulus);
+        CellLuoRudy1991FromCellMLCvode other_lr91(p_solver, p_zero_stimulus);
+        CellLuoRudy1991FromCellML lr91_euler(p_solver, p_zero_stimulus);
+        TS_ASSERT(CvodeCellBlock::CanBeBlocked(&lr91) == &lr91);
+        TS_ASSERT(CvodeCellBlock::CanBeBlocked(&lr91_euler) == NULL);
+        TS_ASSERT(CvodeCellBlock::IsSameModel(&lr91, &other_lr91));
+        other_lr91.SetTolerances(1e-6, 1e-8);
+        TS_ASSERT(!CvodeCellBlock::IsSameModel(&lr91, &other_lr91));
+
+        for (unsigned use_numerical_jacobian=0; use_numerical_jacobian<2; use_numerical_jacobian++)
+        {
+            const unsigned num_cells = 5;
+            std::vector<boost::shared_ptr<CellLuoRudy1991FromCellMLCvode> > block_cells;
+            std::vector<boost::shared_ptr<CellLuoRudy1991FromCellMLCvode> > reference_cells;
+            std::vector<AbstractCvodeCell*> cells;
+            for (unsigned c=0; c<num_cells; c++)
+            {
+                // Give the cells different stimuli and voltages so they don't all do the same thing
+                boost::shared_ptr<AbstractStimulusFunction> p_stim = (c%2 == 0) ? p_stimulus : p_zero_stimulus;
+                block_cells.push_back(boost::shared_ptr<CellLuoRudy1991FromCellMLCvode>(new CellLuoRudy1991FromCellMLCvode(p_solver, p_stim)));
+                reference_cells.push_back(boost::shared_ptr<CellLuoRudy1991FromCellMLCvode>(new CellLuoRudy1991FromCellMLCvode(p_solver, p_stim)));
+                for (unsigned j=0; j<2; j++)
+                {
+                    CellLuoRudy1991FromCellMLCvode* p_cell = (j == 0) ? block_cells.back().get() : reference_cells.back().get();
+                    p_cell->SetMinimalReset(true);
+                    p_cell->SetTimestep(0.1);
+                    p_cell->SetTolerances(1e-8, 1e-10);
+                    if (use_numerical_jacobian == 1u)
+                    {
+                        p_cell->ForceUseOfNumericalJacobian();
+                    }
+                }
+                cells.push_back(block_cells.back().get());
+            }
+            CvodeCellBlock block(cells);
+            TS_ASSERT_EQUALS(block.GetNumCells(), num_cells);
+            TS_ASSERT_EQUALS(block.GetFailedCellIndex(), UNSIGNED_UNSET);
+
+            for (unsigned step=0; step<3; step++)
+            {
+                double start_time = step*0.5;
+                for (unsigned c=0; c<num_cells; c++)
+                {
+                    double voltage = -83.853 + 10.0*c + 5.0*step;
+                    block_cells[c]->SetVoltage(voltage);
+                    reference_cells[c]->SetVoltage(voltage);
+                    reference_cells[c]->ComputeExceptVoltage(start_time, start_time + 0.5);
+                }
+                block.ComputeExceptVoltage(start_time, start_time + 0.5);
+
+                for (unsigned c=0; c<num_cells; c++)
+                {
+                    // The voltage is left alone
+                    TS_ASSERT_DELTA(block_cells[c]->GetVoltage(), -83.853 + 10.0*c + 5.0*step, 1e-12);
+                    std::vector<double> block_state = block_cells[c]->GetStdVecStateVariables();
+                    std::vector<double> reference_state = reference_cells[c]->GetStdVecStateVariables();
+                    for (unsigned i=0; i<reference_state.size(); i++)
+                    {
+                        // The solvers take different steps, so only agree to within the tolerances
+                        TS_ASSERT_DELTA(block_state[i], reference_state[i], 1e-5*fabs(reference_state[i]) + 1e-8);
+                    }
+                }
+            }
+            TS_ASSERT_EQUALS(block.GetNumIndividualFallbacks(), 0u);
+        }
+#else
+        std::cout << "Cvode is not enabled.\n";
+#endif // CHASTE_CVODE
+    }
+};
+
+#endif /*TESTCARDIACCELLBLOCK_HPP_*/
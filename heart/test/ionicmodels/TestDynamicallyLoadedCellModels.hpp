@@ -357,6 +357,59 @@ public:
 #endif
     }
 
+    void TestCellmlConverterWithCache() throw(Exception)
+    {
+        std::string dirname = "TestCellmlConverterWithCache";
+        OutputFileHandler cache_handler(dirname + "/cache");
+        std::string cache_dir = cache_handler.GetOutputDirectoryFullPath();
+        FileFinder cellml_file_src("heart/dynamic/luo_rudy_1991_dyn.cellml", RelativeTo::ChasteSourceRoot);
+        std::string so_name = "libluo_rudy_1991_dyn." + CellMLToSharedLibraryConverter::msSoSuffix;
+
+        TS_ASSERT(CellMLToSharedLibraryConverter::rGetCacheDirectory().empty());
+        CellMLToSharedLibraryConverter::SetCacheDirectory(cache_dir);
+        TS_ASSERT_EQUALS(CellMLToSharedLibraryConverter::rGetCacheDirectory(), cache_dir);
+        CellMLToSharedLibraryConverter converter;
+
+        // The first conversion populates the cache
+        OutputFileHandler handler1(dirname + "/first");
+        FileFinder cellml_file1 = handler1.CopyFileTo(cellml_file_src);
+        DynamicCellModelLoaderPtr p_loader1 = converter.Convert(cellml_file1);
+        std::vector<FileFinder> cached = FileFinder(cache_dir, RelativeTo::Absolute).FindMatches("libluo_rudy_1991_dyn_*." + CellMLToSharedLibraryConverter::msSoSuffix);
+        TS_ASSERT_EQUALS(cached.size(), 1u);
+        RunLr91Test(*p_loader1, 0u);
+
+        // The same model elsewhere is loaded from the cache without being converted
+        OutputFileHandler handler2(dirname + "/second");
+        FileFinder cellml_file2 = handler2.CopyFileTo(cellml_file_src);
+        DynamicCellModelLoaderPtr p_loader2 = converter.Convert(cellml_file2);
+        TS_ASSERT(!handler2.FindFile(so_name).Exists());
+        TS_ASSERT(p_loader2 == p_loader1);
+
+        // Which means a cached model can be used without calling collectively
+        OutputFileHandler handler3(dirname + "/third");
+        FileFinder cellml_file3 = handler3.CopyFileTo(cellml_file_src);
+        TS_ASSERT(converter.Convert(cellml_file3, false) == p_loader1);
+
+        // A changed model gets its own cache entry
+        OutputFileHandler handler4(dirname + "/changed");
+        FileFinder cellml_file4 = handler4.CopyFileTo(cellml_file_src);
+        PetscTools::Barrier("TestCellmlConverterWithCache_pre_change");
+        if (PetscTools::AmMaster())
+        {
+            std::ofstream changed(cellml_file4.GetAbsolutePath().c_str(), std::ios::app);
+            changed << "<!-- changed -->" << std::endl;
+        }
+        PetscTools::Barrier("TestCellmlConverterWithCache_post_change");
+        TS_ASSERT_THROWS_THIS(converter.Convert(cellml_file4, false),
+                              "Unable to convert .cellml to .so unless called collectively, due to possible race conditions.");
+        DynamicCellModelLoaderPtr p_loader4 = converter.Convert(cellml_file4);
+        TS_ASSERT(p_loader4 != p_loader1);
+        cached = FileFinder(cache_dir, RelativeTo::Absolute).FindMatches("libluo_rudy_1991_dyn_*." + CellMLToSharedLibraryConverter::msSoSuffix);
+        TS_ASSERT_EQUALS(cached.size(), 2u);
+
+        CellMLToSharedLibraryConverter::SetCacheDirectory("");
+    }
+
     void TestArchiving() throw(Exception)
     {
 #ifdef CHASTE_CAN_CHECKPOINT_DLLS
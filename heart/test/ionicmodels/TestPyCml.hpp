@@ -50,6 +50,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "SimpleStimulus.hpp"
 #include "EulerIvpOdeSolver.hpp"
 #include "ArchiveLocationInfo.hpp"
+#include "OutputFileHandler.hpp"
+#include "FileFinder.hpp"
 #include "VectorHelperFunctions.hpp"
 
 #include "LuoRudy1991.hpp"
@@ -478,6 +480,55 @@ public:
         }
     }
 
+    void TestLookupTableCache() throw(Exception)
+    {
+        boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
+        boost::shared_ptr<EulerIvpOdeSolver> p_solver(new EulerIvpOdeSolver);
+        CellLuoRudy1991FromCellMLOpt opt(p_solver, p_stimulus);
+        AbstractLookupTableCollection* p_tables = opt.GetLookupTableCollection();
+        TS_ASSERT(p_tables);
+        double default_min, default_step, default_max;
+        p_tables->GetTableProperties("membrane_voltage", default_min, default_step, default_max);
+
+        OutputFileHandler handler("TestLookupTableCache");
+        FileFinder cache_dir = handler.FindFile("");
+        AbstractLookupTableCollection::SetCacheDirectory(cache_dir.GetAbsolutePath());
+        TS_ASSERT_EQUALS(AbstractLookupTableCollection::rGetCacheDirectory(), cache_dir.GetAbsolutePath());
+
+        // Generating tables populates the cache
+        TS_ASSERT_EQUALS(cache_dir.FindMatches("*.lut").size(), 0u);
+        p_tables->SetTableProperties("membrane_voltage", -100.0001, 0.01, 60.9999);
+        p_tables->RegenerateTables();
+        TS_ASSERT_EQUALS(cache_dir.FindMatches("*.lut").size(), 1u);
+        double i_ionic = opt.GetIIonic();
+
+        // Going back to previous settings loads them from the cache, giving identical results
+        p_tables->SetTableProperties("membrane_voltage", -100.0001, 0.02, 60.9999);
+        p_tables->RegenerateTables();
+        TS_ASSERT_EQUALS(cache_dir.FindMatches("*.lut").size(), 2u);
+        p_tables->SetTableProperties("membrane_voltage", -100.0001, 0.01, 60.9999);
+        p_tables->RegenerateTables();
+        TS_ASSERT_EQUALS(cache_dir.FindMatches("*.lut").size(), 2u);
+        TS_ASSERT_EQUALS(opt.GetIIonic(), i_ionic);
+
+        // Tables from the cache are range-checked just the same
+        double v = opt.GetVoltage();
+        opt.SetVoltage(-100000);
+        TS_ASSERT_THROWS_CONTAINS(opt.GetIIonic(), "membrane_voltage outside lookup table range");
+        opt.SetVoltage(v);
+
+        // Memory mapped from the cache can be freed as usual
+        p_tables->FreeMemory();
+        p_tables->RegenerateTables();
+        TS_ASSERT_EQUALS(opt.GetIIonic(), i_ionic);
+
+        // Tidy up for other tests
+        AbstractLookupTableCollection::SetCacheDirectory("");
+        p_tables->SetTableProperties("membrane_voltage", default_min, default_step, default_max);
+        p_tables->RegenerateTables();
+        TS_ASSERT_EQUALS(cache_dir.FindMatches("*.lut").size(), 2u);
+    }
+
     void TestModelWithNoIntracellularCalcium() throw(Exception)
     {
         boost::shared_ptr<AbstractStimulusFunction> p_stimulus;
@@ -43,6 +43,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CardiacSimulationArchiver.hpp"
 
 #include <vector>
+#include <set>
+#include <sstream>
 
 #include "SimpleStimulus.hpp"
 #include "EulerIvpOdeSolver.hpp"
@@ -59,6 +61,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ArchiveOpener.hpp"
 #include "DiFrancescoNoble1985.hpp"
 #include "MonodomainProblem.hpp"
+#include "LuoRudy1991Cvode.hpp"
+#include "Warnings.hpp"
 
 #include "PetscSetupAndFinalize.hpp"
 
@@ -127,6 +131,134 @@ public:
     }
 };
 
+/**
+ * A cell whose solve always fails, to test how SolveCellSystems reports failures.
+ */
+class FailingLuoRudyCell : public CellLuoRudy1991FromCellML
+{
+private:
+    /** The node this cell is at, for the error message. */
+    unsigned mNodeIndex;
+
+public:
+    FailingLuoRudyCell(boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+                       boost::shared_ptr<AbstractStimulusFunction> pStimulus,
+                       unsigned nodeIndex)
+        : CellLuoRudy1991FromCellML(pSolver, pStimulus),
+          mNodeIndex(nodeIndex)
+    {
+    }
+
+    void ComputeExceptVoltage(double tStart, double tEnd)
+    {
+        EXCEPTION("Cell at node " << mNodeIndex << " failed");
+    }
+};
+
+#ifdef CHASTE_CVODE
+/**
+ * A CVODE cell whose first solve fails, so that SolveCellSystems resets it.
+ */
+class ResetOnceLuoRudyCvodeCell : public CellLuoRudy1991FromCellMLCvode
+{
+private:
+    /** Whether the cell has failed yet. */
+    bool mHasFailed;
+
+public:
+    ResetOnceLuoRudyCvodeCell(boost::shared_ptr<AbstractIvpOdeSolver> pSolver,
+                              boost::shared_ptr<AbstractStimulusFunction> pStimulus)
+        : CellLuoRudy1991FromCellMLCvode(pSolver, pStimulus),
+          mHasFailed(false)
+    {
+    }
+
+    void ComputeExceptVoltage(double tStart, double tEnd)
+    {
+        if (!mHasFailed)
+        {
+            mHasFailed = true;
+            EXCEPTION("CVODE failed");
+        }
+        CellLuoRudy1991FromCellMLCvode::ComputeExceptVoltage(tStart, tEnd);
+    }
+};
+#endif // CHASTE_CVODE
+
+class FailingCellFactory : public AbstractCardiacCellFactory<1>
+{
+private:
+    std::set<unsigned> mFailingNodes;
+    std::set<unsigned> mResetNodes;
+
+public:
+    FailingCellFactory(const std::set<unsigned>& rFailingNodes,
+                       const std::set<unsigned>& rResetNodes=std::set<unsigned>())
+        : AbstractCardiacCellFactory<1>(),
+          mFailingNodes(rFailingNodes),
+          mResetNodes(rResetNodes)
+    {
+    }
+
+    AbstractCardiacCellInterface* CreateCardiacCellForTissueNode(Node<1>* pNode)
+    {
+        unsigned node_index = pNode->GetIndex();
+        if (mFailingNodes.count(node_index))
+        {
+            return new FailingLuoRudyCell(mpSolver, mpZeroStimulus, node_index);
+        }
+#ifdef CHASTE_CVODE
+        if (mResetNodes.count(node_index))
+        {
+            return new ResetOnceLuoRudyCvodeCell(mpSolver, mpZeroStimulus);
+        }
+#endif // CHASTE_CVODE
+        return new CellLuoRudy1991FromCellML(mpSolver, mpZeroStimulus);
+    }
+};
+
+/**
+ * Makes the cell at x=0.2 about 100 times as expensive to solve as the others.
+ */
+class OneExpensiveCellFactory : public AbstractCardiacCellFactory<1>
+{
+public:
+    AbstractCardiacCellInterface* CreateCardiacCellForTissueNode(Node<1>* pNode)
+    {
+        AbstractCardiacCellInterface* p_cell = new CellLuoRudy1991FromCellML(mpSolver, mpZeroStimulus);
+        if (fabs(pNode->rGetLocation()[0] - 0.2) < 1e-6)
+        {
+            p_cell->SetTimestep(0.0001);
+        }
+        return p_cell;
+    }
+};
+
+/**
+ * Stimulates node 0 with a pulse from t=1.33ms to t=1.35ms, which is within a 0.1ms PDE step.
+ */
+class ShortPulseCellFactory : public AbstractCardiacCellFactory<1>
+{
+private:
+    boost::shared_ptr<SimpleStimulus> mpStimulus;
+
+public:
+    ShortPulseCellFactory()
+        : AbstractCardiacCellFactory<1>(),
+          mpStimulus(new SimpleStimulus(-80.0, 0.02, 1.33))
+    {
+    }
+
+    AbstractCardiacCellInterface* CreateCardiacCellForTissueNode(Node<1>* pNode)
+    {
+        if (pNode->GetIndex() == 0u)
+        {
+            return new CellLuoRudy1991FromCellML(mpSolver, mpStimulus);
+        }
+        return new CellLuoRudy1991FromCellML(mpSolver, mpZeroStimulus);
+    }
+};
+
 class TestMonodomainTissue : public CxxTest::TestSuite
 {
 public:
@@ -316,6 +448,348 @@ public:
         PetscTools::Destroy(voltage2);
     }
 
+    void TestCachesOnlyStoreHaloNodes() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0); // 11 nodes
+
+        MyCardiacCellFactory cell_factory; // Node 0 is stimulated for the first 0.5ms
+        cell_factory.SetMesh(&mesh);
+
+        MonodomainTissue<1> monodomain_tissue( &cell_factory );
+        TS_ASSERT(monodomain_tissue.GetDoCacheReplication());
+
+        // In 1D each process has at most one halo node at either end of its nodes
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+        GhostedVector& r_stimulus_cache = monodomain_tissue.rGetIntracellularStimulusCacheReplicated();
+        TS_ASSERT_EQUALS(r_stimulus_cache.GetSize(), 11u);
+        TS_ASSERT_LESS_THAN_EQUALS(r_stimulus_cache.GetNumGhosts(), 2u);
+        if (PetscTools::IsSequential())
+        {
+            TS_ASSERT_EQUALS(r_stimulus_cache.GetNumGhosts(), 0u);
+        }
+
+        Vec voltage = PetscTools::CreateAndSetVec(11, -83.853);
+        monodomain_tissue.SolveCellSystems(voltage, 0.0, 0.1);
+
+        // Local and halo entries are filled in, including node 0 when it is a halo node
+        unsigned low = p_factory->GetLow();
+        unsigned high = p_factory->GetHigh();
+        unsigned first = (low > 0u) ? low-1 : low;
+        unsigned last = (high < 11u) ? high+1 : high;
+        for (unsigned node_index=first; node_index<last; node_index++)
+        {
+            TS_ASSERT_EQUALS(r_stimulus_cache[node_index], (node_index == 0u) ? -80.0 : 0.0);
+        }
+
+        // Other entries are not stored at all
+        if (last < 11u)
+        {
+            TS_ASSERT_THROWS_CONTAINS(r_stimulus_cache[last], "is neither owned by this process nor a ghost");
+        }
+
+        PetscTools::Destroy(voltage);
+    }
+
+    void TestSkipQuiescentCells() throw(Exception)
+    {
+        if (PetscTools::GetNumProcs() > 2u)
+        {
+            // There are only 2 nodes in this simulation
+            TS_TRACE("This test is not suitable for more than 2 processes.");
+            return;
+        }
+        HeartConfig::Instance()->Reset();
+        HeartConfig::Instance()->SetSkipQuiescentCells(true, 0.1, 1e-2);
+        TetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(1.0, 1.0); // [0,1] with h=1.0, i.e. a 2 node mesh
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+
+        MyCardiacCellFactory cell_factory; // Node 0 is stimulated for the first 0.5ms
+        cell_factory.SetMesh(&mesh);
+
+        MonodomainTissue<1> monodomain_tissue( &cell_factory );
+
+        // Hold the voltage at rest for 1ms
+        Vec voltage = PetscTools::CreateAndSetVec(2, -83.853);
+        for (unsigned step=0; step<10; step++)
+        {
+            monodomain_tissue.SolveCellSystems(voltage, 0.1*step, 0.1*(step+1));
+        }
+
+        std::map<unsigned, unsigned> num_solves;
+        std::map<unsigned, unsigned> num_skipped;
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        unsigned num_local_cells = p_factory->GetLocalOwnership();
+        TS_ASSERT_EQUALS(num_solves.size(), 1u);
+        TS_ASSERT_EQUALS(num_solves[0], 10u*num_local_cells);
+
+        // The unstimulated cell is solved once, then skipped; the stimulated one is solved while stimulated
+        unsigned expected_min_skipped = 0u;
+        unsigned expected_max_skipped = 0u;
+        if (p_factory->IsGlobalIndexLocal(0))
+        {
+            expected_max_skipped += 4u;
+        }
+        if (p_factory->IsGlobalIndexLocal(1))
+        {
+            expected_min_skipped += 9u;
+            expected_max_skipped += 9u;
+        }
+        TS_ASSERT_LESS_THAN_EQUALS(expected_min_skipped, num_skipped[0]);
+        TS_ASSERT_LESS_THAN_EQUALS(num_skipped[0], expected_max_skipped);
+
+        // A quiescent cell keeps its state...
+        std::vector<double> state_before;
+        if (p_factory->IsGlobalIndexLocal(1))
+        {
+            state_before = monodomain_tissue.GetCardiacCell(1)->GetStdVecStateVariables();
+        }
+        monodomain_tissue.SolveCellSystems(voltage, 1.0, 1.1);
+        if (p_factory->IsGlobalIndexLocal(1))
+        {
+            std::vector<double> state_after = monodomain_tissue.GetCardiacCell(1)->GetStdVecStateVariables();
+            TS_ASSERT_EQUALS(state_after.size(), state_before.size());
+            for (unsigned i=0; i<state_after.size(); i++)
+            {
+                TS_ASSERT_EQUALS(state_after[i], state_before[i]);
+            }
+        }
+
+        // ...until its voltage changes
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        unsigned num_skipped_before = num_skipped[0];
+        Vec voltage2 = PetscTools::CreateAndSetVec(2, -70.0);
+        monodomain_tissue.SolveCellSystems(voltage2, 1.1, 1.2);
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        TS_ASSERT_EQUALS(num_solves[0], 12u*num_local_cells);
+        TS_ASSERT_EQUALS(num_skipped[0], num_skipped_before);
+        if (p_factory->IsGlobalIndexLocal(1))
+        {
+            std::vector<double> state_after = monodomain_tissue.GetCardiacCell(1)->GetStdVecStateVariables();
+            bool state_changed = false;
+            for (unsigned i=0; i<state_after.size(); i++)
+            {
+                state_changed = state_changed || (state_after[i] != state_before[i]);
+            }
+            TS_ASSERT(state_changed);
+        }
+
+        // Switching the mode off solves every cell again
+        monodomain_tissue.SetSkipQuiescentCells(false, 0.1, 1e-2);
+        monodomain_tissue.SolveCellSystems(voltage2, 1.2, 1.3);
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        TS_ASSERT(num_solves.empty());
+        TS_ASSERT(num_skipped.empty());
+
+        PetscTools::Destroy(voltage);
+        PetscTools::Destroy(voltage2);
+        HeartConfig::Instance()->Reset();
+    }
+
+    void TestSkipQuiescentCellsSeesPulseWithinStep() throw(Exception)
+    {
+        if (PetscTools::GetNumProcs() > 2u)
+        {
+            // There are only 2 nodes in this simulation
+            TS_TRACE("This test is not suitable for more than 2 processes.");
+            return;
+        }
+        HeartConfig::Instance()->Reset();
+        HeartConfig::Instance()->SetSkipQuiescentCells(true, 0.1, 1e-2);
+        TetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(1.0, 1.0); // 2 nodes
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+
+        ShortPulseCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> monodomain_tissue( &cell_factory );
+
+        // Both cells rest, and become quiescent
+        Vec voltage = PetscTools::CreateAndSetVec(2, -83.853);
+        for (unsigned step=0; step<13; step++)
+        {
+            monodomain_tissue.SolveCellSystems(voltage, 0.1*step, 0.1*(step+1));
+        }
+        std::map<unsigned, unsigned> num_solves;
+        std::map<unsigned, unsigned> num_skipped;
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        unsigned num_skipped_before = num_skipped[0];
+        TS_ASSERT_LESS_THAN(0u, num_skipped_before);
+
+        // The stimulus is zero at both ends of this step, but the cell at node 0 must still be solved
+        std::vector<double> state_before;
+        if (p_factory->IsGlobalIndexLocal(0))
+        {
+            TS_ASSERT_EQUALS(monodomain_tissue.GetCardiacCell(0)->GetIntracellularStimulus(1.3), 0.0);
+            TS_ASSERT_EQUALS(monodomain_tissue.GetCardiacCell(0)->GetIntracellularStimulus(1.4), 0.0);
+            state_before = monodomain_tissue.GetCardiacCell(0)->GetStdVecStateVariables();
+        }
+        monodomain_tissue.SolveCellSystems(voltage, 1.3, 1.4);
+        monodomain_tissue.GetQuiescentCellStatistics(num_solves, num_skipped);
+        if (p_factory->IsGlobalIndexLocal(0))
+        {
+            std::vector<double> state_after = monodomain_tissue.GetCardiacCell(0)->GetStdVecStateVariables();
+            bool state_changed = false;
+            for (unsigned i=0; i<state_after.size(); i++)
+            {
+                state_changed = state_changed || (state_after[i] != state_before[i]);
+            }
+            TS_ASSERT(state_changed);
+        }
+        // Only the cell at node 1 can have been skipped
+        TS_ASSERT_LESS_THAN_EQUALS(num_skipped[0], num_skipped_before + (p_factory->IsGlobalIndexLocal(1) ? 1u : 0u));
+
+        PetscTools::Destroy(voltage);
+        HeartConfig::Instance()->Reset();
+    }
+
+    void TestSolveCellSystemsReportsFirstFailure() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0); // 101 nodes
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+
+        // These are far enough apart to be solved by different threads if Chaste is built with OpenMP
+        std::set<unsigned> failing_nodes;
+        failing_nodes.insert(99u);
+        failing_nodes.insert(40u);
+        failing_nodes.insert(75u);
+        FailingCellFactory cell_factory(failing_nodes);
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> tissue( &cell_factory );
+
+        // Whatever order the threads run in, each process reports its lowest failing node
+        std::string expected_message = "Another process threw an exception; bailing out.";
+        for (std::set<unsigned>::iterator it = failing_nodes.begin(); it != failing_nodes.end(); ++it)
+        {
+            if (p_factory->IsGlobalIndexLocal(*it))
+            {
+                std::stringstream message;
+                message << "Cell at node " << *it << " failed";
+                expected_message = message.str();
+                break;
+            }
+        }
+
+        Vec voltage = PetscTools::CreateAndSetVec(101, -83.853);
+        for (unsigned repeat=0; repeat<3; repeat++)
+        {
+            TS_ASSERT_THROWS_CONTAINS(tissue.SolveCellSystems(voltage, 0.0, 0.1), expected_message);
+        }
+        PetscTools::Destroy(voltage);
+    }
+
+    void TestCvodeResetWarningsAreInNodeOrder() throw(Exception)
+    {
+#ifdef CHASTE_CVODE
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0); // 101 nodes
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+
+        std::set<unsigned> reset_nodes;
+        reset_nodes.insert(90u);
+        reset_nodes.insert(20u);
+        reset_nodes.insert(55u);
+        Vec voltage = PetscTools::CreateAndSetVec(101, -83.853);
+
+        // Every reset is warned about, in node order
+        {
+            Warnings::QuietDestroy();
+            FailingCellFactory cell_factory(std::set<unsigned>(), reset_nodes);
+            cell_factory.SetMesh(&mesh);
+            MonodomainTissue<1> tissue( &cell_factory );
+            tissue.SolveCellSystems(voltage, 0.0, 0.1);
+
+            for (std::set<unsigned>::iterator it = reset_nodes.begin(); it != reset_nodes.end(); ++it)
+            {
+                if (p_factory->IsGlobalIndexLocal(*it))
+                {
+                    std::stringstream message;
+                    message << "Global node " << *it << " had an ODE solving problem";
+                    TS_ASSERT_EQUALS(Warnings::Instance()->GetNextWarningMessage().find(message.str()), 0u);
+                }
+            }
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNumWarnings(), 0u);
+
+            // The cells recover, so there are no more warnings
+            tissue.SolveCellSystems(voltage, 0.1, 0.2);
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNumWarnings(), 0u);
+        }
+
+        // Resets after the first failure aren't warned about, since a serial solve wouldn't reach them
+        {
+            Warnings::QuietDestroy();
+            std::set<unsigned> failing_nodes;
+            failing_nodes.insert(70u);
+            FailingCellFactory cell_factory(failing_nodes, reset_nodes);
+            cell_factory.SetMesh(&mesh);
+            MonodomainTissue<1> tissue( &cell_factory );
+            TS_ASSERT_THROWS_ANYTHING(tissue.SolveCellSystems(voltage, 0.0, 0.1));
+
+            bool failed_before = false;
+            for (std::set<unsigned>::iterator it = reset_nodes.begin(); it != reset_nodes.end(); ++it)
+            {
+                failed_before = failed_before || (*it > 70u && p_factory->IsGlobalIndexLocal(70u));
+                if (p_factory->IsGlobalIndexLocal(*it) && !failed_before)
+                {
+                    std::stringstream message;
+                    message << "Global node " << *it << " had an ODE solving problem";
+                    TS_ASSERT_EQUALS(Warnings::Instance()->GetNextWarningMessage().find(message.str()), 0u);
+                }
+            }
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNumWarnings(), 0u);
+        }
+
+        Warnings::QuietDestroy();
+        PetscTools::Destroy(voltage);
+#endif // CHASTE_CVODE
+    }
+
+    void TestNodeWeightsFromCellCostsOnPermutedMesh() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        TetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0); // 101 nodes, the expensive cell is at original node 20
+        const unsigned num_nodes = mesh.GetNumNodes();
+        std::vector<unsigned> permutation(num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            permutation[i] = num_nodes-1-i;
+        }
+        mesh.PermuteNodes(permutation);
+        TS_ASSERT_DELTA(mesh.GetNode(80u)->rGetLocation()[0], 0.2, 1e-12);
+
+        OneExpensiveCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> tissue( &cell_factory );
+        tissue.SetMeasureCellCosts();
+
+        Vec voltage = PetscTools::CreateAndSetVec(num_nodes, -83.853);
+        for (unsigned step=0; step<10; step++)
+        {
+            tissue.SolveCellSystems(voltage, 0.1*step, 0.1*(step+1));
+        }
+        PetscTools::Destroy(voltage);
+
+        // Indexed as in the mesh file, for DistributedTetrahedralMesh::SetNodeWeights()...
+        std::vector<unsigned> weights = tissue.GetNodeWeightsFromCellCosts(50u);
+        TS_ASSERT_EQUALS(weights.size(), num_nodes);
+        TS_ASSERT_EQUALS(weights[20], 50u);
+        TS_ASSERT_LESS_THAN(weights[80], 50u);
+
+        // ...or by current global index, for CardiacSimulationArchiver::Migrate()
+        std::vector<unsigned> permuted_weights = tissue.GetNodeWeightsFromCellCosts(50u, false);
+        TS_ASSERT_EQUALS(permuted_weights.size(), num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_EQUALS(permuted_weights[permutation[i]], weights[i]);
+        }
+    }
+
     void TestNodeExchange() throw(Exception)
     {
         HeartConfig::Instance()->Reset();
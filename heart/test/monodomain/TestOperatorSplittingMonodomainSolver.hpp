@@ -41,6 +41,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include "MonodomainProblem.hpp"
 #include "ZeroStimulusCellFactory.hpp"
 #include "AbstractCardiacCellFactory.hpp"
@@ -92,6 +94,79 @@ public:
 
 class TestOperatorSplittingMonodomainSolver : public CxxTest::TestSuite
 {
+private:
+
+    /**
+     * Run the block stimulus problem with operator splitting and return the final voltage.
+     *
+     * @param pdeTimeStep  the PDE time step
+     * @param useCrankNicolson  whether the diffusion step uses Crank-Nicolson
+     * @param mergeHalfSteps  whether to merge the ODE half-steps
+     * @param rFinalVoltage  filled in with the final voltage
+     */
+    void RunOperatorSplitting(double pdeTimeStep, bool useCrankNicolson, bool mergeHalfSteps,
+                              ReplicatableVector& rFinalVoltage)
+    {
+        HeartConfig::Instance()->SetSimulationDuration(4.0); //ms
+        HeartConfig::Instance()->SetOutputFilenamePrefix("results");
+        HeartConfig::Instance()->SetOutputDirectory("MonodomainOperatorSplittingSchemes");
+        HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.0025, pdeTimeStep, 0.2);
+        HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting();
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting(useCrankNicolson);
+        HeartConfig::Instance()->SetMergeOperatorSplittingOdeHalfSteps(mergeHalfSteps);
+
+        TetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0);
+        BlockCellFactory<1> cell_factory;
+
+        MonodomainProblem<1> monodomain_problem( &cell_factory );
+        monodomain_problem.SetMesh(&mesh);
+        monodomain_problem.Initialise();
+        monodomain_problem.Solve();
+
+        rFinalVoltage.ReplicatePetscVector(monodomain_problem.GetSolution());
+    }
+
+    /**
+     * @return the 2-norm of the difference between two voltage vectors
+     *
+     * @param rFirst  the first vector
+     * @param rSecond  the second vector
+     */
+    double L2Difference(ReplicatableVector& rFirst, ReplicatableVector& rSecond)
+    {
+        assert(rFirst.GetSize() == rSecond.GetSize());
+        double sum_sq = 0.0;
+        for (unsigned j=0; j<rFirst.GetSize(); j++)
+        {
+            sum_sq += (rFirst[j] - rSecond[j])*(rFirst[j] - rSecond[j]);
+        }
+        return sqrt(sum_sq);
+    }
+
+    /**
+     * Run a scheme with PDE time steps 0.04, 0.02 and 0.01ms and return its observed order of
+     * convergence in time, log2 of the ratio of successive differences.  This needs no reference
+     * solution, so does not favour either scheme.
+     *
+     * @param useCrankNicolson  whether the diffusion step uses Crank-Nicolson
+     * @return the observed order
+     */
+    double MeasureTimeStepOrder(bool useCrankNicolson)
+    {
+        ReplicatableVector coarse_voltage;
+        RunOperatorSplitting(0.04, useCrankNicolson, false, coarse_voltage);
+        ReplicatableVector medium_voltage;
+        RunOperatorSplitting(0.02, useCrankNicolson, false, medium_voltage);
+        ReplicatableVector fine_voltage;
+        RunOperatorSplitting(0.01, useCrankNicolson, false, fine_voltage);
+
+        double coarse_difference = L2Difference(coarse_voltage, medium_voltage);
+        double fine_difference = L2Difference(medium_voltage, fine_voltage);
+        assert(fine_difference > 0.0);
+        return log(coarse_difference/fine_difference)/log(2.0);
+    }
+
 public:
 
     // The operator splitting and normal methods should agree closely with very small dt and h, but this takes
@@ -170,6 +245,32 @@ public:
         UNUSED_OPT(some_node_depolarised);
         assert(some_node_depolarised);
     }
+
+    void TestCrankNicolsonAndMergedHalfSteps() throw(Exception)
+    {
+        double backward_euler_order = MeasureTimeStepOrder(false);
+        double crank_nicolson_order = MeasureTimeStepOrder(true);
+        std::cout << "Observed order in the PDE time step: backward Euler " << backward_euler_order
+                  << ", Crank-Nicolson " << crank_nicolson_order << "\n";
+
+        // Strang splitting with Crank-Nicolson diffusion is second order, with backward Euler only first order
+        TS_ASSERT_LESS_THAN(1.5, crank_nicolson_order);
+        TS_ASSERT_LESS_THAN(backward_euler_order + 0.5, crank_nicolson_order);
+
+        ReplicatableVector crank_nicolson_voltage;
+        RunOperatorSplitting(0.02, true, false, crank_nicolson_voltage);
+        ReplicatableVector merged_voltage;
+        RunOperatorSplitting(0.02, true, true, merged_voltage);
+        for (unsigned j=0; j<crank_nicolson_voltage.GetSize(); j++)
+        {
+            // Each half-step is a whole number of ODE steps, so merging them takes exactly the same ODE steps
+            TS_ASSERT_DELTA(merged_voltage[j], crank_nicolson_voltage[j], 1e-6);
+        }
+
+        HeartConfig::Instance()->SetUseReactionDiffusionOperatorSplitting(false);
+        HeartConfig::Instance()->SetUseCrankNicolsonOperatorSplitting(false);
+        HeartConfig::Instance()->SetMergeOperatorSplittingOdeHalfSteps(false);
+    }
 };
 
 #endif /* TESTOPERATORSPLITTINGMONODOMAINSOLVER_HPP_ */
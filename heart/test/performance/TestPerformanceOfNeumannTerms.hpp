@@ -0,0 +1,139 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTPERFORMANCEOFNEUMANNTERMS_HPP_
+#define TESTPERFORMANCEOFNEUMANNTERMS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+
+#include "MonodomainProblem.hpp"
+#include "LuoRudy1991.hpp"
+#include "ZeroStimulusCellFactory.hpp"
+#include "ConstBoundaryCondition.hpp"
+#include "ReplicatableVector.hpp"
+#include "HeartEventHandler.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+/*
+ * Compares the time spent adding Neumann boundary condition terms to the right-hand side with and
+ * without HeartConfig::SetUsePrecomputedNeumannTerms(), for a slab stimulated through one face.
+ */
+class TestPerformanceOfNeumannTerms : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Run the simulation and return the time spent on Neumann boundary conditions.
+     *
+     * @param usePrecomputedNeumannTerms  whether to store the Neumann terms
+     * @param rVoltage  filled in with the final voltage
+     */
+    double RunSimulation(bool usePrecomputedNeumannTerms, std::vector<double>& rVoltage)
+    {
+        HeartConfig::Instance()->SetIntracellularConductivities(Create_c_vector(1.75, 1.75, 1.75));
+        HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+        HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 1.0);
+        HeartConfig::Instance()->SetOutputDirectory("NeumannTermsPerformance");
+        HeartConfig::Instance()->SetOutputFilenamePrefix("results");
+        HeartConfig::Instance()->SetUsePrecomputedNeumannTerms(usePrecomputedNeumannTerms);
+
+        TetrahedralMesh<3,3> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 0.2, 0.2, 0.05);
+
+        ZeroStimulusCellFactory<CellLuoRudy1991FromCellML, 3> cell_factory;
+        MonodomainProblem<3> monodomain_problem(&cell_factory);
+        monodomain_problem.SetMesh(&mesh);
+        monodomain_problem.Initialise();
+        HeartConfig::Instance()->SetSurfaceAreaToVolumeRatio(1*1.75/0.0005);
+
+        // Stimulate through the face x=0
+        boost::shared_ptr<BoundaryConditionsContainer<3,3,1> > p_bcc(new BoundaryConditionsContainer<3,3,1>);
+        ConstBoundaryCondition<3>* p_bc_stim = new ConstBoundaryCondition<3>(2*1.75/0.0005);
+        for (TetrahedralMesh<3,3>::BoundaryElementIterator iter = mesh.GetBoundaryElementIteratorBegin();
+             iter != mesh.GetBoundaryElementIteratorEnd();
+             ++iter)
+        {
+            if ((*iter)->CalculateCentroid()[0] < 1e-6)
+            {
+                p_bcc->AddNeumannBoundaryCondition(*iter, p_bc_stim);
+            }
+        }
+        monodomain_problem.SetBoundaryConditionsContainer(p_bcc);
+
+        HeartEventHandler::Reset();
+        monodomain_problem.Solve();
+        double neumann_time = HeartEventHandler::GetElapsedTime(HeartEventHandler::NEUMANN_BCS);
+
+        ReplicatableVector voltage(monodomain_problem.GetSolution());
+        rVoltage.resize(voltage.GetSize());
+        for (unsigned i=0; i<voltage.GetSize(); i++)
+        {
+            rVoltage[i] = voltage[i];
+        }
+
+        HeartConfig::Reset();
+        return neumann_time;
+    }
+
+public:
+
+    void TestPrecomputedNeumannTerms() throw(Exception)
+    {
+        std::vector<double> voltage_assembled;
+        double time_assembled = RunSimulation(false, voltage_assembled);
+
+        std::vector<double> voltage_precomputed;
+        double time_precomputed = RunSimulation(true, voltage_precomputed);
+
+        // The stored terms are the same integrals, so only rounding errors differ
+        TS_ASSERT_EQUALS(voltage_precomputed.size(), voltage_assembled.size());
+        for (unsigned i=0; i<voltage_assembled.size(); i++)
+        {
+            TS_ASSERT_DELTA(voltage_precomputed[i], voltage_assembled[i], 1e-8);
+        }
+
+        // Make sure something happened
+        TS_ASSERT_LESS_THAN(-80.0, voltage_assembled[0]);
+
+        std::cout << "Time spent on Neumann boundary conditions over 200 PDE time steps:\n"
+                  << "  assembled every time step: " << time_assembled << " ms\n"
+                  << "  assembled once:            " << time_precomputed << " ms\n";
+        TS_ASSERT_LESS_THAN(time_precomputed, time_assembled);
+    }
+};
+
+#endif /*TESTPERFORMANCEOFNEUMANNTERMS_HPP_*/
@@ -52,6 +52,18 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "MultiStimulus.hpp"
 #include "OutputFileHandler.hpp"
 
+/**
+ * A stimulus with no IsZeroBetween() of its own, to test the sampling default.
+ */
+class PulseAtOneStimulus : public AbstractStimulusFunction
+{
+public:
+    double GetStimulus(double time)
+    {
+        return (time >= 1.0 && time <= 1.05) ? 1.0 : 0.0;
+    }
+};
+
 class TestStimulus : public CxxTest::TestSuite
 {
 public:
@@ -421,6 +433,59 @@ public:
         }
     }
 
+    void TestIsZeroBetween()
+    {
+        ZeroStimulus zero_stim;
+        TS_ASSERT(zero_stim.IsZeroBetween(0.0, 100.0, 0.01));
+
+        // A pulse inside the interval but not at either end is seen
+        SimpleStimulus simple_stim(-80.0, 0.1, 5.0);
+        TS_ASSERT(simple_stim.IsZeroBetween(0.0, 4.9, 0.01));
+        TS_ASSERT(!simple_stim.IsZeroBetween(4.9, 5.0, 0.01));
+        TS_ASSERT(!simple_stim.IsZeroBetween(4.0, 6.0, 0.01));
+        TS_ASSERT_EQUALS(simple_stim.GetStimulus(4.0), 0.0);
+        TS_ASSERT_EQUALS(simple_stim.GetStimulus(6.0), 0.0);
+        TS_ASSERT(!simple_stim.IsZeroBetween(5.05, 6.0, 0.01));
+        TS_ASSERT(simple_stim.IsZeroBetween(5.11, 6.0, 0.01));
+        SimpleStimulus no_stim(0.0, 0.1, 5.0);
+        TS_ASSERT(no_stim.IsZeroBetween(4.0, 6.0, 0.01));
+
+        // Pulses for 0.5ms every 10ms, from t=2 until t=31
+        RegularStimulus regular_stim(-80.0, 0.5, 10.0, 2.0, 31.0);
+        TS_ASSERT(regular_stim.IsZeroBetween(0.0, 1.9, 0.01));
+        TS_ASSERT(!regular_stim.IsZeroBetween(1.0, 3.0, 0.01));
+        TS_ASSERT(regular_stim.IsZeroBetween(2.6, 11.9, 0.01));
+        TS_ASSERT(!regular_stim.IsZeroBetween(2.6, 12.1, 0.01));
+        TS_ASSERT(!regular_stim.IsZeroBetween(12.2, 12.3, 0.01));
+        TS_ASSERT(!regular_stim.IsZeroBetween(11.0, 13.0, 0.01));
+        TS_ASSERT(!regular_stim.IsZeroBetween(2.6, 100.0, 0.01));
+        TS_ASSERT(regular_stim.IsZeroBetween(32.6, 100.0, 0.01)); // stopped
+        for (unsigned i=0; i<400; i++)
+        {
+            // Agrees with fine sampling, away from the edges of the pulses
+            double start = 0.05 + 0.1*i;
+            TS_ASSERT_EQUALS(regular_stim.IsZeroBetween(start, start+0.3, 0.01),
+                             regular_stim.AbstractStimulusFunction::IsZeroBetween(start, start+0.3, 0.001));
+        }
+
+        MultiStimulus multi_stim;
+        TS_ASSERT(multi_stim.IsZeroBetween(0.0, 100.0, 0.01));
+        boost::shared_ptr<SimpleStimulus> p_simple_stim(new SimpleStimulus(-80.0, 0.1, 5.0));
+        boost::shared_ptr<RegularStimulus> p_regular_stim(new RegularStimulus(-80.0, 0.5, 10.0, 2.0, 31.0));
+        multi_stim.AddStimulus(p_simple_stim);
+        multi_stim.AddStimulus(p_regular_stim);
+        TS_ASSERT(multi_stim.IsZeroBetween(2.6, 4.9, 0.01));
+        TS_ASSERT(!multi_stim.IsZeroBetween(4.0, 6.0, 0.01));
+        TS_ASSERT(!multi_stim.IsZeroBetween(11.0, 13.0, 0.01));
+
+        // Stimuli without their own method are sampled, so only see pulses longer than the sample interval
+        PulseAtOneStimulus pulse_stim;
+        TS_ASSERT(pulse_stim.IsZeroBetween(0.0, 0.99, 0.01));
+        TS_ASSERT(!pulse_stim.IsZeroBetween(0.0, 2.0, 0.01));
+        TS_ASSERT(!pulse_stim.IsZeroBetween(0.0, 1.0, 0.5));
+        TS_ASSERT(pulse_stim.IsZeroBetween(0.7, 1.3, 0.5));
+    }
+
     void TestArchivingStimuli() throw(Exception)
     {
         OutputFileHandler handler("archive",false);
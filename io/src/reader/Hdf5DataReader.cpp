@@ -108,6 +108,32 @@ void Hdf5DataReader::CommonConstructor()
         assert(mDatasetDims[i] == dataset_max_sizes[i]);
     }
 
+    // Find out how the data is stored.  HDF5 converts it back to doubles when we read it,
+    // but can only undo compression if the filters used by the writer are available here.
+    hid_t data_type = H5Dget_type(mVariablesDatasetId);
+    mDataPrecision = H5Tget_size(data_type);
+    H5Tclose(data_type);
+
+    hid_t dcpl = H5Dget_create_plist(mVariablesDatasetId);
+    int num_filters = H5Pget_nfilters(dcpl);
+    for (int i=0; i<num_filters; i++)
+    {
+        unsigned flags;
+        size_t num_values = 0;
+        char filter_name[MAX_STRING_SIZE];
+        H5Z_filter_t filter_id = H5Pget_filter(dcpl, i, &flags, &num_values, NULL, MAX_STRING_SIZE, filter_name);
+        if (H5Zfilter_avail(filter_id) <= 0)
+        {
+            H5Pclose(dcpl);
+            H5Sclose(variables_dataspace);
+            H5Dclose(mVariablesDatasetId);
+            H5Fclose(mFileId);
+            EXCEPTION("The dataset '" << mDatasetName << "' in " << file_name << " is compressed with the HDF5 filter '"
+                      << filter_name << "', which is not available in this HDF5 library.");
+        }
+    }
+    H5Pclose(dcpl);
+
     // Check if an unlimited dimension has been defined
     if (dataset_max_sizes[0] == H5S_UNLIMITED)
     {
@@ -444,6 +470,11 @@ unsigned Hdf5DataReader::GetNumberOfRows()
     return mDatasetDims[1];
 }
 
+unsigned Hdf5DataReader::GetDataPrecision()
+{
+    return mDataPrecision;
+}
+
 std::vector<std::string> Hdf5DataReader::GetVariableNames()
 {
     return mVariableNames;
@@ -66,6 +66,8 @@ private:
 
     bool mClosed;                                           /**< Whether we've already closed the file. */
 
+    unsigned mDataPrecision;                                /**< The number of bytes used to store each value of the main dataset in the file. */
+
     /**
      * Contains functionality common to both constructors.
      */
@@ -149,6 +151,13 @@ public:
      */
     std::string GetUnit(const std::string& rVariableName);
 
+    /**
+     * @return the number of bytes used to store each value in the file: 8 for doubles, or 4 if
+     * the file was written with Hdf5DataWriter::SetUseSinglePrecision().  All the Get methods
+     * return doubles whatever the precision of the file.
+     */
+    unsigned GetDataPrecision();
+
     /**
      * Close any open files.
      */
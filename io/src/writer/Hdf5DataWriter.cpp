@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * Implementation file for Hdf5DataWriter class.
  *
  */
+#include <algorithm>
 #include <set>
 #include <cstring> //For strcmp etc. Needed in gcc-4.4
 #include <boost/scoped_array.hpp>
@@ -54,7 +55,8 @@ Hdf5DataWriter::Hdf5DataWriter(DistributedVectorFactory& rVectorFactory,
                                const std::string& rBaseName,
                                bool cleanDirectory,
                                bool extendData,
-                               std::string datasetName)
+                               std::string datasetName,
+                               bool useCache)
     : AbstractHdf5Access(rDirectory, rBaseName, datasetName),
       mrVectorFactory(rVectorFactory),
       mCleanDirectory(cleanDirectory),
@@ -76,7 +78,15 @@ Hdf5DataWriter::Hdf5DataWriter(DistributedVectorFactory& rVectorFactory,
       mSingleIncompleteOutputMatrix(NULL),
       mDoubleIncompleteOutputMatrix(NULL),
       mUseOptimalChunkSizeAlgorithm(true),
-      mNumberOfChunks(0u)
+      mNumberOfChunks(0u),
+      mUseCache(useCache),
+      mCacheSize(0u),
+      mCacheFirstTimeStep(0u),
+      mCacheEndTimeStep(0u),
+      mDeflateLevel(0u),
+      mUseShuffle(false),
+      mUseSinglePrecision(false),
+      mScaleOffsetDigits(-1)
 {
     mChunkSize[0] = 0;
     mChunkSize[1] = 0;
@@ -596,8 +606,26 @@ void Hdf5DataWriter::EndDefineMode()
     // Create chunked dataset and clean up
     hid_t cparms = H5Pcreate (H5P_DATASET_CREATE);
     H5Pset_chunk( cparms, DATASET_DIMS, mChunkSize);
+
+    // Add any filters, in the order they are applied on writing
+    if (mScaleOffsetDigits >= 0)
+    {
+        H5Pset_scaleoffset(cparms, H5Z_SO_FLOAT_DSCALE, mScaleOffsetDigits);
+    }
+    if (mDeflateLevel > 0)
+    {
+        if (mUseShuffle)
+        {
+            H5Pset_shuffle(cparms);
+        }
+        H5Pset_deflate(cparms, mDeflateLevel);
+    }
+
+    // HDF5 converts the doubles we write into floats if need be
+    hid_t file_data_type = mUseSinglePrecision ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+
     hid_t filespace = H5Screate_simple(DATASET_DIMS, mDatasetDims, dataset_max_dims);
-    mVariablesDatasetId = H5Dcreate(mFileId, mDatasetName.c_str(), H5T_NATIVE_DOUBLE, filespace, cparms);
+    mVariablesDatasetId = H5Dcreate(mFileId, mDatasetName.c_str(), file_data_type, filespace, cparms);
     SetMainDatasetRawChunkCache(); // Set large cache (even though parallel drivers don't currently use it!)
     H5Sclose(filespace);
     H5Pclose(cparms);
@@ -798,7 +826,7 @@ void Hdf5DataWriter::PutVector(int variableID, Vec petscVector)
 
     if (mIsDataComplete)
     {
-        H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, file_dataspace, property_list_id, p_petsc_vector);
+        WriteOrCacheData(memspace, file_dataspace, property_list_id, p_petsc_vector, variableID, 1u);
     }
     else
     {
@@ -812,7 +840,7 @@ void Hdf5DataWriter::PutVector(int variableID, Vec petscVector)
 
             double* p_petsc_vector_incomplete;
             VecGetArray(output_petsc_vector, &p_petsc_vector_incomplete);
-            H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, file_dataspace, property_list_id, p_petsc_vector_incomplete);
+            WriteOrCacheData(memspace, file_dataspace, property_list_id, p_petsc_vector_incomplete, variableID, 1u);
         }
         else
         {
@@ -823,7 +851,7 @@ void Hdf5DataWriter::PutVector(int variableID, Vec petscVector)
                 local_data[i] = p_petsc_vector[ mIncompleteNodeIndices[mOffset+i]-mLo ];
 
             }
-            H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, file_dataspace, property_list_id, local_data.get());
+            WriteOrCacheData(memspace, file_dataspace, property_list_id, local_data.get(), variableID, 1u);
         }
     }
 
@@ -922,7 +950,7 @@ void Hdf5DataWriter::PutStripedVector(std::vector<int> variableIDs, Vec petscVec
 
     if (mIsDataComplete)
     {
-        H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, hyperslab_space, property_list_id, p_petsc_vector);
+        WriteOrCacheData(memspace, hyperslab_space, property_list_id, p_petsc_vector, firstVariableID, NUM_STRIPES);
     }
     else
     {
@@ -939,7 +967,7 @@ void Hdf5DataWriter::PutStripedVector(std::vector<int> variableIDs, Vec petscVec
                 double* p_petsc_vector_incomplete;
                 VecGetArray(output_petsc_vector, &p_petsc_vector_incomplete);
 
-                H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, hyperslab_space, property_list_id, p_petsc_vector_incomplete);
+                WriteOrCacheData(memspace, hyperslab_space, property_list_id, p_petsc_vector_incomplete, firstVariableID, NUM_STRIPES);
             }
             else
             {
@@ -952,7 +980,7 @@ void Hdf5DataWriter::PutStripedVector(std::vector<int> variableIDs, Vec petscVec
                     local_data[NUM_STRIPES*i+1] = p_petsc_vector[ local_node_number*NUM_STRIPES + 1];
                 }
 
-                H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, hyperslab_space, property_list_id, local_data.get());
+                WriteOrCacheData(memspace, hyperslab_space, property_list_id, local_data.get(), firstVariableID, NUM_STRIPES);
             }
         }
         else
@@ -992,6 +1020,22 @@ void Hdf5DataWriter::PutUnlimitedVariable(double value)
     // Make sure that everything is actually extended to the correct dimension.
     PossiblyExtend();
 
+    if (mUseCache)
+    {
+        // Every process keeps track of the time steps in the cache, but only the master stores the values
+        NoteTimeStepCached();
+        if (PetscTools::AmMaster())
+        {
+            unsigned cache_index = mCurrentTimeStep - mCacheFirstTimeStep;
+            if (mUnlimitedDataCache.size() <= cache_index)
+            {
+                mUnlimitedDataCache.resize(cache_index + 1);
+            }
+            mUnlimitedDataCache[cache_index] = value;
+        }
+        return;
+    }
+
     // This data is only written by the master
     if (!PetscTools::AmMaster())
     {
@@ -1020,6 +1064,8 @@ void Hdf5DataWriter::Close()
         return; // Nothing to do...
     }
 
+    WriteCache();
+
     H5Dclose(mVariablesDatasetId);
     if (mIsUnlimitedDimensionSet)
     {
@@ -1060,6 +1106,12 @@ void Hdf5DataWriter::AdvanceAlongUnlimitedDimension()
 
     mCurrentTimeStep++;
 
+    // Write out the cache if it has no room for this time step
+    if (mCacheEndTimeStep > mCacheFirstTimeStep && mCurrentTimeStep - mCacheFirstTimeStep >= mCacheSize)
+    {
+        WriteCache();
+    }
+
     /*
      * Extend the dataset (only reached when adding to an existing dataset,
      * or if mEstimatedUnlimitedLength hasn't been set and has defaulted to 1).
@@ -1071,6 +1123,135 @@ void Hdf5DataWriter::AdvanceAlongUnlimitedDimension()
     }
 }
 
+void Hdf5DataWriter::SetUpCache()
+{
+    // How many time steps are in each chunk of the dataset?
+    hsize_t chunk_dims[DATASET_DIMS] = {1, 1, 1};
+    hid_t dcpl = H5Dget_create_plist(mVariablesDatasetId);
+    if (H5Pget_layout(dcpl) == H5D_CHUNKED)
+    {
+        H5Pget_chunk(dcpl, DATASET_DIMS, chunk_dims);
+    }
+    H5Pclose(dcpl);
+
+    // How much space does a time step take on the process with the most rows?
+    const unsigned max_bytes = 64*1024*1024; // 64 MB
+    hsize_t max_rows_per_process = CeilDivide((unsigned)mDatasetDims[1], PetscTools::GetNumProcs());
+    hsize_t bytes_per_time_step = std::max(max_rows_per_process * mDatasetDims[2] * sizeof(double), (hsize_t)1u);
+
+    mCacheSize = (unsigned)std::max(max_bytes / bytes_per_time_step, (hsize_t)1u);
+    if (mCacheSize > chunk_dims[0])
+    {
+        mCacheSize -= mCacheSize % chunk_dims[0];
+    }
+}
+
+void Hdf5DataWriter::NoteTimeStepCached()
+{
+    if (mCacheSize == 0u)
+    {
+        SetUpCache();
+    }
+    if (mCacheEndTimeStep == mCacheFirstTimeStep)
+    {
+        // The cache is empty, so starts here
+        mCacheFirstTimeStep = mCurrentTimeStep;
+    }
+    assert(mCurrentTimeStep >= mCacheFirstTimeStep);
+    assert(mCurrentTimeStep - mCacheFirstTimeStep < mCacheSize);
+    mCacheEndTimeStep = std::max(mCacheEndTimeStep, mCurrentTimeStep + 1);
+}
+
+void Hdf5DataWriter::WriteOrCacheData(hid_t memspace, hid_t fileDataspace, hid_t propertyListId, double* pData,
+                                      unsigned firstVariableID, unsigned numVariables)
+{
+    if (!mUseCache || !mIsUnlimitedDimensionSet)
+    {
+        H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, fileDataspace, propertyListId, pData);
+        return;
+    }
+
+    NoteTimeStepCached();
+
+    // Copy the data into the cache, at the same place it would go in the dataset
+    const unsigned num_columns = mDatasetDims[2];
+    const unsigned time_step_size = mNumberOwned * num_columns;
+    const unsigned time_step_start = (mCurrentTimeStep - mCacheFirstTimeStep) * time_step_size;
+    if (mDataCache.size() < time_step_start + time_step_size)
+    {
+        // Anything we don't write is written as zero, HDF5's default fill value
+        mDataCache.resize(time_step_start + time_step_size, 0.0);
+    }
+    for (unsigned i=0; i<mNumberOwned; i++)
+    {
+        double* p_row = &mDataCache[time_step_start + i*num_columns + firstVariableID];
+        for (unsigned var=0; var<numVariables; var++)
+        {
+            p_row[var] = pData[i*numVariables + var];
+        }
+    }
+}
+
+void Hdf5DataWriter::WriteCache()
+{
+    if (mCacheEndTimeStep == mCacheFirstTimeStep)
+    {
+        return; // Nothing to do...
+    }
+
+    const hsize_t num_time_steps = mCacheEndTimeStep - mCacheFirstTimeStep;
+    mDataCache.resize(num_time_steps * mNumberOwned * mDatasetDims[2], 0.0);
+
+    // Define a dataset in memory for this process
+    hsize_t count[DATASET_DIMS] = {num_time_steps, mNumberOwned, mDatasetDims[2]};
+    hid_t memspace = 0;
+    if (mNumberOwned != 0)
+    {
+        memspace = H5Screate_simple(DATASET_DIMS, count, NULL);
+    }
+
+    // Select hyperslab in the file
+    hsize_t offset_dims[DATASET_DIMS] = {mCacheFirstTimeStep, mOffset, 0};
+    hid_t file_dataspace = H5Dget_space(mVariablesDatasetId);
+    H5Sselect_hyperslab(file_dataspace, H5S_SELECT_SET, offset_dims, NULL, count, NULL);
+
+    // Create property list for collective dataset write
+    hid_t property_list_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(property_list_id, H5FD_MPIO_COLLECTIVE);
+
+    double* p_data = mDataCache.empty() ? NULL : &mDataCache[0];
+    H5Dwrite(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, file_dataspace, property_list_id, p_data);
+
+    H5Pclose(property_list_id);
+    H5Sclose(file_dataspace);
+    if (mNumberOwned != 0)
+    {
+        H5Sclose(memspace);
+    }
+
+    // The unlimited variable is only written by the master
+    if (PetscTools::AmMaster() && !mUnlimitedDataCache.empty())
+    {
+        hsize_t size[1] = {mUnlimitedDataCache.size()};
+        hid_t unlimited_memspace = H5Screate_simple(1, size, NULL);
+
+        hsize_t offset[1] = {mCacheFirstTimeStep};
+        hid_t hyperslab_space = H5Dget_space(mUnlimitedDatasetId);
+        H5Sselect_hyperslab(hyperslab_space, H5S_SELECT_SET, offset, NULL, size, NULL);
+
+        H5Dwrite(mUnlimitedDatasetId, H5T_NATIVE_DOUBLE, unlimited_memspace, hyperslab_space, H5P_DEFAULT, &mUnlimitedDataCache[0]);
+
+        H5Sclose(hyperslab_space);
+        H5Sclose(unlimited_memspace);
+    }
+
+    // Empty the cache (keeping the memory for next time)
+    mDataCache.clear();
+    mUnlimitedDataCache.clear();
+    mCacheFirstTimeStep = mCurrentTimeStep;
+    mCacheEndTimeStep = mCurrentTimeStep;
+}
+
 void Hdf5DataWriter::PossiblyExtend()
 {
     if (mNeedExtend)
@@ -1206,6 +1387,68 @@ void Hdf5DataWriter::SetFixedChunkSize(const unsigned& rTimestepsPerChunk,
     mFixedChunkSize[2] = rVariablesPerChunk;
 }
 
+bool Hdf5DataWriter::CanUseFilters()
+{
+#if H5_VERS_MAJOR>1 || (H5_VERS_MAJOR==1 && (H5_VERS_MINOR>10 || (H5_VERS_MINOR==10 && H5_VERS_RELEASE>=2))) // HDF5 1.10.2+
+    return true;
+#else
+    return PetscTools::IsSequential();
+#endif
+}
+
+void Hdf5DataWriter::SetCompression(unsigned deflateLevel, bool useShuffle)
+{
+    assert(mIsInDefineMode);
+
+    if (deflateLevel > 9)
+    {
+        EXCEPTION("The compression level must be between 0 and 9.");
+    }
+    if (deflateLevel > 0)
+    {
+        if (!CanUseFilters())
+        {
+            EXCEPTION("Compressed HDF5 datasets can only be written in parallel with HDF5 1.10.2 or later.");
+        }
+        if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0 || (useShuffle && H5Zfilter_avail(H5Z_FILTER_SHUFFLE) <= 0))
+        {
+            EXCEPTION("This HDF5 library was built without support for compression.");
+        }
+    }
+
+    mDeflateLevel = deflateLevel;
+    mUseShuffle = useShuffle;
+}
+
+void Hdf5DataWriter::SetUseSinglePrecision(bool useSinglePrecision)
+{
+    assert(mIsInDefineMode);
+    mUseSinglePrecision = useSinglePrecision;
+}
+
+void Hdf5DataWriter::SetScaleOffsetPrecision(unsigned decimalDigits)
+{
+    assert(mIsInDefineMode);
+
+    if (!CanUseFilters())
+    {
+        EXCEPTION("Compressed HDF5 datasets can only be written in parallel with HDF5 1.10.2 or later.");
+    }
+    if (H5Zfilter_avail(H5Z_FILTER_SCALEOFFSET) <= 0)
+    {
+        EXCEPTION("This HDF5 library was built without support for the scale-offset filter.");
+    }
+
+    mScaleOffsetDigits = decimalDigits;
+}
+
+void Hdf5DataWriter::SetCacheSize(unsigned numTimeSteps)
+{
+    assert(numTimeSteps > 0u);
+    assert(mCacheEndTimeStep == mCacheFirstTimeStep); // The cache must be empty
+    mCacheSize = numTimeSteps;
+}
+
 hsize_t Hdf5DataWriter::CalculateNumberOfChunks()
 {
     // Number of chunks for istore_k optimisation
@@ -90,6 +90,18 @@ private:
     hsize_t mNumberOfChunks;                  /**< The total number of chunks in the dataset */
     hsize_t mFixedChunkSize[DATASET_DIMS];          /**< User-provided chunk size */
 
+    bool mUseCache;                                 /**< Whether to cache data over several time steps before writing it (see constructor) */
+    unsigned mCacheSize;                            /**< The number of time steps the cache can hold (0 until it is first used, unless set by SetCacheSize()) */
+    long unsigned mCacheFirstTimeStep;              /**< The time step corresponding to the start of the cache */
+    long unsigned mCacheEndTimeStep;                /**< One past the last time step for which data has been cached */
+    std::vector<double> mDataCache;                 /**< Cached data for this process's rows, ordered as in the dataset (time step, row, variable) */
+    std::vector<double> mUnlimitedDataCache;        /**< Cached values of the unlimited variable (only used on the master process) */
+
+    unsigned mDeflateLevel;                         /**< The gzip compression level for the main dataset (0 means no compression) */
+    bool mUseShuffle;                               /**< Whether to apply the shuffle filter before compressing */
+    bool mUseSinglePrecision;                       /**< Whether to store the main dataset as floats rather than doubles */
+    int mScaleOffsetDigits;                         /**< Number of decimal digits kept by the scale-offset filter (negative means don't use it) */
+
 
     /**
      * Check name of variable is allowed, i.e. contains only alphanumeric & _, and isn't blank.
@@ -141,6 +153,40 @@ private:
      */
     void SetChunkSize();
 
+    /**
+     * Decide how many time steps the cache can hold.  This is as many as fit in about 64 MB
+     * per process, rounded down to a whole number of chunks (in the time dimension) of the
+     * dataset.  It depends only on global quantities, so is the same on every process, which
+     * is needed since writing the cache is collective.
+     */
+    void SetUpCache();
+
+    /**
+     * Record that data for the current time step is being added to the cache, setting up the
+     * cache if this is the first time it is used.
+     */
+    void NoteTimeStepCached();
+
+    /**
+     * Write data for this process's rows at the current time step to the dataset, or add it to
+     * the cache if #mUseCache is set.
+     *
+     * @param memspace  the dataspace describing pData
+     * @param fileDataspace  the hyperslab of the dataset to write to
+     * @param propertyListId  the transfer property list to write with
+     * @param pData  the data for this process's rows, with numVariables consecutive values per row
+     * @param firstVariableID  the variable id of the first column being written
+     * @param numVariables  the number of (consecutive) columns being written
+     */
+    void WriteOrCacheData(hid_t memspace, hid_t fileDataspace, hid_t propertyListId, double* pData,
+                          unsigned firstVariableID, unsigned numVariables);
+
+    /**
+     * Write everything in the cache to the file (collectively) and empty the cache, which will
+     * then start at the current time step.
+     */
+    void WriteCache();
+
 public:
 
     /**
@@ -152,17 +198,28 @@ public:
      * @param cleanDirectory  whether to clean the directory (defaults to true)
      * @param extendData  whether to try opening an existing file and appending to it.
      * @param datasetName The name of the HDF5 dataset to write, defaults to "Data".
+     * @param useCache  whether to keep the data for several time steps in memory, and write them
+     *     together (defaults to false).
      *
      * The extendData parameter allows us to add to an existing dataset.  It only really makes
      * sense if the existing file has an unlimited dimension which we can extend.  It also only
      * makes sense if cleanDirectory is false, otherwise there won't be a file there to read...
+     *
+     * With useCache, PutVector(), PutStripedVector() and PutUnlimitedVariable() just copy the data
+     * into memory, and a whole chunk of time steps is written in a single collective operation
+     * when AdvanceAlongUnlimitedDimension() moves past the end of the cache.  Anything still
+     * cached is written by Close() (and so by the destructor), so the file is complete once
+     * the writer has been closed.  Data for a time step can't be read back from the file
+     * until it has been written.  When extending an existing file, the cache starts at the
+     * first new time step, and existing time steps are never rewritten.
      */
     Hdf5DataWriter(DistributedVectorFactory& rVectorFactory,
                    const std::string& rDirectory,
                    const std::string& rBaseName,
                    bool cleanDirectory=true,
                    bool extendData=false,
-                   std::string datasetName="Data");
+                   std::string datasetName="Data",
+                   bool useCache=false);
 
     /**
      * Destructor.
@@ -244,7 +301,7 @@ public:
     void PutUnlimitedVariable(double value);
 
     /**
-     * Close any open files.
+     * Close any open files, first writing anything in the cache.
      */
     void Close();
 
@@ -295,6 +352,53 @@ public:
                            const unsigned& rNodesPerChunk,
                            const unsigned& rVariablesPerChunk);
 
+    /**
+     * @return whether the main dataset can be written through HDF5 filters (i.e. compressed)
+     * in this run.  Writing filtered datasets in parallel needs HDF5 1.10.2 or later; in
+     * serial any version will do.
+     */
+    static bool CanUseFilters();
+
+    /**
+     * Compress the main dataset with gzip (deflate).  This is lossless, and is transparent to
+     * Hdf5DataReader and anything else reading the file with HDF5.  Must be called in define
+     * mode; files being extended keep the settings they were created with.
+     *
+     * @param deflateLevel  the compression level, from 1 (fastest) to 9 (smallest), or 0 for no compression
+     * @param useShuffle  whether to apply the shuffle filter first, which groups the bytes of the
+     *     values so that they compress much better (defaults to true)
+     */
+    void SetCompression(unsigned deflateLevel, bool useShuffle=true);
+
+    /**
+     * Store the main dataset as single (rather than double) precision floating point numbers,
+     * halving its size.  This is lossy, keeping about 7 significant figures, which is plenty for
+     * visualisation and most post-processing.  Data is still passed in, and read back, as doubles.
+     * Must be called in define mode.
+     *
+     * @param useSinglePrecision  whether to do so (defaults to true)
+     */
+    void SetUseSinglePrecision(bool useSinglePrecision=true);
+
+    /**
+     * Apply HDF5's scale-offset filter to the main dataset, which stores each chunk as integers
+     * relative to its minimum value, keeping a fixed number of digits after the decimal point.
+     * This is lossy, and most effective when combined with SetCompression().  Must be called in
+     * define mode.
+     *
+     * @param decimalDigits  the number of digits after the decimal point to keep
+     */
+    void SetScaleOffsetPrecision(unsigned decimalDigits);
+
+    /**
+     * Set how many time steps the cache holds, instead of as many as fit in about 64 MB per
+     * process (see SetUpCache()).  Only has an effect if the writer was constructed with
+     * useCache, and must be called (with the same value on every process) before any data
+     * is written.
+     *
+     * @param numTimeSteps  the number of time steps to cache before writing them
+     */
+    void SetCacheSize(unsigned numTimeSteps);
 };
 
 #endif /*HDF5DATAWRITER_HPP_*/
@@ -39,6 +39,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cxxtest/TestSuite.h>
 
 #include <cstring> // For strcpy
+#include <sstream>
 
 #include "Hdf5DataWriter.hpp"
 #include "Hdf5DataReader.hpp"
@@ -1632,6 +1633,233 @@ public:
 
         PetscTools::Destroy(petsc_data_long);
     }
+
+    void TestHdf5DataWriterFullFormatStripedWithCache() throw(Exception)
+    {
+        int number_nodes = 100;
+        DistributedVectorFactory vec_factory(number_nodes);
+
+        /*
+         * As TestHdf5DataWriterFullFormatStriped, but keeping the data in memory.  With the default
+         * size the cache holds all 10 time steps, which are written when the writer is closed.  The
+         * smaller caches fill up and are written part way through, leaving a partial cache (of 1 or 2
+         * time steps) to write on closing; with chunks of 4 time steps the cache doesn't line up with
+         * the chunks of the dataset.
+         */
+        const unsigned num_cases = 5;
+        const unsigned cache_sizes[num_cases] = {0, 1, 3, 4, 3};
+        const unsigned time_steps_per_chunk[num_cases] = {0, 0, 0, 0, 4};
+
+        for (unsigned test_case=0; test_case<num_cases; test_case++)
+        {
+            std::stringstream file_name;
+            file_name << "hdf5_test_full_format_striped_cached_" << test_case;
+
+            Hdf5DataWriter writer(vec_factory, "TestHdf5DataWriter", file_name.str(), false, false, "Data", true);
+            writer.DefineFixedDimension(number_nodes);
+
+            int node_id = writer.DefineVariable("Node", "dimensionless");
+            int vm_id = writer.DefineVariable("V_m", "millivolts");
+            int phi_e_id = writer.DefineVariable("Phi_e", "millivolts");
+            int ina_id = writer.DefineVariable("I_Na", "milliamperes");
+
+            std::vector<int> striped_variable_IDs;
+            striped_variable_IDs.push_back(vm_id);
+            striped_variable_IDs.push_back(phi_e_id);
+
+            writer.DefineUnlimitedDimension("Time", "msec");
+            if (time_steps_per_chunk[test_case] > 0u)
+            {
+                writer.SetFixedChunkSize(time_steps_per_chunk[test_case], number_nodes, 4);
+            }
+
+            writer.EndDefineMode();
+            if (cache_sizes[test_case] > 0u)
+            {
+                writer.SetCacheSize(cache_sizes[test_case]);
+            }
+
+            DistributedVectorFactory factory(number_nodes);
+
+            Vec petsc_data_short = vec_factory.CreateVec();
+            DistributedVector distributed_vector_short = vec_factory.CreateDistributedVector(petsc_data_short);
+
+            Vec node_number = vec_factory.CreateVec();
+            DistributedVector distributed_node_number = vec_factory.CreateDistributedVector(node_number);
+
+            for (DistributedVector::Iterator index = distributed_vector_short.Begin();
+                 index!= distributed_vector_short.End();
+                 ++index)
+            {
+                distributed_node_number[index] = index.Global;
+                distributed_vector_short[index] = -0.5;
+            }
+            distributed_node_number.Restore();
+            distributed_vector_short.Restore();
+
+            Vec petsc_data_long = factory.CreateVec(2);
+            DistributedVector distributed_vector_long = factory.CreateDistributedVector(petsc_data_long);
+            DistributedVector::Stripe vm_stripe(distributed_vector_long, 0);
+            DistributedVector::Stripe phi_e_stripe(distributed_vector_long,1 );
+
+            for (unsigned time_step=0; time_step<10; time_step++)
+            {
+                for (DistributedVector::Iterator index = distributed_vector_long.Begin();
+                     index!= distributed_vector_long.End();
+                     ++index)
+                {
+                    vm_stripe[index] =  time_step*1000 + index.Global*2;
+                    phi_e_stripe[index] =  time_step*1000 + index.Global*2+1;
+                }
+                distributed_vector_long.Restore();
+
+                writer.PutVector(node_id, node_number);
+                writer.PutVector(ina_id, petsc_data_short);
+                writer.PutStripedVector(striped_variable_IDs, petsc_data_long);
+                writer.PutUnlimitedVariable(time_step);
+                writer.AdvanceAlongUnlimitedDimension();
+            }
+
+            // Closing writes whatever is left in the cache
+            writer.Close();
+
+            TS_ASSERT(CompareFilesViaHdf5DataReader("TestHdf5DataWriter", file_name.str(), true,
+                                                    "io/test/data", "hdf5_test_full_format_striped", false));
+
+            PetscTools::Destroy(node_number);
+            PetscTools::Destroy(petsc_data_long);
+            PetscTools::Destroy(petsc_data_short);
+        }
+    }
+
+    void TestWriteToExistingFileWithCache() throw(Exception)
+    {
+        int number_nodes = 100;
+        DistributedVectorFactory factory(number_nodes);
+
+        // As TestWriteToExistingFile, but on a copy of the original file, so that test can run on its own
+        OutputFileHandler handler("TestHdf5DataWriterExtendWithCache");
+        handler.CopyFileTo(FileFinder("io/test/data/hdf5_test_full_format.h5", RelativeTo::ChasteSourceRoot));
+
+        Hdf5DataWriter writer(factory, "TestHdf5DataWriterExtendWithCache", "hdf5_test_full_format", false, true, "Data", true);
+
+        // The 5 new time steps fill the cache twice, leaving 1 to be written on closing
+        writer.SetCacheSize(2);
+
+        int node_id = writer.GetVariableByName("Node");
+        int ik_id = writer.GetVariableByName("I_K");
+        int ina_id = writer.GetVariableByName("I_Na");
+
+        Vec node_petsc = factory.CreateVec();
+        Vec ik_petsc = factory.CreateVec();
+        Vec ina_petsc = factory.CreateVec();
+        DistributedVector node_data = factory.CreateDistributedVector(node_petsc);
+        DistributedVector ik_data = factory.CreateDistributedVector(ik_petsc);
+        DistributedVector ina_data = factory.CreateDistributedVector(ina_petsc);
+
+        for (unsigned time_step=10; time_step<15; time_step++)
+        {
+            for (DistributedVector::Iterator index = node_data.Begin();
+                 index != node_data.End();
+                 ++index)
+            {
+                node_data[index] = index.Global;
+                ik_data[index] = time_step*1000 + 100 + index.Global;
+                ina_data[index] = time_step*1000 + 200 + index.Global;
+            }
+            node_data.Restore();
+            ik_data.Restore();
+            ina_data.Restore();
+
+            writer.PutVector(node_id, node_petsc);
+            writer.PutVector(ina_id, ina_petsc);
+            writer.PutVector(ik_id, ik_petsc);
+            writer.PutUnlimitedVariable(time_step);
+            writer.AdvanceAlongUnlimitedDimension();
+        }
+
+        writer.Close();
+        PetscTools::Destroy(node_petsc);
+        PetscTools::Destroy(ik_petsc);
+        PetscTools::Destroy(ina_petsc);
+
+        TS_ASSERT(CompareFilesViaHdf5DataReader("TestHdf5DataWriterExtendWithCache", "hdf5_test_full_format", true,
+                                                "io/test/data", "hdf5_test_full_format_extended", false));
+    }
+
+    void TestHdf5DataWriterCompressedAndSinglePrecision() throw(Exception)
+    {
+        int number_nodes = 100;
+
+        DistributedVectorFactory factory(number_nodes);
+
+        Hdf5DataWriter writer(factory, "TestHdf5DataWriter", "hdf5_test_full_format_compressed", false);
+        writer.DefineFixedDimension(number_nodes);
+
+        int node_id = writer.DefineVariable("Node", "dimensionless");
+        int ik_id = writer.DefineVariable("I_K", "milliamperes");
+        int ina_id = writer.DefineVariable("I_Na", "milliamperes");
+        writer.DefineUnlimitedDimension("Time", "msec", 10);
+
+        TS_ASSERT_THROWS_THIS(writer.SetCompression(10), "The compression level must be between 0 and 9.");
+        if (!Hdf5DataWriter::CanUseFilters())
+        {
+            TS_ASSERT_THROWS_THIS(writer.SetCompression(6),
+                                  "Compressed HDF5 datasets can only be written in parallel with HDF5 1.10.2 or later.");
+            return;
+        }
+
+        // The data are all integers less than 2^24, so survive all of this exactly
+        writer.SetCompression(6);
+        writer.SetUseSinglePrecision();
+        writer.SetScaleOffsetPrecision(0u);
+
+        writer.EndDefineMode();
+
+        Vec petsc_data_1 = factory.CreateVec();
+        DistributedVector distributed_vector_1 = factory.CreateDistributedVector(petsc_data_1);
+
+        Vec petsc_data_2 = factory.CreateVec();
+        DistributedVector distributed_vector_2 = factory.CreateDistributedVector(petsc_data_2);
+
+        Vec petsc_data_3 = factory.CreateVec();
+        DistributedVector distributed_vector_3 = factory.CreateDistributedVector(petsc_data_3);
+
+        for (unsigned time_step=0; time_step<10; time_step++)
+        {
+            for (DistributedVector::Iterator index = distributed_vector_1.Begin();
+                 index!= distributed_vector_1.End();
+                 ++index)
+            {
+                distributed_vector_1[index] = index.Global;
+                distributed_vector_2[index] = time_step*1000 + 100 + index.Global;
+                distributed_vector_3[index] = time_step*1000 + 200 + index.Global;
+            }
+            distributed_vector_1.Restore();
+            distributed_vector_2.Restore();
+            distributed_vector_3.Restore();
+
+            writer.PutVector(node_id, petsc_data_1);
+            writer.PutVector(ik_id, petsc_data_2);
+            writer.PutVector(ina_id, petsc_data_3);
+            writer.PutUnlimitedVariable(time_step);
+            writer.AdvanceAlongUnlimitedDimension();
+        }
+
+        writer.Close();
+
+        // The reader converts back to doubles transparently
+        Hdf5DataReader reader("TestHdf5DataWriter", "hdf5_test_full_format_compressed");
+        TS_ASSERT_EQUALS(reader.GetDataPrecision(), 4u);
+        reader.Close();
+
+        TS_ASSERT(CompareFilesViaHdf5DataReader("TestHdf5DataWriter", "hdf5_test_full_format_compressed", true,
+                                                "io/test/data", "hdf5_test_full_format", false));
+
+        PetscTools::Destroy(petsc_data_1);
+        PetscTools::Destroy(petsc_data_2);
+        PetscTools::Destroy(petsc_data_3);
+    }
 };
 
 #endif /*TESTHDF5DATAWRITER_HPP_*/
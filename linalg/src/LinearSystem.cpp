@@ -73,7 +73,8 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, unsigned rowPreallocation)
     mpConvergenceTestContext(NULL),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mpPreconditionerReusePolicy(NULL)
 {
     assert(lhsVectorSize > 0);
     if (mRowPreallocation == UINT_MAX)
@@ -127,7 +128,8 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, Mat lhsMatrix, Vec rhsVector)
     mpConvergenceTestContext(NULL),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mpPreconditionerReusePolicy(NULL)
 {
     assert(lhsVectorSize > 0);
     // Conveniently, PETSc Mats and Vecs are actually pointers
@@ -163,7 +165,8 @@ LinearSystem::LinearSystem(Vec templateVector, unsigned rowPreallocation, bool n
     mpConvergenceTestContext(NULL),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mpPreconditionerReusePolicy(NULL)
 {
     VecDuplicate(templateVector, &mRhsVector);
     VecGetSize(mRhsVector, &mSize);
@@ -204,7 +207,8 @@ LinearSystem::LinearSystem(Vec residualVector, Mat jacobianMatrix)
     mpConvergenceTestContext(NULL),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mpPreconditionerReusePolicy(NULL)
 {
     assert(residualVector || jacobianMatrix);
     mRhsVector = residualVector;
@@ -253,6 +257,7 @@ LinearSystem::~LinearSystem()
     delete mpBlockDiagonalPC;
     delete mpLDUFactorisationPC;
     delete mpTwoLevelsBlockDiagonalPC;
+    delete mpPreconditionerReusePolicy;
 
     if (mDestroyMatAndVec)
     {
@@ -672,6 +677,9 @@ Vec LinearSystem::Solve(Vec lhsGuess)
     MatInfo mat_info;
     MatGetInfo(mLhsMatrix, MAT_GLOBAL_SUM, &mat_info);
 
+    // Whether a lagged PETSc preconditioner is being rebuilt for this solve only
+    bool rebuilding_preconditioner = false;
+
     if (!mKspIsSetup)
     {
         // Create PETSc Vec that may be required if we use a Chebyshev solver
@@ -685,7 +693,7 @@ Vec LinearSystem::Solve(Vec lhsGuess)
         KSPCreate(PETSC_COMM_WORLD, &mKspSolver);
 
 #if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
-        if (mMatrixIsConstant)
+        if (mMatrixIsConstant || mpPreconditionerReusePolicy)
         {
             // Attempt to emulate SAME_PRECONDITIONER below
             KSPSetReusePreconditioner(mKspSolver, PETSC_TRUE);
@@ -697,7 +705,7 @@ Vec LinearSystem::Solve(Vec lhsGuess)
          */
         MatStructure preconditioner_over_successive_calls;
 
-        if (mMatrixIsConstant)
+        if (mMatrixIsConstant || mpPreconditionerReusePolicy)
         {
             preconditioner_over_successive_calls = SAME_PRECONDITIONER;
         }
@@ -927,6 +935,10 @@ Vec LinearSystem::Solve(Vec lhsGuess)
 #endif
 
         mKspIsSetup = true;
+        if (mpPreconditionerReusePolicy)
+        {
+            mpPreconditionerReusePolicy->RecordSetup();
+        }
 
         HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
     }
@@ -937,6 +949,28 @@ Vec LinearSystem::Solve(Vec lhsGuess)
             WARNING("LinearSystem doesn't like the non-zero pattern of a matrix to change. (I think you changed it).");
             mNonZerosUsed = mat_info.nz_used;
         }
+
+        if (mpPreconditionerReusePolicy && !mMatrixIsConstant)
+        {
+            if (mpPreconditionerReusePolicy->IsSetupDue())
+            {
+                if (mpBlockDiagonalPC || mpLDUFactorisationPC || mpTwoLevelsBlockDiagonalPC)
+                {
+                    // Purpose-built preconditioners copy the matrix blocks when created, so make a new one
+                    SetPcType(mPcType.c_str(), mpBathNodes);
+                }
+                else
+                {
+                    SetReusePreconditioner(false);
+                    rebuilding_preconditioner = true;
+                }
+                mpPreconditionerReusePolicy->RecordSetup();
+            }
+            else
+            {
+                mpPreconditionerReusePolicy->RecordReuse();
+            }
+        }
 //        PetscScalar norm;
 //        MatNorm(mLhsMatrix, NORM_FROBENIUS, &norm);
 //        if (fabs(norm - mMatrixNorm) > 0)
@@ -1077,6 +1111,17 @@ Vec LinearSystem::Solve(Vec lhsGuess)
         PETSCEXCEPT(KSPSolve(mKspSolver, mRhsVector, lhs_vector));
         HeartEventHandler::EndEvent(HeartEventHandler::SOLVE_LINEAR_SYSTEM);
 
+        if (rebuilding_preconditioner)
+        {
+            SetReusePreconditioner(true);
+        }
+        if (mpPreconditionerReusePolicy)
+        {
+            PetscInt num_iterations;
+            KSPGetIterationNumber(mKspSolver, &num_iterations);
+            mpPreconditionerReusePolicy->RecordSolve(num_iterations);
+        }
+
 #ifdef TRACE_KSP
         PetscInt num_it;
         KSPGetIterationNumber(mKspSolver, &num_it);
@@ -1234,6 +1279,37 @@ void LinearSystem::ResetKspSolver()
     PetscOptionsSetValue("-ksp_max_it", num_it_str.str().c_str());
 }
 
+void LinearSystem::SetPreconditionerReusePolicy(double iterationGrowthFactor, unsigned maxSolvesBetweenSetups)
+{
+    PreconditionerReusePolicy* p_policy = new PreconditionerReusePolicy(iterationGrowthFactor, maxSolvesBetweenSetups);
+    delete mpPreconditionerReusePolicy;
+    mpPreconditionerReusePolicy = p_policy;
+
+    if (mKspIsSetup && !mMatrixIsConstant)
+    {
+        // Keep the preconditioner that has already been built
+        SetReusePreconditioner(true);
+        mpPreconditionerReusePolicy->RecordSetup();
+    }
+}
+
+const PreconditionerReusePolicy* LinearSystem::GetPreconditionerReusePolicy() const
+{
+    return mpPreconditionerReusePolicy;
+}
+
+void LinearSystem::SetReusePreconditioner(bool reuse)
+{
+    assert(mKspIsSetup);
+#if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
+    KSPSetReusePreconditioner(mKspSolver, reuse ? PETSC_TRUE : PETSC_FALSE);
+#else
+    MatStructure preconditioner_over_successive_calls = (reuse ? SAME_PRECONDITIONER : SAME_NONZERO_PATTERN);
+    Mat precond_matrix = (mPrecondMatrixIsNotLhs ? mPrecondMatrix : mLhsMatrix);
+    KSPSetOperators(mKspSolver, mLhsMatrix, precond_matrix, preconditioner_over_successive_calls);
+#endif
+}
+
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(LinearSystem)
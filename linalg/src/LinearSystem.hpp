@@ -46,6 +46,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PCBlockDiagonal.hpp"
 #include "PCLDUFactorisation.hpp"
 #include "PCTwoLevelsBlockDiagonal.hpp"
+#include "PreconditionerReusePolicy.hpp"
 #include "ArchiveLocationInfo.hpp"
 //#include <boost/serialization/shared_ptr.hpp>
 
@@ -146,6 +147,20 @@ private:
     /** Under certain circunstances you have to reevaluate the spectrum before the k*n-th, k=0,1,..., iteration*/
     bool mForceSpectrumReevaluation;
 
+    /**
+     * Decides when to rebuild the preconditioner of a changing matrix (NULL to rebuild it for every
+     * changed matrix). See SetPreconditionerReusePolicy().
+     */
+    PreconditionerReusePolicy* mpPreconditionerReusePolicy;
+
+    /**
+     * Tell the KSP object whether to keep its current preconditioner on the next solve, even though
+     * the matrix may have changed.
+     *
+     * @param reuse  whether to keep the preconditioner
+     */
+    void SetReusePreconditioner(bool reuse);
+
 #ifdef TRACE_KSP
     unsigned mTotalNumIterations;
     unsigned mMaxNumIterations;
@@ -575,6 +590,23 @@ public:
      * changing the PDE time step when using time adaptivity).
      */
     void ResetKspSolver();
+
+    /**
+     * Keep the preconditioner across solves with a changing matrix, and only rebuild it when the
+     * number of Krylov iterations grows too much compared with the first solve after the last
+     * set-up (see PreconditionerReusePolicy). Purpose-built preconditioners such as
+     * PCBlockDiagonal and PCLDUFactorisation are rebuilt from the current matrix when due.
+     * This has no effect if the matrix is constant (see SetMatrixIsConstant()).
+     *
+     * @param iterationGrowthFactor  rebuild when a solve takes more than this factor times the baseline iterations
+     * @param maxSolvesBetweenSetups  rebuild after this many solves regardless
+     */
+    void SetPreconditionerReusePolicy(double iterationGrowthFactor=1.5, unsigned maxSolvesBetweenSetups=UINT_MAX);
+
+    /**
+     * @return the preconditioner reuse policy, with statistics on set-ups avoided (NULL if not in use)
+     */
+    const PreconditionerReusePolicy* GetPreconditionerReusePolicy() const;
 };
 
 #include "SerializationExportWrapper.hpp"
@@ -0,0 +1,107 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "PreconditionerReusePolicy.hpp"
+#include "Exception.hpp"
+
+PreconditionerReusePolicy::PreconditionerReusePolicy(double iterationGrowthFactor, unsigned maxSolvesBetweenSetups)
+    : mIterationGrowthFactor(iterationGrowthFactor),
+      mMaxSolvesBetweenSetups(maxSolvesBetweenSetups),
+      mBaselineIterations(0u),
+      mSolvesSinceSetup(0u),
+      mSetupDue(false),
+      mNumSetups(0u),
+      mNumSetupsAvoided(0u)
+{
+    if (iterationGrowthFactor < 1.0)
+    {
+        EXCEPTION("The iteration growth factor for reusing a preconditioner must be at least 1.");
+    }
+    if (maxSolvesBetweenSetups == 0u)
+    {
+        EXCEPTION("A preconditioner must be used for at least one solve between set-ups.");
+    }
+}
+
+bool PreconditionerReusePolicy::IsSetupDue() const
+{
+    return mSetupDue || mSolvesSinceSetup >= mMaxSolvesBetweenSetups;
+}
+
+void PreconditionerReusePolicy::RecordSetup()
+{
+    mNumSetups++;
+    mSolvesSinceSetup = 0u;
+    mSetupDue = false;
+}
+
+void PreconditionerReusePolicy::RecordReuse()
+{
+    mNumSetupsAvoided++;
+}
+
+void PreconditionerReusePolicy::RecordSolve(unsigned numIterations)
+{
+    if (mSolvesSinceSetup == 0u)
+    {
+        mBaselineIterations = numIterations;
+    }
+    else
+    {
+        // A baseline of zero iterations (an exact initial guess) is treated as one
+        unsigned baseline = (mBaselineIterations > 0u ? mBaselineIterations : 1u);
+        if (numIterations > mIterationGrowthFactor*baseline)
+        {
+            mSetupDue = true;
+        }
+    }
+    mSolvesSinceSetup++;
+}
+
+unsigned PreconditionerReusePolicy::GetBaselineIterations() const
+{
+    return mBaselineIterations;
+}
+
+unsigned PreconditionerReusePolicy::GetNumSetups() const
+{
+    return mNumSetups;
+}
+
+unsigned PreconditionerReusePolicy::GetNumSetupsAvoided() const
+{
+    return mNumSetupsAvoided;
+}
@@ -0,0 +1,126 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef PRECONDITIONERREUSEPOLICY_HPP_
+#define PRECONDITIONERREUSEPOLICY_HPP_
+
+#include <climits>
+
+/**
+ * Decides when a preconditioner built for an earlier matrix should be rebuilt.
+ *
+ * When the matrix of a linear system changes slowly between solves, the preconditioner
+ * built for an earlier matrix usually remains good enough, and rebuilding it (in particular
+ * an AMG one) can cost more than the solve. The policy records the number of Krylov
+ * iterations taken by the first solve after each set-up as a baseline, and asks for a
+ * new set-up once a solve takes more than a given factor times the baseline, or once the
+ * preconditioner has been used for a given number of solves.
+ */
+class PreconditionerReusePolicy
+{
+private:
+
+    /** A solve taking more than this factor times the baseline iterations triggers a set-up. */
+    double mIterationGrowthFactor;
+
+    /** The maximum number of solves between set-ups. */
+    unsigned mMaxSolvesBetweenSetups;
+
+    /** The number of iterations taken by the first solve after the last set-up. */
+    unsigned mBaselineIterations;
+
+    /** The number of solves since the last set-up. */
+    unsigned mSolvesSinceSetup;
+
+    /** Whether the iteration count has grown enough to require a set-up. */
+    bool mSetupDue;
+
+    /** The number of preconditioner set-ups. */
+    unsigned mNumSetups;
+
+    /** The number of solves with a changed matrix that reused the preconditioner. */
+    unsigned mNumSetupsAvoided;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param iterationGrowthFactor  rebuild the preconditioner when a solve takes more than this
+     *     factor times the iterations of the first solve after the last set-up (at least 1)
+     * @param maxSolvesBetweenSetups  rebuild the preconditioner after this many solves regardless
+     */
+    PreconditionerReusePolicy(double iterationGrowthFactor=1.5, unsigned maxSolvesBetweenSetups=UINT_MAX);
+
+    /**
+     * @return whether the preconditioner should be rebuilt before the next solve
+     */
+    bool IsSetupDue() const;
+
+    /**
+     * Record that the preconditioner has been (re)built.
+     */
+    void RecordSetup();
+
+    /**
+     * Record that a solve with a changed matrix is reusing the preconditioner.
+     */
+    void RecordReuse();
+
+    /**
+     * Record the number of iterations taken by a solve.
+     *
+     * @param numIterations  the number of Krylov iterations
+     */
+    void RecordSolve(unsigned numIterations);
+
+    /**
+     * @return the number of iterations taken by the first solve after the last set-up
+     */
+    unsigned GetBaselineIterations() const;
+
+    /**
+     * @return the number of preconditioner set-ups so far
+     */
+    unsigned GetNumSetups() const;
+
+    /**
+     * @return the number of set-ups avoided by reusing the preconditioner
+     */
+    unsigned GetNumSetupsAvoided() const;
+};
+
+#endif /*PRECONDITIONERREUSEPOLICY_HPP_*/
@@ -1589,6 +1589,138 @@ public:
         PetscTools::Destroy(solution_vector);
     }
 
+    void TestPreconditionerReusePolicy() throw (Exception)
+    {
+        TS_ASSERT_THROWS_THIS(PreconditionerReusePolicy bad_policy(0.5),
+                              "The iteration growth factor for reusing a preconditioner must be at least 1.");
+        TS_ASSERT_THROWS_THIS(PreconditionerReusePolicy bad_policy(1.5, 0u),
+                              "A preconditioner must be used for at least one solve between set-ups.");
+
+        PreconditionerReusePolicy policy(1.5);
+        policy.RecordSetup();
+        policy.RecordSolve(20u);
+        TS_ASSERT_EQUALS(policy.GetBaselineIterations(), 20u);
+        TS_ASSERT(!policy.IsSetupDue());
+
+        // Up to 1.5 times the baseline is fine...
+        policy.RecordReuse();
+        policy.RecordSolve(30u);
+        TS_ASSERT(!policy.IsSetupDue());
+
+        // ...but more triggers a new set-up, which resets the baseline
+        policy.RecordReuse();
+        policy.RecordSolve(31u);
+        TS_ASSERT(policy.IsSetupDue());
+        policy.RecordSetup();
+        TS_ASSERT(!policy.IsSetupDue());
+        policy.RecordSolve(25u);
+        TS_ASSERT_EQUALS(policy.GetBaselineIterations(), 25u);
+
+        TS_ASSERT_EQUALS(policy.GetNumSetups(), 2u);
+        TS_ASSERT_EQUALS(policy.GetNumSetupsAvoided(), 2u);
+    }
+
+    void TestReusePreconditionerForChangingMatrix() throw (Exception)
+    {
+        unsigned num_nodes = 1331;
+        DistributedVectorFactory factory(num_nodes);
+
+        std::string pc_types[2] = {"bjacobi", "blockdiagonal"};
+        unsigned max_solves_between_setups[2] = {2u, UINT_MAX};
+        for (unsigned pc_index=0; pc_index<2; pc_index++)
+        {
+            for (unsigned limit_index=0; limit_index<2; limit_index++)
+            {
+                unsigned max_solves = max_solves_between_setups[limit_index];
+                Vec parallel_layout = factory.CreateVec(2);
+                Mat system_matrix;
+                // Note that this test deadlocks if the file's not on the disk
+                PetscTools::ReadPetscObject(system_matrix, "linalg/test/data/matrices/cube_6000elems_half_activated.mat", parallel_layout);
+                Vec system_rhs;
+                PetscTools::ReadPetscObject(system_rhs, "linalg/test/data/matrices/cube_6000elems_half_activated.vec", parallel_layout);
+                PetscTools::Destroy(parallel_layout);
+
+                LinearSystem ls = LinearSystem(system_rhs, system_matrix);
+                ls.SetKspType("cg");
+                ls.SetPcType(pc_types[pc_index].c_str());
+                ls.SetRelativeTolerance(1e-6);
+                TS_ASSERT(ls.GetPreconditionerReusePolicy() == NULL);
+                ls.SetPreconditionerReusePolicy(1.5, max_solves);
+
+                /*
+                 * Scaling the matrix changes it between solves without changing how well
+                 * the first preconditioner works, so only the limit on the number of solves
+                 * between set-ups causes the preconditioner to be rebuilt.
+                 *
+                 * Whether the preconditioner itself was rebuilt is seen by applying it after
+                 * each solve: a reused preconditioner gives exactly the same result as after
+                 * the previous solve, whereas one rebuilt from the scaled matrix does not.
+                 */
+                Vec preconditioned_rhs;
+                VecDuplicate(system_rhs, &preconditioned_rhs);
+                Vec previous_preconditioned_rhs;
+                VecDuplicate(system_rhs, &previous_preconditioned_rhs);
+
+                unsigned first_num_iterations = 0u;
+                for (unsigned solve=0; solve<6; solve++)
+                {
+                    Vec solution = ls.Solve();
+
+                    PC prec;
+                    KSPGetPC(ls.mKspSolver, &prec);
+                    PCApply(prec, system_rhs, preconditioned_rhs);
+
+                    if (solve == 0)
+                    {
+                        first_num_iterations = ls.GetNumIterations();
+                    }
+                    else
+                    {
+                        TS_ASSERT_EQUALS(ls.GetNumIterations(), first_num_iterations);
+
+                        bool expect_rebuild = (max_solves == 2u && solve%2 == 0);
+                        double norm;
+                        VecNorm(preconditioned_rhs, NORM_2, &norm);
+                        VecAXPY(previous_preconditioned_rhs, -1.0, preconditioned_rhs);
+                        double change;
+                        VecNorm(previous_preconditioned_rhs, NORM_2, &change);
+                        if (expect_rebuild)
+                        {
+                            TS_ASSERT_LESS_THAN(1e-4*norm, change);
+                        }
+                        else
+                        {
+                            TS_ASSERT_LESS_THAN_EQUALS(change, 1e-14*norm);
+                        }
+                    }
+                    VecCopy(preconditioned_rhs, previous_preconditioned_rhs);
+
+                    PetscTools::Destroy(solution);
+                    MatScale(system_matrix, 1.01);
+                }
+                PetscTools::Destroy(preconditioned_rhs);
+                PetscTools::Destroy(previous_preconditioned_rhs);
+
+                const PreconditionerReusePolicy* p_policy = ls.GetPreconditionerReusePolicy();
+                TS_ASSERT(p_policy != NULL);
+                TS_ASSERT_EQUALS(p_policy->GetBaselineIterations(), first_num_iterations);
+                if (max_solves == 2u)
+                {
+                    TS_ASSERT_EQUALS(p_policy->GetNumSetups(), 3u);
+                    TS_ASSERT_EQUALS(p_policy->GetNumSetupsAvoided(), 3u);
+                }
+                else
+                {
+                    TS_ASSERT_EQUALS(p_policy->GetNumSetups(), 1u);
+                    TS_ASSERT_EQUALS(p_policy->GetNumSetupsAvoided(), 5u);
+                }
+
+                PetscTools::Destroy(system_matrix);
+                PetscTools::Destroy(system_rhs);
+            }
+        }
+    }
+
     // This test should be the last in the suite
     void TestSetFromOptions()
     {
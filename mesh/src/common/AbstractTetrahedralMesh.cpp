@@ -36,6 +36,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractTetrahedralMesh.hpp"
 
 #include <limits>
+#include <cfloat>
+#include <cmath>
 
 ///////////////////////////////////////////////////////////////////////////////////
 // Implementation
@@ -65,7 +67,9 @@ void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetElementOwnerships()
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::AbstractTetrahedralMesh()
-    : mMeshIsLinear(true)
+    : mMeshIsLinear(true),
+      mUseElementSpatialIndex(false),
+      mElementSpatialIndexIsValid(false)
 {
 }
 
@@ -975,12 +979,27 @@ unsigned AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIn
 
     if (!onlyTryWithTestElements)
     {
-        for (unsigned i=0; i<this->mElements.size(); i++)
+        const std::vector<unsigned>* p_candidates = GetElementSpatialIndexCandidates(rTestPoint);
+        if (p_candidates)
         {
-            if (this->mElements[i]->IncludesPoint(rTestPoint, strict))
+            // The candidates are in increasing order, so this finds the same element as testing every element
+            for (unsigned i=0; i<p_candidates->size(); i++)
             {
-                assert(!this->mElements[i]->IsDeleted());
-                return i;
+                if (this->mElements[(*p_candidates)[i]]->IncludesPoint(rTestPoint, strict))
+                {
+                    return (*p_candidates)[i];
+                }
+            }
+        }
+        else
+        {
+            for (unsigned i=0; i<this->mElements.size(); i++)
+            {
+                if (this->mElements[i]->IncludesPoint(rTestPoint, strict))
+                {
+                    assert(!this->mElements[i]->IsDeleted());
+                    return i;
+                }
             }
         }
     }
@@ -1037,6 +1056,192 @@ unsigned AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetNearestElementIndex
     return closest_index;
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
+{
+    InvalidateElementSpatialIndex();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetUseElementSpatialIndex(bool useElementSpatialIndex)
+{
+    mUseElementSpatialIndex = useElementSpatialIndex;
+    InvalidateElementSpatialIndex();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetUseElementSpatialIndex() const
+{
+    return mUseElementSpatialIndex;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateElementSpatialIndex()
+{
+    mElementSpatialIndexIsValid = false;
+    mElementSpatialIndexBins.clear();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetUpElementSpatialIndex()
+{
+    assert(ELEMENT_DIM == SPACE_DIM);
+
+    // Find the bounding box of each element, padded to allow for the tolerance in Element::IncludesPoint()
+    std::vector<unsigned> element_indices;
+    std::vector<c_vector<double, SPACE_DIM> > element_lower_corners;
+    std::vector<c_vector<double, SPACE_DIM> > element_upper_corners;
+    c_vector<double, SPACE_DIM> lower_corner = scalar_vector<double>(SPACE_DIM, DBL_MAX);
+    c_vector<double, SPACE_DIM> upper_corner = scalar_vector<double>(SPACE_DIM, -DBL_MAX);
+    double total_element_size = 0.0;
+
+    for (unsigned i=0; i<this->mElements.size(); i++)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[i];
+        if (p_element->IsDeleted())
+        {
+            continue;
+        }
+
+        c_vector<double, SPACE_DIM> element_lower = p_element->GetNode(0)->rGetLocation();
+        c_vector<double, SPACE_DIM> element_upper = element_lower;
+        for (unsigned j=1; j<=ELEMENT_DIM; j++)
+        {
+            const c_vector<double, SPACE_DIM>& r_location = p_element->GetNode(j)->rGetLocation();
+            for (unsigned d=0; d<SPACE_DIM; d++)
+            {
+                element_lower[d] = std::min(element_lower[d], r_location[d]);
+                element_upper[d] = std::max(element_upper[d], r_location[d]);
+            }
+        }
+
+        double element_size = norm_inf(element_upper - element_lower);
+        double padding = 1e-6*element_size + DBL_EPSILON;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            element_lower[d] -= padding;
+            element_upper[d] += padding;
+            lower_corner[d] = std::min(lower_corner[d], element_lower[d]);
+            upper_corner[d] = std::max(upper_corner[d], element_upper[d]);
+        }
+        total_element_size += element_size;
+
+        element_indices.push_back(i);
+        element_lower_corners.push_back(element_lower);
+        element_upper_corners.push_back(element_upper);
+    }
+
+    mElementSpatialIndexBins.clear();
+    const unsigned num_elements = element_indices.size();
+    if (num_elements == 0)
+    {
+        // Every point is outside the (empty) grid
+        mElementSpatialIndexOrigin = zero_vector<double>(SPACE_DIM);
+        mElementSpatialIndexBinWidths = scalar_vector<double>(SPACE_DIM, 1.0);
+        mElementSpatialIndexNumBins = zero_vector<unsigned>(SPACE_DIM);
+        mElementSpatialIndexBins.resize(1);
+        mElementSpatialIndexIsValid = true;
+        return;
+    }
+
+    // Aim for bins about the size of an average element, but don't use many more bins than elements
+    double bin_width = total_element_size/num_elements;
+    if (bin_width <= 0.0)
+    {
+        bin_width = 1.0;
+    }
+    unsigned num_bins = 0;
+    do
+    {
+        num_bins = 1;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            double extent = upper_corner[d] - lower_corner[d];
+            mElementSpatialIndexNumBins[d] = std::max(1u, (unsigned)ceil(extent/bin_width));
+            mElementSpatialIndexBinWidths[d] = extent/mElementSpatialIndexNumBins[d];
+            num_bins *= mElementSpatialIndexNumBins[d];
+        }
+        bin_width *= 2.0;
+    }
+    while (num_bins > 8*num_elements);
+
+    mElementSpatialIndexOrigin = lower_corner;
+    mElementSpatialIndexBins.resize(num_bins + 1);
+
+    // Add each element to all the bins its bounding box overlaps (in increasing order of element index)
+    for (unsigned k=0; k<num_elements; k++)
+    {
+        c_vector<unsigned, SPACE_DIM> lower_bin;
+        c_vector<unsigned, SPACE_DIM> upper_bin;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            double lower_position = (element_lower_corners[k][d] - mElementSpatialIndexOrigin[d])/mElementSpatialIndexBinWidths[d];
+            double upper_position = (element_upper_corners[k][d] - mElementSpatialIndexOrigin[d])/mElementSpatialIndexBinWidths[d];
+            lower_bin[d] = std::min((unsigned)std::max(floor(lower_position), 0.0), mElementSpatialIndexNumBins[d]-1);
+            upper_bin[d] = std::min((unsigned)std::max(floor(upper_position), 0.0), mElementSpatialIndexNumBins[d]-1);
+        }
+
+        c_vector<unsigned, SPACE_DIM> bin = lower_bin;
+        bool finished = false;
+        while (!finished)
+        {
+            unsigned bin_index = 0;
+            for (unsigned d=SPACE_DIM; d-- > 0; )
+            {
+                bin_index = bin_index*mElementSpatialIndexNumBins[d] + bin[d];
+            }
+            mElementSpatialIndexBins[bin_index].push_back(element_indices[k]);
+
+            // Move on to the next bin in the range, like an odometer
+            finished = true;
+            for (unsigned d=0; d<SPACE_DIM; d++)
+            {
+                if (bin[d] < upper_bin[d])
+                {
+                    bin[d]++;
+                    finished = false;
+                    break;
+                }
+                bin[d] = lower_bin[d];
+            }
+        }
+    }
+
+    mElementSpatialIndexIsValid = true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<unsigned>* AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetElementSpatialIndexCandidates(const ChastePoint<SPACE_DIM>& rTestPoint)
+{
+    if (!mUseElementSpatialIndex || ELEMENT_DIM != SPACE_DIM)
+    {
+        return NULL;
+    }
+
+    if (!mElementSpatialIndexIsValid)
+    {
+        SetUpElementSpatialIndex();
+    }
+    if (mElementSpatialIndexBins.size() == 1)
+    {
+        // There are no elements
+        return &(mElementSpatialIndexBins.back());
+    }
+
+    unsigned bin_index = 0;
+    for (unsigned d=SPACE_DIM; d-- > 0; )
+    {
+        double position = (rTestPoint[d] - mElementSpatialIndexOrigin[d])/mElementSpatialIndexBinWidths[d];
+        if (!(position >= 0.0) || position > mElementSpatialIndexNumBins[d])
+        {
+            // The point is outside every (padded) element bounding box
+            return &(mElementSpatialIndexBins.back());
+        }
+        bin_index = bin_index*mElementSpatialIndexNumBins[d] + std::min((unsigned)position, mElementSpatialIndexNumBins[d]-1);
+    }
+    return &(mElementSpatialIndexBins[bin_index]);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 // Explicit instantiation
 /////////////////////////////////////////////////////////////////////////////////////
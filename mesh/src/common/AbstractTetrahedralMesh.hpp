@@ -79,6 +79,36 @@ protected:
     bool mMeshIsLinear;
 
 private:
+    /**
+     * Whether point location methods (e.g. GetContainingElementIndex()) should use a
+     * spatial index of the elements rather than testing every element.  Defaults to false.
+     */
+    bool mUseElementSpatialIndex;
+
+    /** Whether the spatial index is up to date with the elements and node locations. */
+    bool mElementSpatialIndexIsValid;
+
+    /** Lower corner of the regular grid of bins which makes up the spatial index. */
+    c_vector<double, SPACE_DIM> mElementSpatialIndexOrigin;
+
+    /** The width of the bins in each direction. */
+    c_vector<double, SPACE_DIM> mElementSpatialIndexBinWidths;
+
+    /** The number of bins in each direction. */
+    c_vector<unsigned, SPACE_DIM> mElementSpatialIndexNumBins;
+
+    /**
+     * For each bin, the (local) indices of the undeleted elements whose bounding boxes
+     * overlap the bin, in increasing order.  There is one extra empty bin at the end, which
+     * stands for all points outside the grid.
+     */
+    std::vector<std::vector<unsigned> > mElementSpatialIndexBins;
+
+    /**
+     * Bin the elements by their bounding boxes, using bins about the size of an element.
+     */
+    void SetUpElementSpatialIndex();
+
     /**
      * Pure virtual solve element mapping method. For an element with a given
      * global index, get the local index used by this process.
@@ -215,7 +245,8 @@ private:
         {
             p_our_factory = p_factory->GetOriginalFactory();
         }
-        if (p_our_factory && p_our_factory->GetNumProcs() == p_factory->GetNumProcs())
+        bool repartitioning = !DistributedVectorFactory::rGetOwnershipWeightsOnLoad().empty();
+        if (p_our_factory && p_our_factory->GetNumProcs() == p_factory->GetNumProcs() && !repartitioning)
         {
             // Specify the node distribution
             this->SetDistributedVectorFactory(p_our_factory);
@@ -225,6 +256,13 @@ private:
             // Migrating; let the mesh re-partition if it likes
             /// \todo #1199  make this work for everything else...
             p_our_factory = NULL;
+
+            if (p_factory && repartitioning)
+            {
+                // The loaded factory already balances the requested weights, so use its ownership
+                this->mpDistributedVectorFactory = new DistributedVectorFactory(p_factory->GetProblemSize(),
+                                                                                p_factory->GetLocalOwnership());
+            }
         }
 
         if (mMeshIsLinear)
@@ -288,6 +326,18 @@ protected:  // Give access of these variables to subclasses
      */
     void SetElementOwnerships();
 
+    /**
+     * Get the elements which might contain a point, using the spatial index (which is built if
+     * it is not up to date).  Every element that contains the point, allowing for the tolerance
+     * in Element::IncludesPoint(), is returned.
+     *
+     * @param rTestPoint reference to the point
+     * @return the (local) indices of the candidate elements in increasing order, or NULL if the
+     *     spatial index is not in use (or ELEMENT_DIM != SPACE_DIM), in which case all elements
+     *     should be tested.
+     */
+    const std::vector<unsigned>* GetElementSpatialIndexCandidates(const ChastePoint<SPACE_DIM>& rTestPoint);
+
 public:
 
     //////////////////////////////////////////////////////////////////////
@@ -449,6 +499,37 @@ public:
                                                         c_vector<double, SPACE_DIM>& rWeightedDirection,
                                                         double& rJacobianDeterminant) const;
 
+    /**
+     * Overridden RefreshMesh() method, which marks the spatial index of the elements as out of date.
+     * Must be called after moving nodes (other than via methods of the mesh).
+     */
+    virtual void RefreshMesh();
+
+    /**
+     * Set whether point location methods (GetContainingElementIndex(), and the
+     * GetNearestElementIndex(), GetContainingElementIndices() and
+     * GetContainingElementIndexWithInitialGuess() methods of TetrahedralMesh) should use
+     * a spatial index of the elements.  The index is built the first time it is needed after
+     * the mesh changes, and makes each query take close to constant time rather than time
+     * proportional to the number of elements.  The answers are unaffected.
+     *
+     * The index is only used when ELEMENT_DIM == SPACE_DIM.
+     *
+     * @param useElementSpatialIndex whether to use the index (defaults to true)
+     */
+    void SetUseElementSpatialIndex(bool useElementSpatialIndex=true);
+
+    /**
+     * @return whether point location methods use a spatial index of the elements.
+     */
+    bool GetUseElementSpatialIndex() const;
+
+    /**
+     * Mark the spatial index of the elements as out of date, so that it is rebuilt when next needed.
+     * This is called by methods of the mesh which move nodes or change the elements.
+     */
+    void InvalidateElementSpatialIndex();
+
     /**
      * Check whether mesh has outward-facing normals.
      *
@@ -54,6 +54,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "RandomNumberGenerator.hpp"
 
 #include "Timer.hpp"
+#include "Warnings.hpp"
 #include "TetrahedralMesh.hpp"
 
 #include "petscao.h"
@@ -77,7 +78,8 @@ DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::DistributedTetrahedralMesh(D
       mTotalNumBoundaryElements(0u),
       mTotalNumNodes(0u),
       mpSpaceRegion(NULL),
-      mMetisPartitioning(partitioningMethod)
+      mMetisPartitioning(partitioningMethod),
+      mReorderForLocality(false)
 {
     if (ELEMENT_DIM == 1 && (partitioningMethod != DistributedTetrahedralMeshPartitionType::GEOMETRIC))
     {
@@ -111,6 +113,11 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ComputeMeshPartitioning
     std::vector<unsigned>& rProcessorsOffset)
 {
     ///\todo #1293 add a timing event for the partitioning
+    if (!mNodeWeights.empty() && mNodeWeights.size() != rMeshReader.GetNumNodes())
+    {
+        EXCEPTION("The number of node weights does not match the number of nodes in the mesh.");
+    }
+
     if (mMetisPartitioning==DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY && PetscTools::IsParallel())
     {
         /*
@@ -126,11 +133,11 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ComputeMeshPartitioning
          */
         if (mMetisPartitioning==DistributedTetrahedralMeshPartitionType::METIS_LIBRARY && PetscTools::IsParallel())
         {
-            NodePartitioner<ELEMENT_DIM, SPACE_DIM>::MetisLibraryPartitioning(rMeshReader, this->mNodePermutation, rNodesOwned, rProcessorsOffset);
+            NodePartitioner<ELEMENT_DIM, SPACE_DIM>::MetisLibraryPartitioning(rMeshReader, this->mNodePermutation, rNodesOwned, rProcessorsOffset, mNodeWeights);
         }
         else if (mMetisPartitioning==DistributedTetrahedralMeshPartitionType::PETSC_MAT_PARTITION && PetscTools::IsParallel())
         {
-            NodePartitioner<ELEMENT_DIM, SPACE_DIM>::PetscMatrixPartitioning(rMeshReader, this->mNodePermutation, rNodesOwned, rProcessorsOffset);
+            NodePartitioner<ELEMENT_DIM, SPACE_DIM>::PetscMatrixPartitioning(rMeshReader, this->mNodePermutation, rNodesOwned, rProcessorsOffset, mNodeWeights);
         }
         else if (mMetisPartitioning==DistributedTetrahedralMeshPartitionType::GEOMETRIC && PetscTools::IsParallel())
         {
@@ -138,10 +145,20 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ComputeMeshPartitioning
             {
                 EXCEPTION("Using GEOMETRIC partition for DistributedTetrahedralMesh with local regions not set. Call SetProcessRegion(ChasteCuboid)");
             }
+            if (!mNodeWeights.empty())
+            {
+                WARN_ONCE_ONLY("Node weights are ignored by GEOMETRIC partitioning.");
+            }
             NodePartitioner<ELEMENT_DIM, SPACE_DIM>::GeometricPartitioning(rMeshReader, this->mNodePermutation, rNodesOwned, rProcessorsOffset, mpSpaceRegion);
         }
         else
         {
+            if (!mNodeWeights.empty() && this->mpDistributedVectorFactory == NULL)
+            {
+                // Give each process a contiguous block of nodes with roughly equal total weight
+                this->mpDistributedVectorFactory = new DistributedVectorFactory(mTotalNumNodes,
+                        DistributedVectorFactory::CalculateWeightedLocalOwnership(mNodeWeights));
+            }
             NodePartitioner<ELEMENT_DIM, SPACE_DIM>::DumbPartitioning(*this, rNodesOwned);
         }
 
@@ -421,7 +438,7 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ConstructFromMeshReader
         assert(rMeshReader.HasNodePermutation() == false);
 
         // We reorder so that each process owns a contiguous set of the indices and we can then build a distributed vector factory.
-        ReorderNodes();
+        ReorderNodes(this->mNodePermutation);
 
         unsigned num_owned;
         unsigned rank = PetscTools::GetMyRank();
@@ -449,6 +466,11 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ConstructFromMeshReader
             this->mNodePermutation = rMeshReader.rGetNodePermutation();
         }
     }
+
+    if (mReorderForLocality && !rMeshReader.HasNodePermutation())
+    {
+        ReorderForLocality();
+    }
     rMeshReader.Reset();
 }
 
@@ -527,6 +549,30 @@ ChasteCuboid<SPACE_DIM>*  DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::Ge
     return mpSpaceRegion;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetNodeWeights(const std::vector<unsigned>& rNodeWeights)
+{
+    mNodeWeights = rNodeWeights;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<unsigned>& DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::rGetNodeWeights() const
+{
+    return mNodeWeights;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetReorderForLocality(bool reorderForLocality)
+{
+    mReorderForLocality = reorderForLocality;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetReorderForLocality() const
+{
+    return mReorderForLocality;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetElementOwnerships()
 {
@@ -655,10 +701,8 @@ Node<SPACE_DIM> * DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetNodeOrH
 }
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
-void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ReorderNodes()
+void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ReorderNodes(const std::vector<unsigned>& rPermutation)
 {
-    assert(PetscTools::IsParallel());
-
     // Need to rebuild global-local maps
     mNodesMapping.clear();
     mHaloNodesMapping.clear();
@@ -667,7 +711,7 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ReorderNodes()
     for (unsigned index=0; index<this->mNodes.size(); index++)
     {
         unsigned old_index = this->mNodes[index]->GetIndex();
-        unsigned new_index = this->mNodePermutation[old_index];
+        unsigned new_index = rPermutation[old_index];
 
         this->mNodes[index]->SetIndex(new_index);
         mNodesMapping[new_index] = index;
@@ -676,13 +720,156 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ReorderNodes()
     for (unsigned index=0; index<mHaloNodes.size(); index++)
     {
         unsigned old_index = mHaloNodes[index]->GetIndex();
-        unsigned new_index = this->mNodePermutation[old_index];
+        unsigned new_index = rPermutation[old_index];
 
         mHaloNodes[index]->SetIndex(new_index);
         mHaloNodesMapping[new_index] = index;
     }
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ReorderForLocality()
+{
+    DistributedVectorFactory* p_factory = this->GetDistributedVectorFactory();
+    const unsigned lo = p_factory->GetLow();
+    const unsigned num_local_nodes = this->mNodes.size();
+    assert(num_local_nodes == p_factory->GetLocalOwnership());
+
+    // Bounding box of the nodes owned by this process
+    c_vector<double, SPACE_DIM> lower = zero_vector<double>(SPACE_DIM);
+    c_vector<double, SPACE_DIM> upper = zero_vector<double>(SPACE_DIM);
+    for (unsigned index=0; index<num_local_nodes; index++)
+    {
+        const c_vector<double, SPACE_DIM>& r_location = this->mNodes[index]->rGetLocation();
+        for (unsigned dim=0; dim<SPACE_DIM; dim++)
+        {
+            if (index == 0 || r_location[dim] < lower[dim])
+            {
+                lower[dim] = r_location[dim];
+            }
+            if (index == 0 || r_location[dim] > upper[dim])
+            {
+                upper[dim] = r_location[dim];
+            }
+        }
+    }
+
+    // Sort the owned nodes along the curve (ties are broken by the current index, so the result is deterministic)
+    std::vector<std::pair<boost::uint64_t, unsigned> > node_keys(num_local_nodes);
+    for (unsigned index=0; index<num_local_nodes; index++)
+    {
+        assert(p_factory->IsGlobalIndexLocal(this->mNodes[index]->GetIndex()));
+        node_keys[index] = std::make_pair(CalculateMortonKey(this->mNodes[index]->rGetLocation(), lower, upper),
+                                          this->mNodes[index]->GetIndex());
+    }
+    std::sort(node_keys.begin(), node_keys.end());
+
+    // New index of each owned node, in order of current index
+    std::vector<unsigned> local_new_indices(num_local_nodes);
+    for (unsigned position=0; position<num_local_nodes; position++)
+    {
+        local_new_indices[node_keys[position].second - lo] = lo + position;
+    }
+
+    // Every process needs the whole renumbering to update its halo nodes
+    std::vector<unsigned> locality_permutation;
+    if (PetscTools::IsSequential())
+    {
+        locality_permutation = local_new_indices;
+    }
+    else
+    {
+        const unsigned num_procs = PetscTools::GetNumProcs();
+        const std::vector<unsigned>& r_global_lows = p_factory->rGetGlobalLows();
+        std::vector<int> counts(num_procs);
+        std::vector<int> displacements(num_procs);
+        for (unsigned proc=0; proc<num_procs; proc++)
+        {
+            unsigned proc_high = (proc+1 < num_procs) ? r_global_lows[proc+1] : mTotalNumNodes;
+            counts[proc] = proc_high - r_global_lows[proc];
+            displacements[proc] = r_global_lows[proc];
+        }
+        locality_permutation.resize(mTotalNumNodes);
+        MPI_Allgatherv(num_local_nodes > 0 ? &local_new_indices[0] : NULL, num_local_nodes, MPI_UNSIGNED,
+                       &locality_permutation[0], &counts[0], &displacements[0], MPI_UNSIGNED, PETSC_COMM_WORLD);
+    }
+
+    ReorderNodes(locality_permutation);
+
+    // Compose with any permutation applied by the partitioning, so we still map from the original indices
+    if (this->mNodePermutation.empty())
+    {
+        this->mNodePermutation = locality_permutation;
+    }
+    else
+    {
+        for (unsigned index=0; index<this->mNodePermutation.size(); index++)
+        {
+            this->mNodePermutation[index] = locality_permutation[this->mNodePermutation[index]];
+        }
+    }
+
+    // Store the owned nodes in index order
+    std::vector<Node<SPACE_DIM>*> sorted_nodes(num_local_nodes);
+    for (unsigned index=0; index<num_local_nodes; index++)
+    {
+        sorted_nodes[this->mNodes[index]->GetIndex() - lo] = this->mNodes[index];
+    }
+    this->mNodes = sorted_nodes;
+    mNodesMapping.clear();
+    for (unsigned index=0; index<num_local_nodes; index++)
+    {
+        mNodesMapping[this->mNodes[index]->GetIndex()] = index;
+    }
+
+    // Store the local elements along the same curve (element indices are unchanged)
+    std::vector<std::pair<boost::uint64_t, unsigned> > element_keys(this->mElements.size());
+    for (unsigned index=0; index<this->mElements.size(); index++)
+    {
+        element_keys[index] = std::make_pair(CalculateMortonKey(this->mElements[index]->CalculateCentroid(), lower, upper),
+                                             index);
+    }
+    std::sort(element_keys.begin(), element_keys.end());
+
+    std::vector<Element<ELEMENT_DIM, SPACE_DIM>*> sorted_elements(this->mElements.size());
+    mElementsMapping.clear();
+    for (unsigned position=0; position<element_keys.size(); position++)
+    {
+        sorted_elements[position] = this->mElements[element_keys[position].second];
+        mElementsMapping[sorted_elements[position]->GetIndex()] = position;
+    }
+    this->mElements = sorted_elements;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+boost::uint64_t DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::CalculateMortonKey(const c_vector<double, SPACE_DIM>& rLocation,
+                                                                                    const c_vector<double, SPACE_DIM>& rLower,
+                                                                                    const c_vector<double, SPACE_DIM>& rUpper)
+{
+    // Quantise each coordinate to the same number of bits, then interleave the bits (most significant first)
+    const unsigned bits_per_dim = 63u/SPACE_DIM;
+    const boost::uint64_t num_cells = ((boost::uint64_t) 1u) << bits_per_dim;
+
+    boost::uint64_t cell[SPACE_DIM];
+    for (unsigned dim=0; dim<SPACE_DIM; dim++)
+    {
+        double width = rUpper[dim] - rLower[dim];
+        double fraction = (width > 0.0) ? (rLocation[dim] - rLower[dim])/width : 0.0;
+        fraction = std::max(0.0, std::min(1.0, fraction));
+        cell[dim] = std::min(num_cells - 1u, (boost::uint64_t) (fraction*num_cells));
+    }
+
+    boost::uint64_t key = 0u;
+    for (int bit=bits_per_dim-1; bit>=0; bit--)
+    {
+        for (unsigned dim=0; dim<SPACE_DIM; dim++)
+        {
+            key = (key << 1) | ((cell[dim] >> bit) & 1u);
+        }
+    }
+    return key;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ConstructLinearMesh(unsigned width)
 {
@@ -1331,6 +1518,9 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ParMetisLibraryNodeAndE
 
     boost::scoped_array<idxtype> eind(new idxtype[num_local_elements*(ELEMENT_DIM+1)]);
     boost::scoped_array<idxtype> eptr(new idxtype[num_local_elements+1]);
+    // The weight of an element (a vertex of the dual graph) is the total weight of its nodes
+    const bool weighted = !mNodeWeights.empty();
+    boost::scoped_array<idxtype> element_weights(new idxtype[weighted ? num_local_elements : 0]);
 
     if ( rMeshReader.IsFileFormatBinary() && first_local_element > 0)
     {
@@ -1354,9 +1544,17 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ParMetisLibraryNodeAndE
         element_data = rMeshReader.GetNextElementData();
 
         eptr[element_index] = counter;
+        if (weighted)
+        {
+            element_weights[element_index] = 0;
+        }
         for (unsigned i=0; i<ELEMENT_DIM+1; i++)
         {
             eind[counter++] = element_data.NodeIndices[i];
+            if (weighted)
+            {
+                element_weights[element_index] += mNodeWeights[element_data.NodeIndices[i]];
+            }
         }
     }
     eptr[num_local_elements] = counter;
@@ -1391,7 +1589,7 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ParMetisLibraryNodeAndE
     eind.reset();
     eptr.reset();
 
-    idxtype weight_flag = 0; // unweighted graph
+    idxtype weight_flag = weighted ? 2 : 0; // weights on the vertices only, or an unweighted graph
     idxtype n_constraints = 1; // number of weights that each vertex has (number of balance constraints)
     idxtype n_subdomains = PetscTools::GetNumProcs();
     idxtype options[3]; // extra options
@@ -1419,11 +1617,12 @@ void DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ParMetisLibraryNodeAndE
 //                             options, &edgecut, local_partition, &communicator);
 
     Timer::Reset();
-    ParMETIS_V3_PartKway(element_distribution.get(), xadj, adjncy, NULL, NULL, &weight_flag, &numflag,
+    ParMETIS_V3_PartKway(element_distribution.get(), xadj, adjncy, weighted ? element_weights.get() : NULL, NULL, &weight_flag, &numflag,
                          &n_constraints, &n_subdomains, tpwgts.get(), &ubvec_value,
                          options, &edgecut, local_partition.get(), &communicator);
     //Timer::Print("ParMETIS PartKway");
     tpwgts.reset();
+    element_weights.reset();
 
     boost::scoped_array<idxtype> global_element_partition(new idxtype[num_elements]);
 
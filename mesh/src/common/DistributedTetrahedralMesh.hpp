@@ -42,6 +42,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ChasteSerialization.hpp"
 #include <boost/serialization/base_object.hpp>
+#include <boost/cstdint.hpp>
 
 #include "AbstractTetrahedralMesh.hpp"
 #include "Node.hpp"
@@ -95,6 +96,15 @@ private:
     /** Partitioning method. */
     DistributedTetrahedralMeshPartitionType::type mMetisPartitioning;
 
+    /**
+     * Relative cost of each node (indexed as in the mesh reader), balanced by the partitioning
+     * in place of the node count if not empty.  See SetNodeWeights().
+     */
+    std::vector<unsigned> mNodeWeights;
+
+    /** Whether ConstructFromMeshReader() reorders each partition for locality.  See SetReorderForLocality(). */
+    bool mReorderForLocality;
+
     /** Needed for serialization.*/
     friend class boost::serialization::access;
     /**
@@ -219,6 +229,46 @@ public:
      */
     ChasteCuboid<SPACE_DIM>* GetProcessRegion();
 
+    /**
+     * Set the relative cost of each node, for example the cost of solving the cell model there,
+     * so that the partitioning balances total cost rather than the number of nodes per process.
+     * Must be called before ConstructFromMeshReader().
+     *
+     * The weights are used by the DUMB (as a weighted contiguous split), PETSC_MAT_PARTITION,
+     * PARMETIS_LIBRARY (as element weights) and METIS_LIBRARY (METIS 5 only) partitions.
+     * GEOMETRIC partitioning ignores them.  If a DistributedVectorFactory has been given to the
+     * mesh then its ownership is used instead.
+     *
+     * @param rNodeWeights  the weight of each node, indexed as in the mesh reader (entries should be positive);
+     *     an empty vector switches weighting off
+     */
+    void SetNodeWeights(const std::vector<unsigned>& rNodeWeights);
+
+    /**
+     * @return the node weights set by SetNodeWeights() (empty if the partitioning is unweighted)
+     */
+    const std::vector<unsigned>& rGetNodeWeights() const;
+
+    /**
+     * Set whether ConstructFromMeshReader() should renumber the nodes owned by each process,
+     * and reorder the storage of its elements, along a space-filling (Morton) curve.  Nodes
+     * that are close in space then have close indices, which reduces the bandwidth of the
+     * assembled matrices and makes assembly and matrix-vector products more cache friendly.
+     * The partition itself is not changed.
+     *
+     * The renumbering is recorded in the node permutation (see rGetNodePermutation()), so
+     * results can still be written using the original node ordering.  It is not applied when
+     * the mesh reader already has a node permutation (e.g. when loading from a checkpoint).
+     *
+     * @param reorderForLocality  whether to reorder for locality
+     */
+    void SetReorderForLocality(bool reorderForLocality=true);
+
+    /**
+     * @return whether ConstructFromMeshReader() reorders each partition for locality
+     */
+    bool GetReorderForLocality() const;
+
     /**
      * Determine whether or not the current process owns node 0 of this element (tie breaker to determine which process writes
      * to file for when two or more share ownership of an element).
@@ -430,12 +480,34 @@ private:
                                           std::vector<unsigned>& rProcessorsOffset);
 
     /**
-     * Reorder the node indices in this mesh by applying the permutation
-     * give in mNodePermutation.
+     * Reorder the node indices in this mesh by applying the given permutation
+     * (usually mNodePermutation).
+     *
+     * The node indexed with "i" will be re-assigned with the new index rPermutation[i]
+     *
+     * @param rPermutation  the permutation to apply to the current node indices
+     */
+    void ReorderNodes(const std::vector<unsigned>& rPermutation);
+
+    /**
+     * Renumber the nodes owned by each process along a Morton curve through their locations,
+     * and store the local nodes and elements in that order.  Called by ConstructFromMeshReader()
+     * if #mReorderForLocality is set, once each process owns a contiguous range of indices.
+     * Updates mNodePermutation so that it maps from the original node indices.
+     */
+    void ReorderForLocality();
+
+    /**
+     * Compute the position of a point along a Morton (Z-order) space-filling curve through a box.
      *
-     * The node indexed with "i" will be re-assigned with the new index mNodePermutation[i]
+     * @param rLocation  the point (clamped to the box)
+     * @param rLower  the lower corner of the box
+     * @param rUpper  the upper corner of the box
+     * @return the Morton key of the point
      */
-    void ReorderNodes();
+    static boost::uint64_t CalculateMortonKey(const c_vector<double, SPACE_DIM>& rLocation,
+                                              const c_vector<double, SPACE_DIM>& rLower,
+                                              const c_vector<double, SPACE_DIM>& rUpper);
 
     //////////////////////////////////////////////////////////////////////
     //                            Iterators                             //
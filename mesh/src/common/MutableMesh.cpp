@@ -35,6 +35,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <map>
 #include <cstring>
+#include <algorithm>
 
 #include "MutableMesh.hpp"
 #include "OutputFileHandler.hpp"
@@ -50,13 +51,15 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 MutableMesh<ELEMENT_DIM, SPACE_DIM>::MutableMesh()
-    : mAddedNodes(false)
+    : mAddedNodes(false),
+      mUseIncrementalReMesh(false)
 {
     this->mMeshChangesDuringSimulation = true;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 MutableMesh<ELEMENT_DIM, SPACE_DIM>::MutableMesh(std::vector<Node<SPACE_DIM> *> nodes)
+    : mUseIncrementalReMesh(false)
 {
     this->mMeshChangesDuringSimulation = true;
     Clear();
@@ -89,7 +92,15 @@ unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddNode(Node<SPACE_DIM>* pNewNode)
         unsigned index = mDeletedNodeIndices.back();
         pNewNode->SetIndex(index);
         mDeletedNodeIndices.pop_back();
-        delete this->mNodes[index];
+        if (mUseIncrementalReMesh)
+        {
+            // The elements around the deleted node are still needed by the next ReMesh()
+            mReplacedNodes.push_back(this->mNodes[index]);
+        }
+        else
+        {
+            delete this->mNodes[index];
+        }
         this->mNodes[index] = pNewNode;
     }
     mAddedNodes = true;
@@ -99,6 +110,11 @@ unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddNode(Node<SPACE_DIM>* pNewNode)
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddElement(Element<ELEMENT_DIM,SPACE_DIM>* pNewElement)
 {
+    this->InvalidateElementSpatialIndex();
+
+    // The triangulation no longer matches the one recorded at the last remesh, so check every element next time
+    mNodeLocationsAtLastReMesh.clear();
+
     unsigned new_elt_index;
 
     if (mDeletedElementIndices.empty())
@@ -128,6 +144,12 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
     mDeletedNodeIndices.clear();
     mAddedNodes = false;
 
+    for (unsigned i=0; i<mReplacedNodes.size(); i++)
+    {
+        delete mReplacedNodes[i];
+    }
+    mReplacedNodes.clear();
+
     TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::Clear();
 }
 
@@ -175,6 +197,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned index,
         ChastePoint<SPACE_DIM> point,
         bool concreteMove)
 {
+    this->InvalidateElementSpatialIndex();
+
     this->mNodes[index]->SetPoint(point);
 
     if (concreteMove)
@@ -230,6 +254,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned index,
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNode(unsigned index)
 {
+    this->InvalidateElementSpatialIndex();
+
     if (this->mNodes[index]->IsDeleted())
     {
         EXCEPTION("Trying to delete a deleted node");
@@ -266,6 +292,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNode(unsigned index)
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElement(unsigned index)
 {
+    this->InvalidateElementSpatialIndex();
+
     assert(!this->mElements[index]->IsDeleted());
     this->mElements[index]->MarkAsDeleted();
     mDeletedElementIndices.push_back(index);
@@ -307,6 +335,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::MoveMergeNode(unsigned index,
         unsigned targetIndex,
         bool concreteMove)
 {
+    this->InvalidateElementSpatialIndex();
+
     if (this->mNodes[index]->IsDeleted())
     {
         EXCEPTION("Trying to move a deleted node");
@@ -564,6 +594,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteBoundaryNodeAt(unsigned index)
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReIndex(NodeMap& map)
 {
+    this->InvalidateElementSpatialIndex();
+
     assert(!mAddedNodes);
     map.Resize(this->GetNumAllNodes());
 
@@ -676,6 +708,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReIndex(NodeMap& map)
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(NodeMap& map)
 {
+    this->InvalidateElementSpatialIndex();
+
     // Make sure that we are in the correct dimension - this code will be eliminated at compile time
     #define COVERAGE_IGNORE
     assert( ELEMENT_DIM == SPACE_DIM );
@@ -775,6 +809,10 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(NodeMap& map)
 
         this->RefreshJacobianCachedData();
     }
+    else if (SPACE_DIM==2 && mUseIncrementalReMesh && ReMeshIncrementally(map))
+    {
+        // The existing triangulation has been repaired locally
+    }
     else if (SPACE_DIM==2)  // In 2D, remesh using triangle via library calls
     {
         struct triangulateio mesher_input, mesher_output;
@@ -791,6 +829,11 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(NodeMap& map)
         //Tidy up triangle
         this->FreeTriangulateIo(mesher_input);
         this->FreeTriangulateIo(mesher_output);
+
+        if (mUseIncrementalReMesh)
+        {
+            RecordNodeLocationsAtReMesh();
+        }
     }
     else // in 3D, remesh using tetgen
     {
@@ -813,6 +856,492 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh()
     ReMesh(map);
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableMesh<ELEMENT_DIM, SPACE_DIM>::SetUseIncrementalReMesh(bool useIncrementalReMesh)
+{
+    mUseIncrementalReMesh = useIncrementalReMesh;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::GetUseIncrementalReMesh() const
+{
+    return mUseIncrementalReMesh;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMeshIncrementally(NodeMap& rMap)
+{
+    assert(ELEMENT_DIM == 2 && SPACE_DIM == 2);
+
+    if (this->mElements.empty() || !mDeletedElementIndices.empty() || !mDeletedBoundaryElementIndices.empty())
+    {
+        return false;
+    }
+
+    // The nodes have moved since the last remesh, so first check that the elements still tile a convex region
+    if (!IsValidConvexTriangulation())
+    {
+        return false;
+    }
+
+    // Only edges next to a node which has moved since the last remesh can have stopped being Delaunay
+    std::vector<bool> node_has_moved(this->mNodes.size(), true);
+    for (unsigned i=0; i<this->mNodes.size() && i<mNodeLocationsAtLastReMesh.size(); i++)
+    {
+        const c_vector<double, SPACE_DIM>& r_location = this->mNodes[i]->rGetLocation();
+        node_has_moved[i] = (r_location[0] != mNodeLocationsAtLastReMesh[i][0]
+                             || r_location[1] != mNodeLocationsAtLastReMesh[i][1]);
+    }
+    std::vector<unsigned> elements_to_check;
+    for (unsigned i=0; i<this->mElements.size(); i++)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[i];
+        if (node_has_moved[p_element->GetNodeGlobalIndex(0)]
+            || node_has_moved[p_element->GetNodeGlobalIndex(1)]
+            || node_has_moved[p_element->GetNodeGlobalIndex(2)])
+        {
+            elements_to_check.push_back(i);
+        }
+    }
+
+    // Remove deleted nodes, including those whose indices have since been reused
+    std::vector<Node<SPACE_DIM>*> nodes_to_remove = mReplacedNodes;
+    for (unsigned i=0; i<mDeletedNodeIndices.size(); i++)
+    {
+        nodes_to_remove.push_back(this->mNodes[mDeletedNodeIndices[i]]);
+    }
+    for (unsigned i=0; i<nodes_to_remove.size(); i++)
+    {
+        if (nodes_to_remove[i]->GetNumContainingElements() > 0
+            && !RemoveNodeFromTriangulation(nodes_to_remove[i], elements_to_check))
+        {
+            return false;
+        }
+    }
+
+    // Insert new nodes, which are not yet in any element, starting each walk from the last element split
+    unsigned start_element_index = this->mElements.size() - 1;
+    while (this->mElements[start_element_index]->IsDeleted())
+    {
+        start_element_index--;
+    }
+    for (unsigned i=0; i<this->mNodes.size(); i++)
+    {
+        if (!this->mNodes[i]->IsDeleted()
+            && this->mNodes[i]->GetNumContainingElements() == 0
+            && !InsertNodeIntoTriangulation(this->mNodes[i], start_element_index, elements_to_check))
+        {
+            return false;
+        }
+    }
+
+    FlipEdgesUntilDelaunay(elements_to_check);
+
+    for (unsigned i=0; i<mReplacedNodes.size(); i++)
+    {
+        delete mReplacedNodes[i];
+    }
+    mReplacedNodes.clear();
+    mAddedNodes = false;
+
+    // ReIndex() relies on the cached Jacobian data covering every element
+    this->RefreshJacobianCachedData();
+    ReIndex(rMap);
+    RecordNodeLocationsAtReMesh();
+
+    return true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::IsValidConvexTriangulation()
+{
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator elem_iter = this->GetElementIteratorBegin();
+         elem_iter != this->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        const c_vector<double, SPACE_DIM>& r_a = elem_iter->GetNode(0)->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_b = elem_iter->GetNode(1)->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_c = elem_iter->GetNode(2)->rGetLocation();
+        double scale = std::max(norm_2(r_b - r_a), std::max(norm_2(r_c - r_b), norm_2(r_a - r_c)));
+        if (CalculateOrientation(r_a, r_b, r_c) <= 1e-10*scale*scale)
+        {
+            return false;
+        }
+    }
+
+    // Orient each boundary edge so that the interior of the mesh is on its left
+    std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*> next_boundary_node;
+    for (unsigned i=0; i<this->mBoundaryElements.size(); i++)
+    {
+        Node<SPACE_DIM>* p_node_a = this->mBoundaryElements[i]->GetNode(0);
+        Node<SPACE_DIM>* p_node_b = this->mBoundaryElements[i]->GetNode(1);
+        if (p_node_a->IsDeleted() || p_node_b->IsDeleted())
+        {
+            return false;
+        }
+
+        bool found_element = false;
+        for (typename Node<SPACE_DIM>::ContainingElementIterator it = p_node_a->ContainingElementsBegin();
+             !found_element && it != p_node_a->ContainingElementsEnd();
+             ++it)
+        {
+            Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[*it];
+            for (unsigned j=0; j<3; j++)
+            {
+                if (p_element->GetNode(j) == p_node_a)
+                {
+                    if (p_element->GetNode((j+1)%3) == p_node_b)
+                    {
+                        found_element = true;
+                    }
+                    else if (p_element->GetNode((j+2)%3) == p_node_b)
+                    {
+                        std::swap(p_node_a, p_node_b);
+                        found_element = true;
+                    }
+                }
+            }
+        }
+        if (!found_element || next_boundary_node.find(p_node_a) != next_boundary_node.end())
+        {
+            return false;
+        }
+        next_boundary_node[p_node_a] = p_node_b;
+    }
+
+    // The boundary is convex if it turns left (or goes straight on) at every boundary node
+    for (typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator it = next_boundary_node.begin();
+         it != next_boundary_node.end();
+         ++it)
+    {
+        typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator next_it = next_boundary_node.find(it->second);
+        if (next_it == next_boundary_node.end())
+        {
+            return false;
+        }
+        const c_vector<double, SPACE_DIM>& r_a = it->first->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_b = it->second->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_c = next_it->second->rGetLocation();
+        if (CalculateOrientation(r_a, r_b, r_c) < -1e-10*norm_2(r_b - r_a)*norm_2(r_c - r_b))
+        {
+            return false;
+        }
+    }
+
+    return !next_boundary_node.empty();
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::RemoveNodeFromTriangulation(Node<SPACE_DIM>* pNode, std::vector<unsigned>& rChangedElements)
+{
+    // Removing a boundary node would change the convex hull
+    if (pNode->IsBoundaryNode())
+    {
+        return false;
+    }
+
+    // Find the polygon around the node, in anticlockwise order
+    std::set<unsigned> containing_elements = pNode->rGetContainingElementIndices();
+    std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*> next_polygon_node;
+    for (std::set<unsigned>::iterator it = containing_elements.begin(); it != containing_elements.end(); ++it)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[*it];
+        for (unsigned j=0; j<3; j++)
+        {
+            if (p_element->GetNode(j) == pNode)
+            {
+                next_polygon_node[p_element->GetNode((j+1)%3)] = p_element->GetNode((j+2)%3);
+            }
+        }
+    }
+
+    std::vector<Node<SPACE_DIM>*> polygon;
+    Node<SPACE_DIM>* p_start = next_polygon_node.begin()->first;
+    Node<SPACE_DIM>* p_current = p_start;
+    do
+    {
+        polygon.push_back(p_current);
+        typename std::map<Node<SPACE_DIM>*, Node<SPACE_DIM>*>::iterator it = next_polygon_node.find(p_current);
+        if (it == next_polygon_node.end())
+        {
+            return false;
+        }
+        p_current = it->second;
+    }
+    while (p_current != p_start && polygon.size() <= containing_elements.size());
+
+    if (p_current != p_start || polygon.size() != containing_elements.size())
+    {
+        return false;
+    }
+
+    for (std::set<unsigned>::iterator it = containing_elements.begin(); it != containing_elements.end(); ++it)
+    {
+        this->mElements[*it]->MarkAsDeleted();
+        mDeletedElementIndices.push_back(*it);
+    }
+
+    // Triangulate the polygon by repeatedly cutting off a convex vertex with no other polygon vertices in its triangle
+    while (polygon.size() > 3)
+    {
+        unsigned num_vertices = polygon.size();
+        bool found_ear = false;
+        for (unsigned i=0; i<num_vertices && !found_ear; i++)
+        {
+            Node<SPACE_DIM>* p_prev = polygon[(i+num_vertices-1)%num_vertices];
+            Node<SPACE_DIM>* p_next = polygon[(i+1)%num_vertices];
+            const c_vector<double, SPACE_DIM>& r_a = p_prev->rGetLocation();
+            const c_vector<double, SPACE_DIM>& r_b = polygon[i]->rGetLocation();
+            const c_vector<double, SPACE_DIM>& r_c = p_next->rGetLocation();
+
+            double scale = std::max(norm_2(r_b - r_a), std::max(norm_2(r_c - r_b), norm_2(r_a - r_c)));
+            if (CalculateOrientation(r_a, r_b, r_c) <= 1e-10*scale*scale)
+            {
+                continue;
+            }
+
+            found_ear = true;
+            for (unsigned j=0; j<num_vertices && found_ear; j++)
+            {
+                if (polygon[j] != p_prev && polygon[j] != polygon[i] && polygon[j] != p_next)
+                {
+                    const c_vector<double, SPACE_DIM>& r_p = polygon[j]->rGetLocation();
+                    if (CalculateOrientation(r_a, r_b, r_p) >= 0.0
+                        && CalculateOrientation(r_b, r_c, r_p) >= 0.0
+                        && CalculateOrientation(r_c, r_a, r_p) >= 0.0)
+                    {
+                        found_ear = false;
+                    }
+                }
+            }
+
+            if (found_ear)
+            {
+                rChangedElements.push_back(AddTriangle(p_prev, polygon[i], p_next));
+                polygon.erase(polygon.begin() + i);
+            }
+        }
+
+        if (!found_ear)
+        {
+            return false;
+        }
+    }
+
+    const c_vector<double, SPACE_DIM>& r_a = polygon[0]->rGetLocation();
+    const c_vector<double, SPACE_DIM>& r_b = polygon[1]->rGetLocation();
+    const c_vector<double, SPACE_DIM>& r_c = polygon[2]->rGetLocation();
+    double scale = std::max(norm_2(r_b - r_a), std::max(norm_2(r_c - r_b), norm_2(r_a - r_c)));
+    if (CalculateOrientation(r_a, r_b, r_c) <= 1e-10*scale*scale)
+    {
+        return false;
+    }
+    rChangedElements.push_back(AddTriangle(polygon[0], polygon[1], polygon[2]));
+
+    return true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::InsertNodeIntoTriangulation(Node<SPACE_DIM>* pNode,
+                                                                      unsigned& rStartElementIndex,
+                                                                      std::vector<unsigned>& rChangedElements)
+{
+    const c_vector<double, SPACE_DIM>& r_p = pNode->rGetLocation();
+
+    // The walk always terminates on a Delaunay triangulation, but the nodes may have moved since it was one,
+    // so give up if it takes more steps than there are elements
+    unsigned element_index = rStartElementIndex;
+    for (unsigned step=0; step<this->mElements.size(); step++)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[element_index];
+        assert(!p_element->IsDeleted());
+        Node<SPACE_DIM>* p_node_a = p_element->GetNode(0);
+        Node<SPACE_DIM>* p_node_b = p_element->GetNode(1);
+        Node<SPACE_DIM>* p_node_c = p_element->GetNode(2);
+        const c_vector<double, SPACE_DIM>& r_a = p_node_a->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_b = p_node_b->rGetLocation();
+        const c_vector<double, SPACE_DIM>& r_c = p_node_c->rGetLocation();
+
+        // Orientation of the node relative to the edge opposite each local node
+        double tolerance = 1e-10*CalculateOrientation(r_a, r_b, r_c);
+        c_vector<double, 3> orientations;
+        orientations[0] = CalculateOrientation(r_b, r_c, r_p);
+        orientations[1] = CalculateOrientation(r_c, r_a, r_p);
+        orientations[2] = CalculateOrientation(r_a, r_b, r_p);
+
+        // Cross an edge with the node on its far side, trying the edges from a different one at each step
+        // so that the walk does not go round in circles on a non-Delaunay triangulation
+        unsigned edge_to_cross = UINT_MAX;
+        for (unsigned j=0; j<3 && edge_to_cross==UINT_MAX; j++)
+        {
+            if (orientations[(step+j)%3] < -tolerance)
+            {
+                edge_to_cross = (step+j)%3;
+            }
+        }
+
+        if (edge_to_cross == UINT_MAX)
+        {
+            // The node must be strictly inside the element, as nodes on edges would need more than a split
+            if (orientations[0] <= tolerance || orientations[1] <= tolerance || orientations[2] <= tolerance)
+            {
+                return false;
+            }
+            p_element->UpdateNode(2, pNode);
+            rChangedElements.push_back(element_index);
+            rChangedElements.push_back(AddTriangle(p_node_b, p_node_c, pNode));
+            rChangedElements.push_back(AddTriangle(p_node_c, p_node_a, pNode));
+            rStartElementIndex = element_index;
+            return true;
+        }
+
+        unsigned local_index_of_b;
+        Element<ELEMENT_DIM, SPACE_DIM>* p_neighbour = GetNeighbourAcrossEdge(element_index,
+                                                                              p_element->GetNode((edge_to_cross+1)%3),
+                                                                              p_element->GetNode((edge_to_cross+2)%3),
+                                                                              local_index_of_b);
+        if (p_neighbour == NULL)
+        {
+            return false; // the node is outside the mesh
+        }
+        element_index = p_neighbour->GetIndex();
+    }
+    return false;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableMesh<ELEMENT_DIM, SPACE_DIM>::FlipEdgesUntilDelaunay(std::vector<unsigned>& rElementsToCheck)
+{
+    while (!rElementsToCheck.empty())
+    {
+        unsigned element_index = rElementsToCheck.back();
+        rElementsToCheck.pop_back();
+
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[element_index];
+        if (p_element->IsDeleted())
+        {
+            continue;
+        }
+
+        for (unsigned i=0; i<3; i++)
+        {
+            // Look across the edge bc, opposite node a
+            Node<SPACE_DIM>* p_node_a = p_element->GetNode(i);
+            Node<SPACE_DIM>* p_node_b = p_element->GetNode((i+1)%3);
+            Node<SPACE_DIM>* p_node_c = p_element->GetNode((i+2)%3);
+
+            unsigned local_index_of_b;
+            Element<ELEMENT_DIM, SPACE_DIM>* p_neighbour = GetNeighbourAcrossEdge(element_index, p_node_b, p_node_c, local_index_of_b);
+            if (p_neighbour == NULL)
+            {
+                continue; // boundary edge
+            }
+
+            Node<SPACE_DIM>* p_node_d = p_neighbour->GetNode((local_index_of_b+1)%3);
+            const c_vector<double, SPACE_DIM>& r_a = p_node_a->rGetLocation();
+            const c_vector<double, SPACE_DIM>& r_b = p_node_b->rGetLocation();
+            const c_vector<double, SPACE_DIM>& r_c = p_node_c->rGetLocation();
+            const c_vector<double, SPACE_DIM>& r_d = p_node_d->rGetLocation();
+
+            if (IsInsideCircumcircle(r_a, r_b, r_c, r_d)
+                && CalculateOrientation(r_a, r_b, r_d) > 0.0
+                && CalculateOrientation(r_d, r_c, r_a) > 0.0)
+            {
+                // Replace abc and dcb by abd and dca
+                p_element->UpdateNode((i+2)%3, p_node_d);
+                p_neighbour->UpdateNode(local_index_of_b, p_node_a);
+
+                rElementsToCheck.push_back(element_index);
+                rElementsToCheck.push_back(p_neighbour->GetIndex());
+                break;
+            }
+        }
+    }
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+Element<ELEMENT_DIM, SPACE_DIM>* MutableMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbourAcrossEdge(unsigned elementIndex,
+                                                                                            Node<SPACE_DIM>* pNodeB,
+                                                                                            Node<SPACE_DIM>* pNodeC,
+                                                                                            unsigned& rLocalIndexOfB)
+{
+    for (typename Node<SPACE_DIM>::ContainingElementIterator it = pNodeB->ContainingElementsBegin();
+         it != pNodeB->ContainingElementsEnd();
+         ++it)
+    {
+        if (*it != elementIndex)
+        {
+            Element<ELEMENT_DIM, SPACE_DIM>* p_other = this->mElements[*it];
+            for (unsigned j=0; j<3; j++)
+            {
+                if (p_other->GetNode(j) == pNodeC)
+                {
+                    // The neighbour lists this edge the other way round, as c then b
+                    rLocalIndexOfB = (j+1)%3;
+                    return p_other;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableMesh<ELEMENT_DIM, SPACE_DIM>::RecordNodeLocationsAtReMesh()
+{
+    mNodeLocationsAtLastReMesh.resize(this->mNodes.size());
+    for (unsigned i=0; i<this->mNodes.size(); i++)
+    {
+        mNodeLocationsAtLastReMesh[i] = this->mNodes[i]->rGetLocation();
+    }
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddTriangle(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB, Node<SPACE_DIM>* pNodeC)
+{
+    std::vector<Node<SPACE_DIM>*> nodes;
+    nodes.push_back(pNodeA);
+    nodes.push_back(pNodeB);
+    nodes.push_back(pNodeC);
+    return AddElement(new Element<ELEMENT_DIM, SPACE_DIM>(this->mElements.size(), nodes));
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double MutableMesh<ELEMENT_DIM, SPACE_DIM>::CalculateOrientation(const c_vector<double, SPACE_DIM>& rA,
+                                                                 const c_vector<double, SPACE_DIM>& rB,
+                                                                 const c_vector<double, SPACE_DIM>& rC)
+{
+    assert(SPACE_DIM == 2);
+    return (rB[0] - rA[0])*(rC[1] - rA[1]) - (rB[1] - rA[1])*(rC[0] - rA[0]);
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableMesh<ELEMENT_DIM, SPACE_DIM>::IsInsideCircumcircle(const c_vector<double, SPACE_DIM>& rA,
+                                                               const c_vector<double, SPACE_DIM>& rB,
+                                                               const c_vector<double, SPACE_DIM>& rC,
+                                                               const c_vector<double, SPACE_DIM>& rD)
+{
+    assert(SPACE_DIM == 2);
+    double adx = rA[0] - rD[0];
+    double ady = rA[1] - rD[1];
+    double bdx = rB[0] - rD[0];
+    double bdy = rB[1] - rD[1];
+    double cdx = rC[0] - rD[0];
+    double cdy = rC[1] - rD[1];
+
+    double a_lift = adx*adx + ady*ady;
+    double b_lift = bdx*bdx + bdy*bdy;
+    double c_lift = cdx*cdx + cdy*cdy;
+
+    double determinant = a_lift*(bdx*cdy - cdx*bdy) + b_lift*(cdx*ady - adx*cdy) + c_lift*(adx*bdy - bdx*ady);
+    double permanent = a_lift*(fabs(bdx*cdy) + fabs(cdx*bdy))
+                     + b_lift*(fabs(cdx*ady) + fabs(adx*cdy))
+                     + c_lift*(fabs(adx*bdy) + fabs(bdx*ady));
+
+    // Nodes which are (nearly) cocircular are left alone, so that flipping always terminates
+    return determinant > 1e-10*permanent;
+}
+
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::vector<c_vector<unsigned, 5> > MutableMesh<ELEMENT_DIM, SPACE_DIM>::SplitLongEdges(double cutoffLength)
 {
@@ -150,8 +150,151 @@ protected:
     /** Whether any nodes have been added to the mesh. */
     bool mAddedNodes;
 
+    /**
+     * Whether ReMesh() should try to repair the existing triangulation locally
+     * before falling back to rebuilding it with triangle. Only used in 2D.
+     * Not archived.
+     */
+    bool mUseIncrementalReMesh;
+
+    /**
+     * Deleted nodes whose indices have been reused by AddNode() while incremental
+     * remeshing is enabled. They are freed at the next ReMesh(), since the elements
+     * around them still refer to them until then.
+     */
+    std::vector<Node<SPACE_DIM>*> mReplacedNodes;
+
+    /**
+     * The location of each node, indexed by node, when the mesh was last remeshed
+     * with incremental remeshing enabled. Used to find the nodes which have moved
+     * since then, as only edges next to these can have stopped being Delaunay.
+     * Not archived.
+     */
+    std::vector<c_vector<double, SPACE_DIM> > mNodeLocationsAtLastReMesh;
+
 private:
 
+    /**
+     * Helper method for ReMesh(). Bring the existing 2D triangulation up to date
+     * with the current nodes by removing deleted interior nodes, inserting new
+     * nodes that lie strictly inside an element and then flipping edges until
+     * the triangulation is Delaunay again. Only the elements changed by these
+     * steps, and those with a node which has moved since the last remesh, are
+     * checked for edge flips.
+     *
+     * This gives up (without leaving the nodes in an unusable state) if any element
+     * has been inverted by node movement, if the boundary of the mesh is no longer
+     * convex, or if a node is deleted from or added on the boundary, in which case
+     * the caller should rebuild the triangulation from scratch.
+     *
+     * @param rMap is a NodeMap which is filled in as in ReMesh()
+     * @return whether the triangulation was successfully updated
+     */
+    bool ReMeshIncrementally(NodeMap& rMap);
+
+    /**
+     * Helper method for ReMeshIncrementally().
+     *
+     * @return whether every element has positive area and the boundary
+     * elements form a convex polygon, oriented consistently with the elements.
+     */
+    bool IsValidConvexTriangulation();
+
+    /**
+     * Helper method for ReMeshIncrementally(). Remove the elements containing a
+     * deleted interior node and triangulate the hole they leave by ear clipping.
+     *
+     * @param pNode pointer to the deleted node
+     * @param rChangedElements the indices of the new elements are appended to this
+     * @return whether the node was removed
+     */
+    bool RemoveNodeFromTriangulation(Node<SPACE_DIM>* pNode, std::vector<unsigned>& rChangedElements);
+
+    /**
+     * Helper method for ReMeshIncrementally(). Split the element strictly
+     * containing a new node into three.
+     *
+     * The element is found by walking across the mesh from a start element,
+     * crossing at each step an edge which has the node on its far side, so the
+     * cost depends on the distance from the start element rather than on the
+     * size of the mesh.
+     *
+     * @param pNode pointer to the new node
+     * @param rStartElementIndex the index of the element to start walking from,
+     *     which is set to the index of the element that was split
+     * @param rChangedElements the indices of the split element and the new elements are appended to this
+     * @return whether an element strictly containing the node was found
+     */
+    bool InsertNodeIntoTriangulation(Node<SPACE_DIM>* pNode,
+                                     unsigned& rStartElementIndex,
+                                     std::vector<unsigned>& rChangedElements);
+
+    /**
+     * Helper method for ReMeshIncrementally(). Flip any edges of the given
+     * elements which are not locally Delaunay, then check the edges of the
+     * elements changed by each flip, until no more flips are needed.
+     *
+     * @param rElementsToCheck the indices of the elements to start from; emptied by this method
+     */
+    void FlipEdgesUntilDelaunay(std::vector<unsigned>& rElementsToCheck);
+
+    /**
+     * Helper method for the incremental remeshing methods. Find the element on
+     * the other side of an edge.
+     *
+     * @param elementIndex the index of an element with an edge from node b to node c, in anticlockwise order
+     * @param pNodeB pointer to node b
+     * @param pNodeC pointer to node c
+     * @param rLocalIndexOfB set to the local index of node b in the neighbouring element
+     * @return the neighbouring element, or NULL if the edge is on the boundary
+     */
+    Element<ELEMENT_DIM, SPACE_DIM>* GetNeighbourAcrossEdge(unsigned elementIndex,
+                                                            Node<SPACE_DIM>* pNodeB,
+                                                            Node<SPACE_DIM>* pNodeC,
+                                                            unsigned& rLocalIndexOfB);
+
+    /**
+     * Helper method for the incremental remeshing methods. Store the current
+     * node locations in mNodeLocationsAtLastReMesh.
+     */
+    void RecordNodeLocationsAtReMesh();
+
+    /**
+     * Helper method for the incremental remeshing methods. Create a triangle and add it to the mesh.
+     *
+     * @param pNodeA first node, in anticlockwise order
+     * @param pNodeB second node
+     * @param pNodeC third node
+     * @return the index of the new element
+     */
+    unsigned AddTriangle(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB, Node<SPACE_DIM>* pNodeC);
+
+    /**
+     * @return twice the signed area of the triangle abc, which is positive if
+     * the points are in anticlockwise order. Only the first two coordinates are used.
+     *
+     * @param rA the first point
+     * @param rB the second point
+     * @param rC the third point
+     */
+    static double CalculateOrientation(const c_vector<double, SPACE_DIM>& rA,
+                                       const c_vector<double, SPACE_DIM>& rB,
+                                       const c_vector<double, SPACE_DIM>& rC);
+
+    /**
+     * @return whether the point d lies inside the circumcircle of the anticlockwise triangle abc,
+     * by more than a small tolerance relative to the size of the terms in the determinant.
+     *
+     * @param rA the first point of the triangle
+     * @param rB the second point of the triangle
+     * @param rC the third point of the triangle
+     * @param rD the point to test
+     */
+    static bool IsInsideCircumcircle(const c_vector<double, SPACE_DIM>& rA,
+                                     const c_vector<double, SPACE_DIM>& rB,
+                                     const c_vector<double, SPACE_DIM>& rC,
+                                     const c_vector<double, SPACE_DIM>& rD);
+
 #define COVERAGE_IGNORE
     /**
      * @return true if the mesh is Voronoi local to the given element.
@@ -326,6 +469,40 @@ public:
      */
     void ReMesh();
 
+    /**
+     * Set whether ReMesh() should update the existing triangulation locally, rather
+     * than rebuilding it with triangle every time. This applies to 2D meshes only.
+     *
+     * When enabled, ReMesh() removes the elements around deleted interior nodes and
+     * re-triangulates the hole, splits the element containing each new node (found
+     * by walking across the mesh from the previously split element), and then
+     * restores the Delaunay property by edge flips, starting from the changed
+     * elements and the elements around nodes which have moved since the last
+     * remesh. Node objects are kept rather than recreated.
+     *
+     * This avoids rebuilding the triangulation, but it is not free of work linear
+     * in the size of the mesh: every remesh checks that all elements are still
+     * valid, compares every node with its previous location, recomputes the
+     * Jacobians of all elements and re-indexes the mesh. When every node moves
+     * between remeshes, as in most cell-based simulations, every element is also
+     * checked for edge flips.
+     *
+     * If any element has been inverted, the boundary has become non-convex, or a
+     * node has been added or deleted on the boundary, the mesh is rebuilt from
+     * scratch as before.
+     *
+     * This is not appropriate for meshes whose ReMesh() adds temporary nodes, such
+     * as Cylindrical2dMesh, since these always fall back to a full remesh.
+     *
+     * @param useIncrementalReMesh whether to remesh incrementally (defaults to true)
+     */
+    void SetUseIncrementalReMesh(bool useIncrementalReMesh=true);
+
+    /**
+     * @return whether ReMesh() tries to update the existing triangulation locally.
+     */
+    bool GetUseIncrementalReMesh() const;
+
 #define COVERAGE_IGNORE
     /**
      * Find edges in the mesh longer than the given cutoff length and split them creating new elements as required.
@@ -96,7 +96,8 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void NodePartitioner<ELEMENT_DIM, SPACE_DIM>::MetisLibraryPartitioning(AbstractMeshReader<ELEMENT_DIM, SPACE_DIM>& rMeshReader,
                                                                            std::vector<unsigned>& rNodePermutation,
                                                                            std::set<unsigned>& rNodesOwned,
-                                                                           std::vector<unsigned>& rProcessorsOffset)
+                                                                           std::vector<unsigned>& rProcessorsOffset,
+                                                                           const std::vector<unsigned>& rNodeWeights)
 {
     assert(PetscTools::IsParallel());
     ///\todo #2250 Direct calls to METIS are to be deprecated
@@ -156,11 +157,26 @@ void NodePartitioner<ELEMENT_DIM, SPACE_DIM>::MetisLibraryPartitioning(AbstractM
         {
             eptr[i] = i * (ELEMENT_DIM+1);
         }
+        idxtype* vwgt = NULL;
+        if (!rNodeWeights.empty())
+        {
+            vwgt = new idxtype[nn];
+            for (idxtype i=0; i<nn; i++)
+            {
+                vwgt[i] = rNodeWeights[i];
+            }
+        }
         METIS_PartMeshNodal(&ne, &nn, eptr, elmnts,
-                NULL /*vwgt*/, NULL /*vsize*/, &nparts, NULL /*tpwgts*/,
+                vwgt, NULL /*vsize*/, &nparts, NULL /*tpwgts*/,
                 NULL /*options*/, &edgecut /*aka objval*/, epart, npart);
+        delete[] vwgt;
+        delete[] eptr;
 #else
         //Old interface
+        if (!rNodeWeights.empty())
+        {
+            WARN_ONCE_ONLY("Node weights are ignored by METIS_LIBRARY partitioning with METIS 4.");
+        }
         int numflag = 0; //0 means C-style numbering is assumed
         int etype;
         switch (ELEMENT_DIM)
@@ -236,7 +252,8 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void NodePartitioner<ELEMENT_DIM, SPACE_DIM>::PetscMatrixPartitioning(AbstractMeshReader<ELEMENT_DIM, SPACE_DIM>& rMeshReader,
                                               std::vector<unsigned>& rNodePermutation,
                                               std::set<unsigned>& rNodesOwned,
-                                              std::vector<unsigned>& rProcessorsOffset)
+                                              std::vector<unsigned>& rProcessorsOffset,
+                                              const std::vector<unsigned>& rNodeWeights)
 {
     assert(PetscTools::IsParallel());
     assert(ELEMENT_DIM==2 || ELEMENT_DIM==3); // Metis works with triangles and tetras
@@ -386,6 +403,17 @@ void NodePartitioner<ELEMENT_DIM, SPACE_DIM>::PetscMatrixPartitioning(AbstractMe
     MatPartitioning part;
     MatPartitioningCreate(PETSC_COMM_WORLD, &part);
     MatPartitioningSetAdjacency(part, adj_matrix);
+    if (!rNodeWeights.empty())
+    {
+        // The partitioning object takes ownership of (and frees) the weights array
+        PetscMalloc(num_local_nodes*sizeof(PetscInt), &ptr);
+        PetscInt* vertex_weights = (PetscInt*) ptr;
+        for (unsigned i=0; i<num_local_nodes; i++)
+        {
+            vertex_weights[i] = rNodeWeights[connectivity_matrix_lo + i];
+        }
+        MatPartitioningSetVertexWeights(part, vertex_weights);
+    }
     MatPartitioningSetFromOptions(part);
     IS new_process_numbers;
 
@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define NODEPARTITIONER_HPP_
 
 #include <set>
+#include <vector>
 
 #include "AbstractMesh.hpp"
 #include "AbstractMeshReader.hpp"
@@ -67,12 +68,15 @@ public:
      * @param rNodePermutation is the vector to be filled with node permutation information.
      * @param rNodesOwned is an empty set to be filled with the indices of nodes owned by this process
      * @param rProcessorsOffset a vector of length NumProcs to be filled with the index of the lowest indexed node owned by each process
+     * @param rNodeWeights the relative cost of each node, or an empty vector for an unweighted partition.
+     *     Only used with METIS 5.
      *
      */
     static void MetisLibraryPartitioning(AbstractMeshReader<ELEMENT_DIM, SPACE_DIM>& rMeshReader,
                                          std::vector<unsigned>& rNodePermutation,
                                          std::set<unsigned>& rNodesOwned,
-                                         std::vector<unsigned>& rProcessorsOffset);
+                                         std::vector<unsigned>& rProcessorsOffset,
+                                         const std::vector<unsigned>& rNodeWeights=std::vector<unsigned>());
 
 
     /**
@@ -82,12 +86,14 @@ public:
      * @param rNodePermutation is the vector to be filled with node permutation information.
      * @param rNodesOwned is an empty set to be filled with the indices of nodes owned by this process
      * @param rProcessorsOffset a vector of length NumProcs to be filled with the index of the lowest indexed node owned by each process
+     * @param rNodeWeights the relative cost of each node, or an empty vector for an unweighted partition
      *
      */
     static void PetscMatrixPartitioning(AbstractMeshReader<ELEMENT_DIM, SPACE_DIM>& rMeshReader,
                                         std::vector<unsigned>& rNodePermutation,
                                         std::set<unsigned>& rNodesOwned,
-                                        std::vector<unsigned>& rProcessorsOffset);
+                                        std::vector<unsigned>& rProcessorsOffset,
+                                        const std::vector<unsigned>& rNodeWeights=std::vector<unsigned>());
     /**
      * Specialised method to compute the partition of a mesh based on geometric partitioning
      *
@@ -374,32 +374,60 @@ unsigned TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIndexWithI
 {
     assert(startingElementGuess<this->GetNumElements());
 
-    /*
-     * Let m=startingElementGuess, N=num_elem-1.
-     * We search from in this order: m, m+1, m+2, .. , N, 0, 1, .., m-1.
-     */
-    unsigned i = startingElementGuess;
-    bool reached_end = false;
-
-    while (!reached_end)
+    const std::vector<unsigned>* p_candidates = this->GetElementSpatialIndexCandidates(rTestPoint);
+    if (p_candidates)
     {
-        if (this->mElements[i]->IncludesPoint(rTestPoint, strict))
+        // Find the containing element which comes first in the search order below
+        const unsigned num_elements = this->GetNumElements();
+        unsigned best_index = UNSIGNED_UNSET;
+        unsigned best_offset = UNSIGNED_UNSET;
+        for (unsigned i=0; i<p_candidates->size(); i++)
         {
-            assert(!this->mElements[i]->IsDeleted());
-            return i;
+            unsigned index = (*p_candidates)[i];
+            if (index < num_elements && this->mElements[index]->IncludesPoint(rTestPoint, strict))
+            {
+                unsigned offset = (index + num_elements - startingElementGuess) % num_elements;
+                if (offset < best_offset)
+                {
+                    best_offset = offset;
+                    best_index = index;
+                }
+            }
         }
-
-        // Increment
-        i++;
-        if (i==this->GetNumElements())
+        if (best_index != UNSIGNED_UNSET)
         {
-            i=0;
+            return best_index;
         }
+    }
+    else
+    {
+        /*
+         * Let m=startingElementGuess, N=num_elem-1.
+         * We search from in this order: m, m+1, m+2, .. , N, 0, 1, .., m-1.
+         */
+        unsigned i = startingElementGuess;
+        bool reached_end = false;
 
-        // Back to the beginning yet?
-        if (i==startingElementGuess)
+        while (!reached_end)
         {
-            reached_end = true;
+            if (this->mElements[i]->IncludesPoint(rTestPoint, strict))
+            {
+                assert(!this->mElements[i]->IsDeleted());
+                return i;
+            }
+
+            // Increment
+            i++;
+            if (i==this->GetNumElements())
+            {
+                i=0;
+            }
+
+            // Back to the beginning yet?
+            if (i==startingElementGuess)
+            {
+                reached_end = true;
+            }
         }
     }
 
@@ -418,6 +446,32 @@ unsigned TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIndexWithI
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 unsigned TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetNearestElementIndex(const ChastePoint<SPACE_DIM>& rTestPoint)
 {
+    const std::vector<unsigned>* p_candidates = this->GetElementSpatialIndexCandidates(rTestPoint);
+    if (p_candidates)
+    {
+        /*
+         * An element with no negative interpolation weights is as close as possible, and the candidates
+         * include all such elements in increasing order, so the first one is the element found below.
+         */
+        for (unsigned i=0; i<p_candidates->size(); i++)
+        {
+            c_vector<double, ELEMENT_DIM+1> weight = this->mElements[(*p_candidates)[i]]->CalculateInterpolationWeights(rTestPoint);
+            bool all_non_negative = true;
+            for (unsigned j=0; j<=ELEMENT_DIM; j++)
+            {
+                if (weight[j] < 0.0)
+                {
+                    all_non_negative = false;
+                    break;
+                }
+            }
+            if (all_non_negative)
+            {
+                return (*p_candidates)[i];
+            }
+        }
+    }
+
     double max_min_weight = -std::numeric_limits<double>::infinity();
     unsigned closest_index = 0;
     for (unsigned i=0; i<this->mElements.size(); i++)
@@ -445,12 +499,26 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::vector<unsigned> TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIndices(const ChastePoint<SPACE_DIM> &rTestPoint)
 {
     std::vector<unsigned> element_indices;
-    for (unsigned i=0; i<this->mElements.size(); i++)
+    const std::vector<unsigned>* p_candidates = this->GetElementSpatialIndexCandidates(rTestPoint);
+    if (p_candidates)
     {
-        if (this->mElements[i]->IncludesPoint(rTestPoint))
+        for (unsigned i=0; i<p_candidates->size(); i++)
         {
-            assert(!this->mElements[i]->IsDeleted());
-            element_indices.push_back(i);
+            if (this->mElements[(*p_candidates)[i]]->IncludesPoint(rTestPoint))
+            {
+                element_indices.push_back((*p_candidates)[i]);
+            }
+        }
+    }
+    else
+    {
+        for (unsigned i=0; i<this->mElements.size(); i++)
+        {
+            if (this->mElements[i]->IncludesPoint(rTestPoint))
+            {
+                assert(!this->mElements[i]->IsDeleted());
+                element_indices.push_back(i);
+            }
         }
     }
     return element_indices;
@@ -459,6 +527,8 @@ std::vector<unsigned> TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElem
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
 {
+    this->InvalidateElementSpatialIndex();
+
     // Three loops, just like the destructor. note we don't delete boundary nodes.
     for (unsigned i=0; i<this->mBoundaryElements.size(); i++)
     {
@@ -751,6 +821,7 @@ typename TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::EdgeIterator TetrahedralMesh<E
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
 {
+    AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh();
     RefreshJacobianCachedData();
 }
 
@@ -910,18 +910,27 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
     // If checking for internal intersections as well as on the boundary, then check that no nodes have overlapped any elements...
     if (mCheckForInternalIntersections)
     {
-        ///\todo Change to only loop over neighbouring elements (see #2401)
+        // Only test each node against the elements whose bounding boxes contain it
+        std::vector<unsigned> element_indices;
+        for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
+             elem_iter != this->GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            element_indices.push_back(elem_iter->GetIndex());
+        }
+        SetUpElementBins(element_indices);
+
+        std::vector<unsigned> candidate_elements;
         for (typename AbstractMesh<ELEMENT_DIM,SPACE_DIM>::NodeIterator node_iter = this->GetNodeIteratorBegin();
              node_iter != this->GetNodeIteratorEnd();
              ++node_iter)
         {
             assert(!(node_iter->IsDeleted()));
 
-            for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
-                 elem_iter != this->GetElementIteratorEnd();
-                 ++elem_iter)
+            GetCandidateElementsForPoint(node_iter->rGetLocation(), candidate_elements);
+            for (unsigned i=0; i<candidate_elements.size(); i++)
             {
-                unsigned elem_index = elem_iter->GetIndex();
+                unsigned elem_index = candidate_elements[i];
 
                 // Check that the node is not part of this element
                 if (node_iter->rGetContainingElementIndices().count(elem_index) == 0)
@@ -949,6 +958,9 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
             }
         }
 
+        SetUpElementBins(std::vector<unsigned>(boundary_element_indices.begin(), boundary_element_indices.end()));
+
+        std::vector<unsigned> candidate_elements;
         for (typename AbstractMesh<ELEMENT_DIM,SPACE_DIM>::NodeIterator node_iter = this->GetNodeIteratorBegin();
              node_iter != this->GetNodeIteratorEnd();
              ++node_iter)
@@ -957,16 +969,15 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
             {
                 assert(!(node_iter->IsDeleted()));
 
-                for (std::set<unsigned>::iterator elem_iter = boundary_element_indices.begin();
-                     elem_iter != boundary_element_indices.end();
-                     ++elem_iter)
+                GetCandidateElementsForPoint(node_iter->rGetLocation(), candidate_elements);
+                for (unsigned i=0; i<candidate_elements.size(); i++)
                 {
                     // Check that the node is not part of this element
-                    if (node_iter->rGetContainingElementIndices().count(*elem_iter) == 0)
+                    if (node_iter->rGetContainingElementIndices().count(candidate_elements[i]) == 0)
                     {
-                        if (this->ElementIncludesPoint(node_iter->rGetLocation(), *elem_iter))
+                        if (this->ElementIncludesPoint(node_iter->rGetLocation(), candidate_elements[i]))
                         {
-                            PerformT3Swap(&(*node_iter), *elem_iter);
+                            PerformT3Swap(&(*node_iter), candidate_elements[i]);
                             return true;
                         }
                     }
@@ -978,6 +989,211 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
     return false;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::SetUpElementBins(const std::vector<unsigned>& rElementIndices)
+{
+    mElementBins.clear();
+    mWrappedElements.clear();
+    mElementBoundingBoxes.resize(this->GetNumAllElements());
+
+    c_vector<double, SPACE_DIM> lower_corner;
+    c_vector<double, SPACE_DIM> upper_corner;
+    double total_extent = 0.0;
+    std::vector<unsigned> binned_elements;
+
+    for (unsigned i=0; i<rElementIndices.size(); i++)
+    {
+        unsigned elem_index = rElementIndices[i];
+        VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = this->GetElement(elem_index);
+
+        /*
+         * Measure the element relative to its first node, as ElementIncludesPoint() does. If this
+         * differs from the plain node locations then the element crosses a periodic boundary.
+         */
+        c_vector<double, SPACE_DIM> first_node_location = p_element->GetNodeLocation(0);
+        c_vector<double, 2*SPACE_DIM> bounding_box;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            bounding_box[2*d] = first_node_location[d];
+            bounding_box[2*d+1] = first_node_location[d];
+        }
+
+        bool is_wrapped = false;
+        for (unsigned local_index=1; local_index<p_element->GetNumNodes(); local_index++)
+        {
+            c_vector<double, SPACE_DIM> node_location = p_element->GetNodeLocation(local_index);
+            c_vector<double, SPACE_DIM> unwrapped_location = first_node_location + this->GetVectorFromAtoB(first_node_location, node_location);
+            for (unsigned d=0; d<SPACE_DIM; d++)
+            {
+                if (fabs(unwrapped_location[d] - node_location[d]) > 1e-10*(1.0 + fabs(node_location[d])))
+                {
+                    is_wrapped = true;
+                }
+                bounding_box[2*d] = std::min(bounding_box[2*d], node_location[d]);
+                bounding_box[2*d+1] = std::max(bounding_box[2*d+1], node_location[d]);
+            }
+        }
+
+        if (is_wrapped)
+        {
+            mWrappedElements.push_back(elem_index);
+            continue;
+        }
+
+        // Pad the bounding box slightly to allow for rounding in ElementIncludesPoint()
+        double max_extent = 0.0;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            max_extent = std::max(max_extent, bounding_box[2*d+1] - bounding_box[2*d]);
+        }
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            double padding = 1e-10*(max_extent + fabs(bounding_box[2*d]) + fabs(bounding_box[2*d+1]));
+            bounding_box[2*d] -= padding;
+            bounding_box[2*d+1] += padding;
+
+            if (binned_elements.empty() || bounding_box[2*d] < lower_corner[d])
+            {
+                lower_corner[d] = bounding_box[2*d];
+            }
+            if (binned_elements.empty() || bounding_box[2*d+1] > upper_corner[d])
+            {
+                upper_corner[d] = bounding_box[2*d+1];
+            }
+        }
+
+        mElementBoundingBoxes[elem_index] = bounding_box;
+        total_extent += max_extent;
+        binned_elements.push_back(elem_index);
+    }
+
+    if (binned_elements.empty())
+    {
+        mElementBinsOrigin = zero_vector<double>(SPACE_DIM);
+        mElementBinWidth = 1.0;
+        mNumElementBins = zero_vector<unsigned>(SPACE_DIM);
+        mElementBins.resize(1);
+        return;
+    }
+
+    /*
+     * Use bins about the size of a typical element, so each element overlaps a few bins,
+     * but no more bins than elements in case a few elements are spread over a large domain.
+     */
+    double domain_volume = 1.0;
+    for (unsigned d=0; d<SPACE_DIM; d++)
+    {
+        domain_volume *= upper_corner[d] - lower_corner[d];
+    }
+    double bin_width = std::max(total_extent/binned_elements.size(),
+                                pow(domain_volume/binned_elements.size(), 1.0/SPACE_DIM));
+    if (!(bin_width > 0.0))
+    {
+        bin_width = 1.0;
+    }
+
+    mElementBinsOrigin = lower_corner;
+    mElementBinWidth = bin_width;
+    unsigned num_bins = 1;
+    for (unsigned d=0; d<SPACE_DIM; d++)
+    {
+        mNumElementBins[d] = (unsigned) floor((upper_corner[d] - lower_corner[d])/bin_width) + 1;
+        num_bins *= mNumElementBins[d];
+    }
+    mElementBins.resize(num_bins + 1);
+
+    for (unsigned i=0; i<binned_elements.size(); i++)
+    {
+        const c_vector<double, 2*SPACE_DIM>& r_box = mElementBoundingBoxes[binned_elements[i]];
+
+        c_vector<unsigned, SPACE_DIM> lower_bin;
+        c_vector<unsigned, SPACE_DIM> upper_bin;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            lower_bin[d] = std::min((unsigned) floor((r_box[2*d] - lower_corner[d])/bin_width), mNumElementBins[d]-1);
+            upper_bin[d] = std::min((unsigned) floor((r_box[2*d+1] - lower_corner[d])/bin_width), mNumElementBins[d]-1);
+        }
+
+        // Add the element to every bin in the block between lower_bin and upper_bin
+        c_vector<unsigned, SPACE_DIM> bin = lower_bin;
+        bool finished = false;
+        while (!finished)
+        {
+            unsigned bin_index = 0;
+            for (unsigned d=SPACE_DIM; d>0; d--)
+            {
+                bin_index = bin_index*mNumElementBins[d-1] + bin[d-1];
+            }
+            mElementBins[bin_index].push_back(binned_elements[i]);
+
+            finished = true;
+            for (unsigned d=0; d<SPACE_DIM && finished; d++)
+            {
+                if (bin[d] < upper_bin[d])
+                {
+                    bin[d]++;
+                    finished = false;
+                }
+                else
+                {
+                    bin[d] = lower_bin[d];
+                }
+            }
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCandidateElementsForPoint(const c_vector<double, SPACE_DIM>& rPoint, std::vector<unsigned>& rCandidates)
+{
+    assert(!mElementBins.empty());
+    rCandidates.clear();
+
+    // Find the bin containing the point, using the empty last bin if it is outside the grid
+    unsigned bin_index = 0;
+    bool is_inside_grid = true;
+    for (unsigned d=SPACE_DIM; d>0; d--)
+    {
+        double offset = (rPoint[d-1] - mElementBinsOrigin[d-1])/mElementBinWidth;
+        if (offset < 0.0 || offset >= mNumElementBins[d-1])
+        {
+            is_inside_grid = false;
+            break;
+        }
+        bin_index = bin_index*mNumElementBins[d-1] + (unsigned) floor(offset);
+    }
+    const std::vector<unsigned>& r_bin = is_inside_grid ? mElementBins[bin_index] : mElementBins.back();
+
+    // Merge the elements in the bin whose bounding boxes contain the point with the wrapped elements
+    unsigned i = 0;
+    unsigned j = 0;
+    while (i < r_bin.size() || j < mWrappedElements.size())
+    {
+        if (j == mWrappedElements.size() || (i < r_bin.size() && r_bin[i] < mWrappedElements[j]))
+        {
+            const c_vector<double, 2*SPACE_DIM>& r_box = mElementBoundingBoxes[r_bin[i]];
+            bool box_contains_point = true;
+            for (unsigned d=0; d<SPACE_DIM; d++)
+            {
+                if (rPoint[d] < r_box[2*d] || rPoint[d] > r_box[2*d+1])
+                {
+                    box_contains_point = false;
+                }
+            }
+            if (box_contains_point)
+            {
+                rCandidates.push_back(r_bin[i]);
+            }
+            i++;
+        }
+        else
+        {
+            rCandidates.push_back(mWrappedElements[j]);
+            j++;
+        }
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::IdentifySwapType(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
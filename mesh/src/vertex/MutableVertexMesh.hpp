@@ -106,6 +106,36 @@ protected:
      */
     std::vector< c_vector<double, SPACE_DIM> > mLocationsOfT3Swaps;
 
+    /**
+     * The lower corner of the uniform grid of bins used by CheckForIntersections()
+     * to find the elements near each node. Not archived, as it is rebuilt by each check.
+     */
+    c_vector<double, SPACE_DIM> mElementBinsOrigin;
+
+    /** The width of each bin in the grid used by CheckForIntersections(). */
+    double mElementBinWidth;
+
+    /** The number of bins in each direction in the grid used by CheckForIntersections(). */
+    c_vector<unsigned, SPACE_DIM> mNumElementBins;
+
+    /**
+     * For each bin, the indices (in increasing order) of the elements whose bounding
+     * boxes overlap it. There is one extra, empty, bin at the end for points outside the grid.
+     */
+    std::vector<std::vector<unsigned> > mElementBins;
+
+    /**
+     * The bounding boxes of the binned elements, indexed by element index, in
+     * the form (for 2D) (xmin, xmax, ymin, ymax).
+     */
+    std::vector<c_vector<double, 2*SPACE_DIM> > mElementBoundingBoxes;
+
+    /**
+     * Indices (in increasing order) of elements which wrap around a periodic boundary,
+     * so cannot be binned by their bounding boxes and are instead checked against every point.
+     */
+    std::vector<unsigned> mWrappedElements;
+
     /**
      * Divide an element along the axis passing through two of its nodes.
      *
@@ -146,6 +176,24 @@ protected:
      */
     bool CheckForIntersections();
 
+    /**
+     * Helper method for CheckForIntersections(). Place the given elements into the bins of a
+     * uniform grid according to their bounding boxes, so that the elements that could
+     * contain a point can be found without looping over the whole mesh.
+     *
+     * @param rElementIndices the indices of the elements to bin, in increasing order
+     */
+    void SetUpElementBins(const std::vector<unsigned>& rElementIndices);
+
+    /**
+     * Helper method for CheckForIntersections(). Must be called after SetUpElementBins().
+     *
+     * @param rPoint the point
+     * @param rCandidates filled with the indices (in increasing order) of the binned elements
+     *     which could contain the point; every element containing the point is included
+     */
+    void GetCandidateElementsForPoint(const c_vector<double, SPACE_DIM>& rPoint, std::vector<unsigned>& rCandidates);
+
     /**
      * Helper method for ReMesh(), called by CheckForSwapsFromShortEdges() when
      * neighbouring nodes in an element have been found to be closer than the mCellRearrangementThreshold
@@ -46,6 +46,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Exception.hpp"
 
 #include <mpi.h> // For MPI_Send, MPI_Recv
+#include <algorithm>
 
 const char* MeshEventHandler::EventName[] = { "Tri write","BinTri write","VTK write","PVTK write", "node write", "ele write", "face write", "ncl write", "comm1","comm2","Total"};
 
@@ -74,6 +75,7 @@ AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::AbstractTetrahedralMeshWr
                    const bool clearOutputDir)
     : AbstractMeshWriter<ELEMENT_DIM, SPACE_DIM>(rDirectory, rBaseName, clearOutputDir),
       mpNodeMap(NULL),
+      mParallelWriteBlockSize(65536),
       mNodesPerElement(ELEMENT_DIM+1),
       mNodesPerBoundaryElement(ELEMENT_DIM),
       mpMesh(NULL),
@@ -89,6 +91,7 @@ AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::AbstractTetrahedralMeshWr
     mpIters->pNodeIter = NULL;
     mpIters->pElemIter = NULL;
     mpIters->pBoundaryElemIter = NULL;
+    std::fill(mNextBlockToReceive, mNextBlockToReceive + NUM_PARALLEL_ENTITY_KINDS, 0u);
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -115,6 +118,74 @@ AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::~AbstractTetrahedralMeshW
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::SetParallelWriteBlockSize(unsigned blockSize)
+{
+    assert(blockSize > 0);
+    mParallelWriteBlockSize = blockSize;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::SendBlocks(std::vector<std::vector<double> >& rBlocks,
+                                                                      ParallelEntityKind kind)
+{
+    assert(!PetscTools::AmMaster());
+    MeshEventHandler::BeginEvent(MeshEventHandler::COMM1);
+    // The master receives every block (even empty ones) from each process in turn
+    for (unsigned block=0; block<rBlocks.size(); block++)
+    {
+        std::vector<double>& r_block = rBlocks[block];
+        MPI_Send(r_block.empty() ? NULL : &r_block[0], r_block.size(), MPI_DOUBLE, 0, kind, PETSC_COMM_WORLD);
+    }
+    MeshEventHandler::EndEvent(MeshEventHandler::COMM1);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const double* AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetReceivedEntity(ParallelEntityKind kind,
+                                                                                      unsigned globalIndex,
+                                                                                      unsigned entrySize)
+{
+    assert(PetscTools::AmMaster());
+    std::vector<double>& r_data = mReceivedBlockData[kind];
+    std::vector<bool>& r_has_entry = mReceivedBlockHasEntry[kind];
+
+    unsigned block = globalIndex/mParallelWriteBlockSize;
+    if (block == mNextBlockToReceive[kind])
+    {
+        // Receive the next block from each slave in turn
+        MeshEventHandler::BeginEvent(MeshEventHandler::COMM1);
+        unsigned block_start = block*mParallelWriteBlockSize;
+        r_data.resize(mParallelWriteBlockSize*entrySize);
+        r_has_entry.assign(mParallelWriteBlockSize, false);
+        std::vector<double> buffer;
+        for (unsigned proc=1; proc<PetscTools::GetNumProcs(); proc++)
+        {
+            MPI_Status status;
+            MPI_Probe(proc, kind, PETSC_COMM_WORLD, &status);
+            int count;
+            MPI_Get_count(&status, MPI_DOUBLE, &count);
+            buffer.resize(count);
+            MPI_Recv(buffer.empty() ? NULL : &buffer[0], count, MPI_DOUBLE, proc, kind, PETSC_COMM_WORLD, &status);
+            assert(count%(entrySize+1) == 0);
+
+            for (unsigned offset=0; offset<buffer.size(); offset+=entrySize+1)
+            {
+                unsigned position = static_cast<unsigned>(buffer[offset]) - block_start;
+                assert(position < mParallelWriteBlockSize);
+                r_has_entry[position] = true;
+                std::copy(buffer.begin()+offset+1, buffer.begin()+offset+1+entrySize, r_data.begin()+position*entrySize);
+            }
+        }
+        mNextBlockToReceive[kind]++;
+        MeshEventHandler::EndEvent(MeshEventHandler::COMM1);
+    }
+    // Entities must be asked for in order
+    assert(block+1 == mNextBlockToReceive[kind]);
+
+    unsigned position = globalIndex - block*mParallelWriteBlockSize;
+    return r_has_entry[position] ? &r_data[position*entrySize] : NULL;
+}
+
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::vector<double> AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextNode()
@@ -125,36 +196,29 @@ std::vector<double> AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNe
     {
         std::vector<double> coords(SPACE_DIM);
 
-        //Iterate over the locally-owned nodes
-        if ( (*(mpIters->pNodeIter)) != mpMesh->GetNodeIteratorEnd())
+        if (mpDistributedMesh == NULL) // not using parallel mesh
         {
-            // Either this is a sequential mesh (and we own it all)
-            // or it's parallel (and the master owns the first chunk)
+            // Iterate over the nodes
+            assert((*(mpIters->pNodeIter)) != mpMesh->GetNodeIteratorEnd());
             for (unsigned j=0; j<SPACE_DIM; j++)
             {
                 coords[j] = (*(mpIters->pNodeIter))->GetPoint()[j];
             }
 
-            mNodeCounterForParallelMesh=(*(mpIters->pNodeIter))->GetIndex() + 1;//Ready for when we run out of local nodes
-
             ++(*(mpIters->pNodeIter));
             return coords;
         }
 
-        // If we didn't return then the iterator has reached the end of the local nodes.
-        // It must be a parallel mesh and we are expecting messages...
-
-        assert( mpDistributedMesh != NULL );
-
-        MPI_Status status;
-        status.MPI_ERROR = MPI_SUCCESS; //For MPICH2
-        // do receive, convert to std::vector on master
-        boost::scoped_array<double> raw_coords(new double[SPACE_DIM]);
-        MPI_Recv(raw_coords.get(), SPACE_DIM, MPI_DOUBLE, MPI_ANY_SOURCE, mNodeCounterForParallelMesh, PETSC_COMM_WORLD, &status);
-        assert(status.MPI_ERROR == MPI_SUCCESS);
-        for (unsigned j=0; j<coords.size(); j++)
+        // It's a parallel mesh, so the node either came from a slave or the master owns it
+        const double* p_coords = GetReceivedEntity(NODES, mNodeCounterForParallelMesh, SPACE_DIM);
+        if (p_coords != NULL)
+        {
+            std::copy(p_coords, p_coords+SPACE_DIM, coords.begin());
+        }
+        else
         {
-            coords[j] = raw_coords[j];
+            const c_vector<double, SPACE_DIM>& r_location = mpMesh->GetNode(mNodeCounterForParallelMesh)->rGetLocation();
+            std::copy(r_location.begin(), r_location.end(), coords.begin());
         }
 
         mNodeCounterForParallelMesh++;
@@ -196,9 +260,11 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextElemen
         else //Parallel mesh
         {
             //Use the mElementCounterForParallelMesh variable to identify next element
-            if ( mpDistributedMesh->CalculateDesignatedOwnershipOfElement( mElementCounterForParallelMesh ) == true )
+            const double* p_data = GetReceivedEntity(ELEMENTS, mElementCounterForParallelMesh, mNodesPerElement+1);
+            if (p_data == NULL)
             {
                 //Master owns this element
+                assert(mpDistributedMesh->CalculateDesignatedOwnershipOfElement(mElementCounterForParallelMesh));
                 Element<ELEMENT_DIM, SPACE_DIM>* p_element = mpDistributedMesh->GetElement(mElementCounterForParallelMesh);
                 assert(elem_data.NodeIndices.size() == mNodesPerElement);
                 assert( ! p_element->IsDeleted() );
@@ -212,7 +278,7 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextElemen
             else
             {
                 //Master doesn't own this element.
-                UnpackElement(elem_data, mElementCounterForParallelMesh, mNodesPerElement, this->mNumNodes +  mElementCounterForParallelMesh);
+                UnpackElement(elem_data, p_data);
             }
             // increment element counter
             mElementCounterForParallelMesh++;
@@ -253,10 +319,12 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextBounda
         }
         else //Parallel mesh
         {
-            //Use the mElementCounterForParallelMesh variable to identify next element
-            if ( mpDistributedMesh->CalculateDesignatedOwnershipOfBoundaryElement( mBoundaryElementCounterForParallelMesh ) == true )
+            //Use the mBoundaryElementCounterForParallelMesh variable to identify next element
+            const double* p_data = GetReceivedEntity(BOUNDARY_ELEMENTS, mBoundaryElementCounterForParallelMesh, ELEMENT_DIM+1);
+            if (p_data == NULL)
             {
                 //Master owns this boundary element
+                assert(mpDistributedMesh->CalculateDesignatedOwnershipOfBoundaryElement(mBoundaryElementCounterForParallelMesh));
                 BoundaryElement<ELEMENT_DIM-1, SPACE_DIM>* p_boundary_element = mpDistributedMesh->GetBoundaryElement(mBoundaryElementCounterForParallelMesh);
                 assert(boundary_elem_data.NodeIndices.size() == ELEMENT_DIM);
                 assert( ! p_boundary_element->IsDeleted() );
@@ -270,7 +338,7 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextBounda
             else
             {
                 //Master doesn't own this boundary element.
-                UnpackElement(boundary_elem_data, mBoundaryElementCounterForParallelMesh, ELEMENT_DIM, this->mNumNodes + this->mNumElements + mBoundaryElementCounterForParallelMesh);
+                UnpackElement(boundary_elem_data, p_data);
             }
             // increment element counter
             mBoundaryElementCounterForParallelMesh++;
@@ -300,9 +368,11 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextCableE
         elem_data.NodeIndices.resize(2);
 
         //Use the mCableElementCounterForParallelMesh variable to identify next element
-        if ( mpMixedMesh->CalculateDesignatedOwnershipOfCableElement( mCableElementCounterForParallelMesh ) == true )
+        const double* p_data = GetReceivedEntity(CABLE_ELEMENTS, mCableElementCounterForParallelMesh, 3);
+        if (p_data == NULL)
         {
             //Master owns this element
+            assert(mpMixedMesh->CalculateDesignatedOwnershipOfCableElement(mCableElementCounterForParallelMesh));
             Element<1, SPACE_DIM>* p_element = mpMixedMesh->GetCableElement(mCableElementCounterForParallelMesh);
             assert( ! p_element->IsDeleted() );
             //Master can use the local data to recover node indices & attribute
@@ -315,7 +385,7 @@ ElementData AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::GetNextCableE
         else
         {
             //Master doesn't own this element.
-            UnpackElement(elem_data, mCableElementCounterForParallelMesh, 2, this->mNumNodes + this->mNumElements + this->mNumBoundaryElements + mCableElementCounterForParallelMesh);
+            UnpackElement(elem_data, p_data);
         }
         // increment element counter
         mCableElementCounterForParallelMesh++;
@@ -534,6 +604,8 @@ void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::WriteFilesUsingParal
 {
     if (keepOriginalElementIndexing)
     {
+        std::fill(mNextBlockToReceive, mNextBlockToReceive + NUM_PARALLEL_ENTITY_KINDS, 0u);
+
         // Master goes on to write as usual
         if (PetscTools::AmMaster())
         {
@@ -541,25 +613,31 @@ void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::WriteFilesUsingParal
         }
         else
         {
-//            PetscTools::Barrier("DodgyBarrierBeforeNODE");
+            /*
+             * Slaves pack the entities they own into one buffer per block of global indices, and
+             * send each block to the master in a single message.  The master receives the blocks in
+             * order as it writes, so doesn't need to hold more than one block of each kind at once.
+             */
             MeshEventHandler::BeginEvent(MeshEventHandler::NODE);
-            boost::scoped_array<double> raw_coords(new double[SPACE_DIM]);
             // Slaves concentrate the Nodes
+            std::vector<std::vector<double> > node_blocks((this->mNumNodes + mParallelWriteBlockSize - 1)/mParallelWriteBlockSize);
+            std::vector<double> coords(SPACE_DIM);
             typedef typename AbstractMesh<ELEMENT_DIM,SPACE_DIM>::NodeIterator NodeIterType;
             for (NodeIterType it = mpMesh->GetNodeIteratorBegin(); it != mpMesh->GetNodeIteratorEnd(); ++it)
             {
                 for (unsigned j=0; j<SPACE_DIM; j++)
                 {
-                    raw_coords[j] = it->GetPoint()[j];
+                    coords[j] = it->GetPoint()[j];
                 }
-                MPI_Ssend(raw_coords.get(), SPACE_DIM, MPI_DOUBLE, 0, it->GetIndex(), PETSC_COMM_WORLD);//Nodes sent with positive tags
+                PackEntity(node_blocks, it->GetIndex(), coords);
             }
-//            PetscTools::Barrier("DodgyBarrierAfterNODE");
+            SendBlocks(node_blocks, NODES);
             MeshEventHandler::EndEvent(MeshEventHandler::NODE);
 
             MeshEventHandler::BeginEvent(MeshEventHandler::ELE);
             // Slaves concentrate the Elements for which they are owners
-            boost::scoped_array<unsigned> raw_indices(new unsigned[mNodesPerElement]); // Assuming that we don't have parallel quadratic elements
+            std::vector<std::vector<double> > element_blocks((this->mNumElements + mParallelWriteBlockSize - 1)/mParallelWriteBlockSize);
+            std::vector<double> element_data(mNodesPerElement+1); // Node indices followed by the attribute
             typedef typename AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>::ElementIterator ElementIterType;
             for (ElementIterType it = mpMesh->GetElementIteratorBegin(); it != mpMesh->GetElementIteratorEnd(); ++it)
             {
@@ -568,18 +646,21 @@ void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::WriteFilesUsingParal
                 {
                     for (unsigned j=0; j<mNodesPerElement; j++)
                     {
-                        raw_indices[j] = it->GetNodeGlobalIndex(j);
+                        element_data[j] = it->GetNodeGlobalIndex(j);
                     }
-                    PostElement(index, raw_indices.get(), mNodesPerElement, this->mNumNodes + index, it->GetAttribute());
+                    element_data[mNodesPerElement] = it->GetAttribute();
+                    PackEntity(element_blocks, index, element_data);
                 }
             }
-//            PetscTools::Barrier("DodgyBarrierAfterELE");
+            SendBlocks(element_blocks, ELEMENTS);
             MeshEventHandler::EndEvent(MeshEventHandler::ELE);
+
             MeshEventHandler::BeginEvent(MeshEventHandler::FACE);
             // Slaves concentrate the Faces for which they are owners (not in 1-d)
             if (ELEMENT_DIM != 1)  /// \todo #2351 Also exclude VTK writer
             {
-                boost::scoped_array<unsigned> raw_face_indices(new unsigned[ELEMENT_DIM]); // Assuming that we don't have parallel quadratic meshes
+                std::vector<std::vector<double> > face_blocks((this->mNumBoundaryElements + mParallelWriteBlockSize - 1)/mParallelWriteBlockSize);
+                std::vector<double> face_data(ELEMENT_DIM+1); // Assuming that we don't have parallel quadratic meshes
                 typedef typename AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>::BoundaryElementIterator BoundaryElementIterType;
                 for (BoundaryElementIterType it = mpMesh->GetBoundaryElementIteratorBegin(); it != mpMesh->GetBoundaryElementIteratorEnd(); ++it)
                 {
@@ -588,32 +669,36 @@ void AbstractTetrahedralMeshWriter<ELEMENT_DIM, SPACE_DIM>::WriteFilesUsingParal
                     {
                         for (unsigned j=0; j<ELEMENT_DIM; j++)
                         {
-                            raw_face_indices[j] = (*it)->GetNodeGlobalIndex(j);
+                            face_data[j] = (*it)->GetNodeGlobalIndex(j);
                         }
-                        PostElement(index, raw_face_indices.get(), ELEMENT_DIM, this->mNumNodes + this->mNumElements + index, (*it)->GetAttribute());
+                        face_data[ELEMENT_DIM] = (*it)->GetAttribute();
+                        PackEntity(face_blocks, index, face_data);
                     }
                 }
+                SendBlocks(face_blocks, BOUNDARY_ELEMENTS);
             }
-//            PetscTools::Barrier("DodgyBarrierAfterFACE");
             MeshEventHandler::EndEvent(MeshEventHandler::FACE);
 
             // Slaves concentrate the cable elements for which they are owners
             if (mpMixedMesh)
             {
+                std::vector<std::vector<double> > cable_blocks((this->mNumCableElements + mParallelWriteBlockSize - 1)/mParallelWriteBlockSize);
+                std::vector<double> cable_data(3);
                 typedef typename MixedDimensionMesh<ELEMENT_DIM,SPACE_DIM>::CableElementIterator CableElementIterType;
                 for (CableElementIterType it = mpMixedMesh->GetCableElementIteratorBegin(); it != mpMixedMesh->GetCableElementIteratorEnd(); ++it)
                 {
                     unsigned index =(*it)->GetIndex();
                     if ( mpMixedMesh->CalculateDesignatedOwnershipOfCableElement( index ) == true )
                     {
-                        unsigned raw_cable_element_indices[2];
                         for (unsigned j=0; j<2; j++)
                         {
-                            raw_cable_element_indices[j] = (*it)->GetNodeGlobalIndex(j);
+                            cable_data[j] = (*it)->GetNodeGlobalIndex(j);
                         }
-                        PostElement(index, raw_cable_element_indices, 2, this->mNumNodes + this->mNumElements + this->mNumBoundaryElements + index, (*it)->GetAttribute());
+                        cable_data[2] = (*it)->GetAttribute();
+                        PackEntity(cable_blocks, index, cable_data);
                     }
                 }
+                SendBlocks(cable_blocks, CABLE_ELEMENTS);
             }
         }
         PetscTools::Barrier("AbstractTetrahedralMeshWriter::WriteFilesUsingParallelMesh");
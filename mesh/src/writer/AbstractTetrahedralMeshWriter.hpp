@@ -89,61 +89,66 @@ class AbstractTetrahedralMeshWriter : public AbstractMeshWriter<ELEMENT_DIM, SPA
 {
 private:
     /**
-     * Post an element from a slave process to the master for concentration
-     * @param globalIndex index of this element
-     * @param indices the node index data for this element
-     * @param numIndices number of indices
-     * @param tag temporary
-     * @param attribute
+     * The kinds of mesh entity that the master process receives from the others when writing
+     * a parallel mesh with the original indexing.  These are also used as message tags.
      */
-    void PostElement(unsigned globalIndex, unsigned indices[], unsigned numIndices, unsigned tag, double attribute)
+    enum ParallelEntityKind
     {
-        MeshEventHandler::BeginEvent(MeshEventHandler::COMM1);
-        MPI_Ssend(indices, numIndices, MPI_UNSIGNED, 0,
-                  tag, //Elements sent with tags offset
-                  PETSC_COMM_WORLD);
-        MeshEventHandler::EndEvent(MeshEventHandler::COMM1);
-        // Attribute value has the same tag (assume that it doesn't overtake the previous message)
-        MeshEventHandler::BeginEvent(MeshEventHandler::COMM2);
-        MPI_Ssend(&attribute, 1, MPI_DOUBLE, 0,
-                  tag, //Elements sent with tags offset
-                  PETSC_COMM_WORLD);
-        MeshEventHandler::EndEvent(MeshEventHandler::COMM2);
+        NODES=0,
+        ELEMENTS,
+        BOUNDARY_ELEMENTS,
+        CABLE_ELEMENTS,
+        NUM_PARALLEL_ENTITY_KINDS
+    };
+
+    /**
+     * Pack an entity owned by a slave process into the buffer for the block of global indices it
+     * lies in, ready for sending to the master by SendBlocks().  Each entry in a buffer is the
+     * entity's global index followed by its data.
+     *
+     * @param rBlocks  the buffers, one per block
+     * @param globalIndex  index of this entity
+     * @param rData  the entity's data (node coordinates, or element node indices followed by the attribute)
+     */
+    void PackEntity(std::vector<std::vector<double> >& rBlocks, unsigned globalIndex, const std::vector<double>& rData)
+    {
+        std::vector<double>& r_block = rBlocks[globalIndex/mParallelWriteBlockSize];
+        r_block.push_back(globalIndex);
+        r_block.insert(r_block.end(), rData.begin(), rData.end());
     }
+
     /**
-     * Unpack an element from a slave process on the master for concentration
-     * @param rElementData the output structure to fill (should have the NodeIndices structure of the correct size
-     * @param globalIndex index of this element
-     * @param numIndices number of indices
-     * @param tag temporary
+     * Send a slave process's packed entities of one kind to the master, with one message per block.
+     *
+     * @param rBlocks  the buffers filled by PackEntity()
+     * @param kind  which kind of entity these are
      */
-    void UnpackElement(ElementData& rElementData, unsigned globalIndex, unsigned numIndices, unsigned tag)
+    void SendBlocks(std::vector<std::vector<double> >& rBlocks, ParallelEntityKind kind);
+
+    /**
+     * Get an entity owned by a slave process on the master, receiving the block containing it
+     * from all the slaves if we haven't yet.  Entities must be asked for in order of global index.
+     *
+     * @return the entity's data, or NULL if no slave sent it (so the master owns it)
+     * @param kind  which kind of entity this is
+     * @param globalIndex  index of the entity
+     * @param entrySize  the size of the entity's data
+     */
+    const double* GetReceivedEntity(ParallelEntityKind kind, unsigned globalIndex, unsigned entrySize);
+
+    /**
+     * Unpack an element's data, as sent by a slave process, on the master.
+     *
+     * @param rElementData  the output structure to fill (should have the NodeIndices structure of the correct size)
+     * @param pData  the node indices followed by the attribute value
+     */
+    void UnpackElement(ElementData& rElementData, const double* pData)
     {
-        assert( numIndices == rElementData.NodeIndices.size());
-        boost::scoped_array<unsigned> raw_indices(new unsigned[numIndices]);
-        MPI_Status status;
-        // Get it from elsewhere
-        MeshEventHandler::BeginEvent(MeshEventHandler::COMM1);
-        MPI_Recv(raw_indices.get(), numIndices, MPI_UNSIGNED, MPI_ANY_SOURCE,
-                 tag,
-                 PETSC_COMM_WORLD, &status);
-        MeshEventHandler::EndEvent(MeshEventHandler::COMM1);
-        // Convert to std::vector
-        for (unsigned j=0; j< rElementData.NodeIndices.size(); j++)
+        for (unsigned j=0; j<rElementData.NodeIndices.size(); j++)
         {
-            rElementData.NodeIndices[j] = raw_indices[j];
+            rElementData.NodeIndices[j] = static_cast<unsigned>(pData[j]);
         }
-
-        // Attribute value has the same tag (assume that it doesn't overtake the previous message)
-        double attribute;
-        MeshEventHandler::BeginEvent(MeshEventHandler::COMM2);
-        MPI_Recv(&attribute, 1U, MPI_DOUBLE, MPI_ANY_SOURCE,
-                 tag,
-                 PETSC_COMM_WORLD, &status);
-        MeshEventHandler::EndEvent(MeshEventHandler::COMM2);
-
-        // Attribute value
-        rElementData.AttributeValue = attribute;
+        rElementData.AttributeValue = pData[rElementData.NodeIndices.size()];
     }
 
     /**
@@ -181,6 +186,18 @@ private:
 
     NodeMap* mpNodeMap; /**<Node map to be used when writing a mesh that has deleted nodes*/
 
+    /** How many consecutive global indices' worth of entities to send to the master in each message when writing a parallel mesh. */
+    unsigned mParallelWriteBlockSize;
+
+    /** For each kind of entity, the next block the master will receive from the slaves. */
+    unsigned mNextBlockToReceive[NUM_PARALLEL_ENTITY_KINDS];
+
+    /** For each kind of entity, the data of the block most recently received by the master, stored by position in the block. */
+    std::vector<double> mReceivedBlockData[NUM_PARALLEL_ENTITY_KINDS];
+
+    /** For each kind of entity, which positions in the block most recently received by the master were sent by a slave. */
+    std::vector<bool> mReceivedBlockHasEntry[NUM_PARALLEL_ENTITY_KINDS];
+
 protected:
 
     unsigned mNodesPerElement; /**< Same as (ELEMENT_DIM+1), except when writing a quadratic mesh!*/
@@ -217,6 +234,15 @@ public:
      */
     virtual ~AbstractTetrahedralMeshWriter();
 
+    /**
+     * Set how many consecutive global indices' worth of nodes or elements the other processes
+     * send to the master in each message when writing a parallel mesh with its original indexing.
+     * Larger blocks mean fewer messages, at the cost of more memory on the master.
+     *
+     * @param blockSize  the block size (defaults to 65536)
+     */
+    void SetParallelWriteBlockSize(unsigned blockSize);
+
     /**
      * Write a const mesh to file. Used by the serialization methods and avoids iterators...
      *
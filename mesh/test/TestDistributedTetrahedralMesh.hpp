@@ -863,6 +863,153 @@ public:
     }
 
 
+    void TestWeightedPartitioning() throw (Exception)
+    {
+        // Dumb partition: the first half of the nodes are 4 times as expensive as the rest
+        {
+            TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/disk_984_elements");
+            std::vector<unsigned> weights(mesh_reader.GetNumNodes(), 1u);
+            for (unsigned i=0; i<weights.size()/2; i++)
+            {
+                weights[i] = 4u;
+            }
+
+            DistributedTetrahedralMesh<2,2> mesh(DistributedTetrahedralMeshPartitionType::DUMB);
+            TS_ASSERT(mesh.rGetNodeWeights().empty());
+            mesh.SetNodeWeights(std::vector<unsigned>(10u, 1u));
+            TS_ASSERT_THROWS_THIS(mesh.ConstructFromMeshReader(mesh_reader),
+                                  "The number of node weights does not match the number of nodes in the mesh.");
+
+            mesh.SetNodeWeights(weights);
+            TS_ASSERT_EQUALS(mesh.rGetNodeWeights().size(), weights.size());
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            TS_ASSERT_EQUALS(mesh.GetNumNodes(), mesh_reader.GetNumNodes());
+            TS_ASSERT_EQUALS(mesh.GetNumLocalNodes(), DistributedVectorFactory::CalculateWeightedLocalOwnership(weights));
+            unsigned total_weight = 0;
+            for (unsigned i=0; i<weights.size(); i++)
+            {
+                total_weight += weights[i];
+            }
+            unsigned local_weight = 0;
+            for (unsigned i=mesh.GetDistributedVectorFactory()->GetLow(); i<mesh.GetDistributedVectorFactory()->GetHigh(); i++)
+            {
+                local_weight += weights[i];
+            }
+            TS_ASSERT_DELTA(local_weight, total_weight/(double)PetscTools::GetNumProcs(), 4.0);
+            CheckEverythingIsAssigned<2,2>(mesh);
+        }
+
+        // Graph partitions just need to give a consistent partition
+        TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/cube_136_elements");
+        std::vector<unsigned> weights(mesh_reader.GetNumNodes(), 1u);
+        for (unsigned i=0; i<weights.size(); i+=3)
+        {
+            weights[i] = 20u;
+        }
+        {
+            DistributedTetrahedralMesh<3,3> mesh(DistributedTetrahedralMeshPartitionType::PETSC_MAT_PARTITION);
+            mesh.SetNodeWeights(weights);
+            mesh.ConstructFromMeshReader(mesh_reader);
+            TS_ASSERT_EQUALS(mesh.GetNumNodes(), mesh_reader.GetNumNodes());
+            CheckEverythingIsAssigned<3,3>(mesh);
+        }
+        {
+            DistributedTetrahedralMesh<3,3> mesh(DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY);
+            mesh.SetNodeWeights(weights);
+            mesh.ConstructFromMeshReader(mesh_reader);
+            TS_ASSERT_EQUALS(mesh.GetNumNodes(), mesh_reader.GetNumNodes());
+            CheckEverythingIsAssigned<3,3>(mesh);
+        }
+    }
+
+    void TestReorderForLocality() throw (Exception)
+    {
+        // A regular mesh with its nodes in a random order
+        TetrahedralMesh<3,3> base_mesh;
+        base_mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0, 1.0);
+        RandomNumberGenerator::Instance()->Reseed(0);
+        base_mesh.PermuteNodes();
+        TrianglesMeshWriter<3,3> mesh_writer("TestReorderForLocality", "shuffled_cube");
+        mesh_writer.WriteFilesUsingMesh(base_mesh);
+        PetscTools::Barrier();
+        std::string mesh_base = mesh_writer.GetOutputDirectory() + "shuffled_cube";
+
+        DistributedTetrahedralMeshPartitionType::type partition_types[2] = {DistributedTetrahedralMeshPartitionType::DUMB,
+                                                                            DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY};
+        for (unsigned type_index=0; type_index<2; type_index++)
+        {
+            TrianglesMeshReader<3,3> mesh_reader(mesh_base);
+            DistributedTetrahedralMesh<3,3> plain_mesh(partition_types[type_index]);
+            plain_mesh.ConstructFromMeshReader(mesh_reader);
+
+            DistributedTetrahedralMesh<3,3> mesh(partition_types[type_index]);
+            TS_ASSERT(!mesh.GetReorderForLocality());
+            mesh.SetReorderForLocality();
+            TS_ASSERT(mesh.GetReorderForLocality());
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            // The partition is the same, only the numbering within it changes
+            TS_ASSERT_EQUALS(mesh.GetNumNodes(), base_mesh.GetNumNodes());
+            TS_ASSERT_EQUALS(mesh.GetNumLocalNodes(), plain_mesh.GetNumLocalNodes());
+            TS_ASSERT_EQUALS(mesh.GetNumLocalElements(), plain_mesh.GetNumLocalElements());
+            CheckEverythingIsAssigned<3,3>(mesh);
+
+            // The permutation takes each node in the file to its new index
+            const std::vector<unsigned>& r_permutation = mesh.rGetNodePermutation();
+            TS_ASSERT_EQUALS(r_permutation.size(), mesh.GetNumNodes());
+            std::set<unsigned> new_indices(r_permutation.begin(), r_permutation.end());
+            TS_ASSERT_EQUALS(new_indices.size(), mesh.GetNumNodes());
+            for (unsigned index=0; index<mesh.GetNumNodes(); index++)
+            {
+                if (mesh.GetDistributedVectorFactory()->IsGlobalIndexLocal(r_permutation[index]))
+                {
+                    c_vector<double, 3> difference = mesh.GetNode(r_permutation[index])->rGetLocation()
+                                                     - base_mesh.GetNode(index)->rGetLocation();
+                    TS_ASSERT_DELTA(norm_2(difference), 0.0, 1e-10);
+                }
+            }
+
+            // Local nodes are stored in index order
+            unsigned expected_index = mesh.GetDistributedVectorFactory()->GetLow();
+            for (AbstractTetrahedralMesh<3,3>::NodeIterator iter = mesh.GetNodeIteratorBegin();
+                 iter != mesh.GetNodeIteratorEnd();
+                 ++iter)
+            {
+                TS_ASSERT_EQUALS(iter->GetIndex(), expected_index);
+                expected_index++;
+            }
+
+            // Elements keep their indices, and their nodes are much closer together in the numbering
+            double spread = 0.0;
+            for (AbstractTetrahedralMesh<3,3>::ElementIterator iter = mesh.GetElementIteratorBegin();
+                 iter != mesh.GetElementIteratorEnd();
+                 ++iter)
+            {
+                TS_ASSERT_EQUALS(mesh.GetElement(iter->GetIndex()), &(*iter));
+                std::set<unsigned> node_indices;
+                for (unsigned i=0; i<4; i++)
+                {
+                    node_indices.insert(iter->GetNodeGlobalIndex(i));
+                }
+                spread += *(node_indices.rbegin()) - *(node_indices.begin());
+            }
+            double plain_spread = 0.0;
+            for (AbstractTetrahedralMesh<3,3>::ElementIterator iter = plain_mesh.GetElementIteratorBegin();
+                 iter != plain_mesh.GetElementIteratorEnd();
+                 ++iter)
+            {
+                std::set<unsigned> node_indices;
+                for (unsigned i=0; i<4; i++)
+                {
+                    node_indices.insert(iter->GetNodeGlobalIndex(i));
+                }
+                plain_spread += *(node_indices.rbegin()) - *(node_indices.begin());
+            }
+            TS_ASSERT_LESS_THAN(spread, 0.5*plain_spread);
+        }
+    }
+
     void TestConstruct3DWithRegions() throw (Exception)
     {
         TrianglesMeshReader<3,3> mesh_reader("heart/test/data/box_shaped_heart/box_heart_nonnegative_flags");
@@ -2057,6 +2204,48 @@ public:
 
     }
 
+    void TestParallelWritingInSmallBlocks3D()
+    {
+        TrianglesMeshReader<3,3> reader("mesh/test/data/cube_136_elements");
+        TetrahedralMesh<3,3> sequential_mesh;
+        sequential_mesh.ConstructFromMeshReader(reader);
+        TrianglesMeshWriter<3,3> mesh_writer1("TestDistributedMeshWriterInBlocks", "seq_cube_136_elements");
+        mesh_writer1.WriteFilesUsingMesh(sequential_mesh);
+
+        DistributedTetrahedralMesh<3,3> distributed_mesh(DistributedTetrahedralMeshPartitionType::DUMB); //Makes sure that there is no permutation
+        AbstractTetrahedralMesh<3,3> *p_distributed_mesh = &distributed_mesh; //Hide the fact that it's distributed from the compiler
+        distributed_mesh.ConstructFromMeshReader(reader);
+
+        // Blocks much smaller than the mesh, so each process sends several, some of them empty
+        TrianglesMeshWriter<3,3> mesh_writer2("TestDistributedMeshWriterInBlocks", "par_cube_136_elements", false);
+        mesh_writer2.SetParallelWriteBlockSize(7u);
+        mesh_writer2.WriteFilesUsingMesh(*p_distributed_mesh);
+
+        // And a single block bigger than the mesh
+        TrianglesMeshWriter<3,3> mesh_writer3("TestDistributedMeshWriterInBlocks", "par_one_block_cube_136_elements", false);
+        mesh_writer3.SetParallelWriteBlockSize(1000u);
+        mesh_writer3.WriteFilesUsingMesh(*p_distributed_mesh);
+
+        std::string output_dir = mesh_writer1.GetOutputDirectory();
+
+        std::vector<std::string> files_to_compare;
+        files_to_compare.push_back("node");
+        files_to_compare.push_back("ele");
+        files_to_compare.push_back("face");
+
+        for (unsigned i=0; i<files_to_compare.size(); i++)
+        {
+            FileFinder generated_sequential(output_dir + "/seq_cube_136_elements." + files_to_compare[i]);
+            FileFinder generated_parallel(output_dir + "/par_cube_136_elements." + files_to_compare[i]);
+            FileComparison comparer(generated_parallel, generated_sequential);
+            TS_ASSERT(comparer.CompareFiles());
+
+            FileFinder generated_parallel_one_block(output_dir + "/par_one_block_cube_136_elements." + files_to_compare[i]);
+            FileComparison comparer_one_block(generated_parallel_one_block, generated_sequential);
+            TS_ASSERT(comparer_one_block.CompareFiles());
+        }
+    }
+
     void TestEfficientParallelWriting3D()
     {
         TrianglesMeshReader<3,3> reader("mesh/test/data/cube_2mm_12_elements");
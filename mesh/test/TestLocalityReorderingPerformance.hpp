@@ -0,0 +1,167 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTLOCALITYREORDERINGPERFORMANCE_HPP_
+#define TESTLOCALITYREORDERINGPERFORMANCE_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+
+#include "DistributedTetrahedralMesh.hpp"
+#include "TetrahedralMesh.hpp"
+#include "TrianglesMeshReader.hpp"
+#include "TrianglesMeshWriter.hpp"
+#include "RandomNumberGenerator.hpp"
+#include "PetscMatTools.hpp"
+#include "PetscTools.hpp"
+#include "Timer.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Compares matrix assembly and matrix-vector product times on a mesh whose nodes
+ * are stored in a random order, with and without space-filling curve reordering
+ * of each partition.
+ */
+class TestLocalityReorderingPerformance : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Assemble the linear mass matrix of the mesh by looping over its local elements.
+     *
+     * @param rMesh  the mesh
+     * @param rMatrix  the matrix to create and fill
+     * @return the time taken
+     */
+    double AssembleMassMatrix(DistributedTetrahedralMesh<3,3>& rMesh, Mat& rMatrix)
+    {
+        DistributedVectorFactory* p_factory = rMesh.GetDistributedVectorFactory();
+        Timer::Reset();
+        PetscTools::SetupMat(rMatrix, rMesh.GetNumNodes(), rMesh.GetNumNodes(), 30,
+                             rMesh.GetNumLocalNodes(), rMesh.GetNumLocalNodes());
+        for (AbstractTetrahedralMesh<3,3>::ElementIterator iter = rMesh.GetElementIteratorBegin();
+             iter != rMesh.GetElementIteratorEnd();
+             ++iter)
+        {
+            c_matrix<double, 3, 3> jacobian;
+            double determinant;
+            iter->CalculateJacobian(jacobian, determinant);
+            for (unsigned i=0; i<4; i++)
+            {
+                unsigned row = iter->GetNodeGlobalIndex(i);
+                if (p_factory->IsGlobalIndexLocal(row))
+                {
+                    for (unsigned j=0; j<4; j++)
+                    {
+                        double value = (i==j ? 2.0 : 1.0)*determinant/120.0;
+                        PetscMatTools::AddToElement(rMatrix, row, iter->GetNodeGlobalIndex(j), value);
+                    }
+                }
+            }
+        }
+        PetscMatTools::Finalise(rMatrix);
+        return Timer::GetElapsedTime();
+    }
+
+    /**
+     * Time repeated products of a matrix with a vector.
+     *
+     * @param rMesh  the mesh the matrix was assembled on
+     * @param matrix  the matrix
+     * @param numProducts  how many products to take
+     * @return the time taken
+     */
+    double TimeMatrixVectorProducts(DistributedTetrahedralMesh<3,3>& rMesh, Mat matrix, unsigned numProducts)
+    {
+        Vec x = rMesh.GetDistributedVectorFactory()->CreateVec();
+        Vec y = rMesh.GetDistributedVectorFactory()->CreateVec();
+        VecSet(x, 1.0);
+        Timer::Reset();
+        for (unsigned i=0; i<numProducts; i++)
+        {
+            MatMult(matrix, x, y);
+            VecCopy(y, x);
+        }
+        double time = Timer::GetElapsedTime();
+        PetscTools::Destroy(x);
+        PetscTools::Destroy(y);
+        return time;
+    }
+
+public:
+
+    void TestAssemblyAndMatrixVectorProducts() throw (Exception)
+    {
+        // A regular mesh with its nodes in a random order, as a badly numbered mesh file would give
+        TetrahedralMesh<3,3> base_mesh;
+        base_mesh.ConstructRegularSlabMesh(0.025, 1.0, 1.0, 1.0);
+        RandomNumberGenerator::Instance()->Reseed(0);
+        base_mesh.PermuteNodes();
+        TrianglesMeshWriter<3,3> mesh_writer("TestLocalityReorderingPerformance", "shuffled_cube");
+        mesh_writer.WriteFilesUsingMesh(base_mesh);
+        PetscTools::Barrier();
+        std::string mesh_base = mesh_writer.GetOutputDirectory() + "shuffled_cube";
+
+        double norms[2];
+        for (unsigned reorder=0; reorder<2; reorder++)
+        {
+            TrianglesMeshReader<3,3> mesh_reader(mesh_base);
+            DistributedTetrahedralMesh<3,3> mesh(DistributedTetrahedralMeshPartitionType::PARMETIS_LIBRARY);
+            mesh.SetReorderForLocality(reorder==1);
+            Timer::Reset();
+            mesh.ConstructFromMeshReader(mesh_reader);
+            double construction_time = Timer::GetElapsedTime();
+
+            Mat matrix;
+            double assembly_time = AssembleMassMatrix(mesh, matrix);
+            double product_time = TimeMatrixVectorProducts(mesh, matrix, 500u);
+            MatNorm(matrix, NORM_FROBENIUS, &norms[reorder]);
+            PetscTools::Destroy(matrix);
+
+            if (PetscTools::AmMaster())
+            {
+                std::cout << (reorder==1 ? "Reordered" : "File order") << " mesh on "
+                          << PetscTools::GetNumProcs() << " process(es): construction " << construction_time
+                          << "s, assembly " << assembly_time << "s, 500 products " << product_time << "s\n";
+            }
+        }
+
+        // Renumbering must not change the operator
+        TS_ASSERT_DELTA(norms[1], norms[0], 1e-12*norms[0]);
+    }
+};
+
+#endif /*TESTLOCALITYREORDERINGPERFORMANCE_HPP_*/
@@ -39,6 +39,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 #include <cmath>
+#include <set>
 #include "MutableMesh.hpp"
 #include "TrianglesMeshReader.hpp"
 
@@ -56,6 +57,30 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 class TestMutableMeshRemesh : public CxxTest::TestSuite
 {
+private:
+
+    /**
+     * @param rMesh  a 2D mesh
+     * @return the set of node indices of each element in the mesh, so that
+     *     triangulations can be compared regardless of element numbering.
+     */
+    std::set<std::set<unsigned> > GetElementNodeSets(MutableMesh<2,2>& rMesh)
+    {
+        std::set<std::set<unsigned> > element_node_sets;
+        for (MutableMesh<2,2>::ElementIterator iter = rMesh.GetElementIteratorBegin();
+             iter != rMesh.GetElementIteratorEnd();
+             ++iter)
+        {
+            std::set<unsigned> element_nodes;
+            for (unsigned j=0; j<3; j++)
+            {
+                element_nodes.insert(iter->GetNodeGlobalIndex(j));
+            }
+            element_node_sets.insert(element_nodes);
+        }
+        return element_node_sets;
+    }
+
 public:
 
     /**
@@ -631,6 +656,144 @@ public:
         TS_ASSERT_DELTA(mesh.GetVolume(), area, 1e-6);
     }
 
+    void TestIncrementalRemesh2D() throw (Exception)
+    {
+        // Remesh one copy of the mesh incrementally and the other from scratch
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/disk_984_elements");
+        MutableMesh<2,2> incremental_mesh;
+        incremental_mesh.ConstructFromMeshReader(mesh_reader);
+        mesh_reader.Reset();
+        MutableMesh<2,2> full_mesh;
+        full_mesh.ConstructFromMeshReader(mesh_reader);
+
+        TS_ASSERT_EQUALS(incremental_mesh.GetUseIncrementalReMesh(), false);
+        incremental_mesh.SetUseIncrementalReMesh();
+        TS_ASSERT_EQUALS(incremental_mesh.GetUseIncrementalReMesh(), true);
+
+        // Move the interior nodes a little, so some edges are no longer Delaunay
+        for (unsigned i=0; i<full_mesh.GetNumNodes(); i++)
+        {
+            if (!full_mesh.GetNode(i)->IsBoundaryNode())
+            {
+                c_vector<double, 2> displacement;
+                displacement[0] = 0.02*sin(1.7*i);
+                displacement[1] = 0.02*cos(2.3*i);
+                incremental_mesh.GetNode(i)->rGetModifiableLocation() += displacement;
+                full_mesh.GetNode(i)->rGetModifiableLocation() += displacement;
+            }
+        }
+
+        // Delete an interior node and add a new one
+        unsigned deleted_index = 100;
+        while (full_mesh.GetNode(deleted_index)->IsBoundaryNode())
+        {
+            deleted_index++;
+        }
+        incremental_mesh.DeleteNodePriorToReMesh(deleted_index);
+        full_mesh.DeleteNodePriorToReMesh(deleted_index);
+        incremental_mesh.AddNode(new Node<2>(0, false, 0.0123, 0.0456));
+        full_mesh.AddNode(new Node<2>(0, false, 0.0123, 0.0456));
+
+        // Delete another interior node whose index is not reused
+        unsigned other_deleted_index = deleted_index + 50;
+        while (full_mesh.GetNode(other_deleted_index)->IsBoundaryNode())
+        {
+            other_deleted_index++;
+        }
+        incremental_mesh.DeleteNodePriorToReMesh(other_deleted_index);
+        full_mesh.DeleteNodePriorToReMesh(other_deleted_index);
+
+        Node<2>* p_node = incremental_mesh.GetNode(0);
+
+        NodeMap incremental_map(1);
+        incremental_mesh.ReMesh(incremental_map);
+        NodeMap full_map(1);
+        full_mesh.ReMesh(full_map);
+
+        // The existing nodes should have been kept
+        TS_ASSERT_EQUALS(incremental_mesh.GetNode(0), p_node);
+
+        TS_ASSERT_EQUALS(incremental_map.GetSize(), full_map.GetSize());
+        TS_ASSERT(incremental_map.IsDeleted(other_deleted_index));
+        for (unsigned i=0; i<full_map.GetSize(); i++)
+        {
+            if (!full_map.IsDeleted(i))
+            {
+                TS_ASSERT_EQUALS(incremental_map.GetNewIndex(i), full_map.GetNewIndex(i));
+            }
+        }
+
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumNodes(), full_mesh.GetNumNodes());
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumAllElements(), incremental_mesh.GetNumElements());
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumElements(), full_mesh.GetNumElements());
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumBoundaryElements(), full_mesh.GetNumBoundaryElements());
+        TS_ASSERT_DELTA(incremental_mesh.GetVolume(), full_mesh.GetVolume(), 1e-10);
+        TS_ASSERT(incremental_mesh.CheckIsVoronoi());
+
+        // The Delaunay triangulation is unique, so both meshes should have the same elements
+        TS_ASSERT_EQUALS(GetElementNodeSets(incremental_mesh), GetElementNodeSets(full_mesh));
+
+        // Moving a boundary node inwards makes the boundary non-convex, so the mesh is rebuilt from scratch
+        unsigned boundary_index = 0;
+        while (!incremental_mesh.GetNode(boundary_index)->IsBoundaryNode())
+        {
+            boundary_index++;
+        }
+        incremental_mesh.GetNode(boundary_index)->rGetModifiableLocation() *= 0.97;
+        incremental_mesh.ReMesh();
+        TS_ASSERT_EQUALS(incremental_mesh.GetNode(boundary_index)->IsBoundaryNode(), false);
+        TS_ASSERT(incremental_mesh.CheckIsVoronoi());
+    }
+
+    void TestIncrementalRemesh2DAfterPreviousRemesh() throw (Exception)
+    {
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/disk_984_elements");
+        MutableMesh<2,2> incremental_mesh;
+        incremental_mesh.ConstructFromMeshReader(mesh_reader);
+        mesh_reader.Reset();
+        MutableMesh<2,2> full_mesh;
+        full_mesh.ConstructFromMeshReader(mesh_reader);
+
+        // The first remesh records where the nodes are
+        incremental_mesh.SetUseIncrementalReMesh();
+        incremental_mesh.ReMesh();
+        full_mesh.ReMesh();
+
+        // Move a single interior node, so only the edges around it can stop being Delaunay
+        unsigned moved_index = 200;
+        while (full_mesh.GetNode(moved_index)->IsBoundaryNode())
+        {
+            moved_index++;
+        }
+        c_vector<double, 2> displacement;
+        displacement[0] = 0.015;
+        displacement[1] = -0.01;
+        incremental_mesh.GetNode(moved_index)->rGetModifiableLocation() += displacement;
+        full_mesh.GetNode(moved_index)->rGetModifiableLocation() += displacement;
+
+        // Add new nodes on opposite sides of the disk, so the element containing each is found by a long walk
+        double new_locations[4][2] = {{0.5123, 0.0234}, {-0.4987, -0.0321}, {0.0456, 0.6012}, {-0.0187, -0.5543}};
+        for (unsigned i=0; i<4; i++)
+        {
+            incremental_mesh.AddNode(new Node<2>(0, false, new_locations[i][0], new_locations[i][1]));
+            full_mesh.AddNode(new Node<2>(0, false, new_locations[i][0], new_locations[i][1]));
+        }
+
+        Node<2>* p_node = incremental_mesh.GetNode(0);
+        incremental_mesh.ReMesh();
+        full_mesh.ReMesh();
+
+        // The triangulation should have been updated rather than rebuilt
+        TS_ASSERT_EQUALS(incremental_mesh.GetNode(0), p_node);
+
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumNodes(), full_mesh.GetNumNodes());
+        TS_ASSERT_EQUALS(incremental_mesh.GetNumElements(), full_mesh.GetNumElements());
+        TS_ASSERT_DELTA(incremental_mesh.GetVolume(), full_mesh.GetVolume(), 1e-10);
+        TS_ASSERT(incremental_mesh.CheckIsVoronoi());
+
+        TS_ASSERT_EQUALS(GetElementNodeSets(incremental_mesh), GetElementNodeSets(full_mesh));
+    }
+
     void TestRemeshWithLibraryMethod3D() throw (Exception)
     {
         TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/cube_136_elements");
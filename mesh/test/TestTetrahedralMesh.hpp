@@ -1541,6 +1541,80 @@ public:
         TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point_on_edge6), 142u);
     }
 
+    void TestPointInMeshWithElementSpatialIndex() throw(Exception)
+    {
+        // The answers should be exactly those found without the index (see TestPointinMesh2D and TestPointinMesh3D)
+        {
+            TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/2D_0_to_1mm_200_elements");
+            TetrahedralMesh<2,2> mesh;
+            mesh.ConstructFromMeshReader(mesh_reader);
+            TS_ASSERT_EQUALS(mesh.GetUseElementSpatialIndex(), false);
+            mesh.SetUseElementSpatialIndex();
+            TS_ASSERT_EQUALS(mesh.GetUseElementSpatialIndex(), true);
+
+            ChastePoint<2> point1(0.051, 0.051);
+            ChastePoint<2> point2(0.2, 0.2);
+            ChastePoint<2> point3(0.05, 0.05); // node 60 of mesh
+
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point1), 110u);
+            TS_ASSERT_EQUALS(mesh.GetNearestElementIndex(point1), 110u);
+            TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndex(point2),"is not in mesh");
+            TS_ASSERT_EQUALS(mesh.GetNearestElementIndex(point2), 199u);
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point3), 89u);
+
+            std::vector<unsigned> indices = mesh.GetContainingElementIndices(point3);
+            TS_ASSERT_EQUALS(indices.size(), 6u);
+            TS_ASSERT_EQUALS(indices[0], 89u);
+            TS_ASSERT_EQUALS(indices[1], 90u);
+            TS_ASSERT_EQUALS(indices[5], 110u);
+
+            // Moving the mesh should cause the index to be rebuilt
+            mesh.Translate(0.149, 0.149);
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point2), 110u);
+            TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndex(point1),"is not in mesh");
+        }
+
+        {
+            TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/3D_0_to_1mm_6000_elements");
+            TetrahedralMesh<3,3> mesh;
+            mesh.ConstructFromMeshReader(mesh_reader);
+            mesh.SetUseElementSpatialIndex();
+
+            ChastePoint<3> point1(0.051, 0.051,0.051);
+            ChastePoint<3> point2(0.2, 0.2, 0.2);
+            ChastePoint<3> point3(0.050000000000000003, 0.050000000000000003, 0.050000000000000003);
+
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point1), 2992u);
+            TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndex(point2),"is not in mesh");
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point3), 2044u);
+
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point1, 5999), 2992u);
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 2000), 2044u);
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 2045), 2047u);
+            TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 3025), 3026u);
+            TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndexWithInitialGuess(point2, 0), "not in mesh - all elements tested");
+            TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndexWithInitialGuess(point3, 0, true), "not in mesh - all elements tested");
+
+            std::vector<unsigned> indices = mesh.GetContainingElementIndices(point3);
+            TS_ASSERT_EQUALS(indices.size(), 24u);
+            TS_ASSERT_EQUALS(indices[0], 2044u);
+            TS_ASSERT_EQUALS(indices[5], 2286u);
+            TS_ASSERT_EQUALS(indices[23], 3026u);
+
+            // Every node should be found in the same element with and without the index
+            for (unsigned node_index=0; node_index<mesh.GetNumNodes(); node_index+=7)
+            {
+                ChastePoint<3> node_location(mesh.GetNode(node_index)->rGetLocation());
+                unsigned element_with_index = mesh.GetContainingElementIndex(node_location);
+                unsigned nearest_with_index = mesh.GetNearestElementIndex(node_location);
+                mesh.SetUseElementSpatialIndex(false);
+                TS_ASSERT_EQUALS(element_with_index, mesh.GetContainingElementIndex(node_location));
+                TS_ASSERT_EQUALS(nearest_with_index, mesh.GetNearestElementIndex(node_location));
+                mesh.SetUseElementSpatialIndex(true);
+            }
+        }
+    }
+
     void TestGetAngleBetweenNodes() throw(Exception)
     {
         TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_2_elements");
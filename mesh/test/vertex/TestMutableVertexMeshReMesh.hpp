@@ -40,6 +40,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "VertexMeshWriter.hpp"
 #include "MutableVertexMesh.hpp"
+#include "HoneycombVertexMeshGenerator.hpp"
+#include "CylindricalHoneycombVertexMeshGenerator.hpp"
 #include "FileComparison.hpp"
 #include "Warnings.hpp"
 
@@ -2692,6 +2694,69 @@ public:
         TS_ASSERT_DELTA(vertex_mesh.GetSurfaceAreaOfElement(3), 2.3062, 1e-4);
     }
 
+    void TestElementBinsFindAllElementsContainingAPoint() throw(Exception)
+    {
+        // Test a planar mesh and a periodic mesh, in which some elements wrap around the boundary
+        HoneycombVertexMeshGenerator generator(6, 5);
+        CylindricalHoneycombVertexMeshGenerator cylindrical_generator(6, 5);
+
+        std::vector<MutableVertexMesh<2,2>*> meshes;
+        meshes.push_back(generator.GetMesh());
+        meshes.push_back(cylindrical_generator.GetMesh());
+
+        for (unsigned mesh_index=0; mesh_index<meshes.size(); mesh_index++)
+        {
+            MutableVertexMesh<2,2>* p_mesh = meshes[mesh_index];
+
+            std::vector<unsigned> element_indices;
+            for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+            {
+                element_indices.push_back(elem_index);
+            }
+            p_mesh->SetUpElementBins(element_indices);
+
+            // Check points on a fine grid, including some outside the mesh
+            std::vector<unsigned> candidates;
+            for (unsigned i=0; i<40; i++)
+            {
+                for (unsigned j=0; j<40; j++)
+                {
+                    c_vector<double, 2> point;
+                    point[0] = -0.5 + 0.17*i + 0.001;
+                    point[1] = -0.5 + 0.13*j + 0.001;
+
+                    p_mesh->GetCandidateElementsForPoint(point, candidates);
+                    for (unsigned k=1; k<candidates.size(); k++)
+                    {
+                        TS_ASSERT_LESS_THAN(candidates[k-1], candidates[k]);
+                    }
+
+                    for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+                    {
+                        if (p_mesh->ElementIncludesPoint(point, elem_index))
+                        {
+                            TS_ASSERT(std::find(candidates.begin(), candidates.end(), elem_index) != candidates.end());
+                        }
+                    }
+                }
+            }
+        }
+
+        // Without periodicity, each point should only be tested against a few elements
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        std::vector<unsigned> element_indices;
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            element_indices.push_back(elem_index);
+        }
+        p_mesh->SetUpElementBins(element_indices);
+
+        std::vector<unsigned> candidates;
+        p_mesh->GetCandidateElementsForPoint(p_mesh->GetCentroidOfElement(14), candidates);
+        TS_ASSERT_LESS_THAN_EQUALS(candidates.size(), 3u);
+        TS_ASSERT(std::find(candidates.begin(), candidates.end(), 14u) != candidates.end());
+    }
+
     void TestPerformIntersectionSwapOtherWayRound() throw(Exception)
     {
         /*
@@ -38,6 +38,53 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Exception.hpp"
 #include <cmath>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+AbstractOneStepIvpOdeSolver::AbstractOneStepIvpOdeSolver()
+    : AbstractIvpOdeSolver(),
+      mWorkingMemory(GetMaxNumThreads())
+{
+}
+
+unsigned AbstractOneStepIvpOdeSolver::GetMaxNumThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1u;
+#endif // _OPENMP
+}
+
+std::vector<double>& AbstractOneStepIvpOdeSolver::rGetThreadWorkingMemory(std::vector<std::vector<double> >& rPerThreadMemory,
+                                                                          unsigned size)
+{
+    unsigned thread = 0u;
+    bool in_parallel = false;
+#ifdef _OPENMP
+    thread = omp_get_thread_num();
+    in_parallel = omp_in_parallel();
+#endif // _OPENMP
+
+    if (!in_parallel && rPerThreadMemory.size() < GetMaxNumThreads())
+    {
+        // More threads are now allowed than when this solver was created
+        rPerThreadMemory.resize(GetMaxNumThreads());
+    }
+    if (thread >= rPerThreadMemory.size())
+    {
+        EXCEPTION("This ODE solver is being shared by more OpenMP threads than when it was created or last used outside a parallel region.");
+    }
+
+    std::vector<double>& r_memory = rPerThreadMemory[thread];
+    if (r_memory.size() != size)
+    {
+        r_memory.resize(size);
+    }
+    return r_memory;
+}
+
 OdeSolution AbstractOneStepIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
                                                std::vector<double>& rYValues,
                                                double startTime,
@@ -65,12 +112,12 @@ OdeSolution AbstractOneStepIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
     solutions.SetOdeSystemInformation(pOdeSystem->GetSystemInformation());
     solutions.SetSolverName( GetIdentifier() );
 
-    mWorkingMemory.resize(rYValues.size());
+    std::vector<double>& r_working_memory = rGetThreadWorkingMemory(mWorkingMemory, rYValues.size());
 
     // Solve the ODE system
     while ( !stepper.IsTimeAtEnd() && !mStoppingEventOccurred )
     {
-        InternalSolve(pOdeSystem, rYValues, mWorkingMemory, stepper.GetTime(), stepper.GetNextTime(), timeStep);
+        mStoppingEventOccurred = InternalSolve(pOdeSystem, rYValues, r_working_memory, stepper.GetTime(), stepper.GetNextTime(), timeStep, mStoppingTime);
         stepper.AdvanceOneTimeStep();
         // write current solution into solutions
         solutions.rGetSolutions().push_back(rYValues);
@@ -100,24 +147,37 @@ void AbstractOneStepIvpOdeSolver::Solve(AbstractOdeSystem* pOdeSystem,
     assert(endTime > startTime);
     assert(timeStep > 0.0);
 
-    mStoppingEventOccurred = false;
     if ( pOdeSystem->CalculateStoppingEvent(startTime, rYValues) == true )
     {
         EXCEPTION("(Solve without sampling) Stopping event is true for initial condition");
     }
 
-    // Perhaps resize working memory
-    mWorkingMemory.resize(rYValues.size());
+    // Perhaps resize this thread's working memory
+    std::vector<double>& r_working_memory = rGetThreadWorkingMemory(mWorkingMemory, rYValues.size());
+
+#ifdef _OPENMP
+    if (omp_in_parallel())
+    {
+        // One solver is commonly shared by many cells, which may now be being solved on
+        // different threads, so the stopping event members can't be shared too.
+        // (Cells don't have stopping events, so nothing is lost.)
+        double stopping_time;
+        InternalSolve(pOdeSystem, rYValues, r_working_memory, startTime, endTime, timeStep, stopping_time);
+        return;
+    }
+#endif // _OPENMP
+
     // And solve...
-    InternalSolve(pOdeSystem, rYValues, mWorkingMemory, startTime, endTime, timeStep);
+    mStoppingEventOccurred = InternalSolve(pOdeSystem, rYValues, r_working_memory, startTime, endTime, timeStep, mStoppingTime);
 }
 
-void AbstractOneStepIvpOdeSolver::InternalSolve(AbstractOdeSystem* pOdeSystem,
+bool AbstractOneStepIvpOdeSolver::InternalSolve(AbstractOdeSystem* pOdeSystem,
                                                 std::vector<double>& rYValues,
                                                 std::vector<double>& rWorkingMemory,
                                                 double startTime,
                                                 double endTime,
-                                                double timeStep)
+                                                double timeStep,
+                                                double& rStoppingTime)
 {
     TimeStepper stepper(startTime, endTime, timeStep);
     // Solve the ODE system
@@ -126,9 +186,8 @@ void AbstractOneStepIvpOdeSolver::InternalSolve(AbstractOdeSystem* pOdeSystem,
     // If this is true, it's in rYValues, otherwise it's in rWorkingMemory.
     bool curr_is_curr = false;
 
-    // should never get here if this bool has been set to true;
-    assert(!mStoppingEventOccurred);
-    while ( !stepper.IsTimeAtEnd() && !mStoppingEventOccurred )
+    bool stopping_event_occurred = false;
+    while ( !stepper.IsTimeAtEnd() && !stopping_event_occurred )
     {
         curr_is_curr = !curr_is_curr;
         // Function that calls the appropriate one-step solver
@@ -141,8 +200,8 @@ void AbstractOneStepIvpOdeSolver::InternalSolve(AbstractOdeSystem* pOdeSystem,
         if ( pOdeSystem->CalculateStoppingEvent(stepper.GetTime(),
                                                 curr_is_curr ? rWorkingMemory : rYValues) == true )
         {
-            mStoppingTime = stepper.GetTime();
-            mStoppingEventOccurred = true;
+            rStoppingTime = stepper.GetTime();
+            stopping_event_occurred = true;
         }
     }
     // Final answer must be in rYValues
@@ -150,4 +209,5 @@ void AbstractOneStepIvpOdeSolver::InternalSolve(AbstractOdeSystem* pOdeSystem,
     {
         rYValues.assign(rWorkingMemory.begin(), rWorkingMemory.end());
     }
+    return stopping_event_occurred;
 }
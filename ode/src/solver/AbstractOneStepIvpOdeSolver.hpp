@@ -67,15 +67,41 @@ private:
     }
 
     /**
-     * Working memory
+     * Working memory, with one entry for each OpenMP thread.
      */
-    std::vector<double> mWorkingMemory;
+    std::vector<std::vector<double> > mWorkingMemory;
 
 protected:
 
+    /**
+     * @return the maximum number of OpenMP threads that may share this solver (1 if
+     * Chaste isn't built with OpenMP).  Only meaningful outside parallel regions.
+     */
+    static unsigned GetMaxNumThreads();
+
+    /**
+     * Get the calling thread's entry of some per-thread working memory.
+     *
+     * One solver is commonly shared by many ODE systems, which may be solved on different
+     * OpenMP threads, so each thread has its own working memory.  The outer vector must be
+     * sized to GetMaxNumThreads() on construction; it is only ever grown outside parallel
+     * regions, so threads never reallocate it under each other.  The calling thread's entry
+     * is resized only when the number of state variables changes, so after the first step
+     * no memory is allocated.
+     *
+     * @param rPerThreadMemory  working memory with one entry per thread
+     * @param size  the size the calling thread's entry needs
+     * @return the calling thread's entry
+     */
+    static std::vector<double>& rGetThreadWorkingMemory(std::vector<std::vector<double> >& rPerThreadMemory,
+                                                        unsigned size);
+
     /**
      * Method that actually performs the solving on behalf of the public Solve methods.
      *
+     * This doesn't touch the stopping event members, so that one solver may be shared
+     * by ODE systems being solved on different threads.
+     *
      * @param pAbstractOdeSystem  the ODE system to solve
      * @param rCurrentYValues  the current (initial) state; results will also be returned
      *                         in here
@@ -83,13 +109,17 @@ protected:
      * @param startTime  initial time
      * @param endTime  time to solve to
      * @param timeStep  dt
+     * @param rStoppingTime  filled in with the time of the stopping event, if one occurred
+     *
+     * @return whether a stopping event occurred
      */
-    virtual void InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
+    virtual bool InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
                                std::vector<double>& rCurrentYValues,
                                std::vector<double>& rWorkingMemory,
                                double startTime,
                                double endTime,
-                               double timeStep);
+                               double timeStep,
+                               double& rStoppingTime);
 
     /**
      * Calculate the solution to the ODE system at the next timestep.
@@ -109,6 +139,11 @@ protected:
 
 public:
 
+    /**
+     * Constructor.
+     */
+    AbstractOneStepIvpOdeSolver();
+
     /**
      * Solves a system of ODEs using a specified one-step ODE solver and returns
      * the solution as an OdeSolution object.
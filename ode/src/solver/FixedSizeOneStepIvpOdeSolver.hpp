@@ -0,0 +1,274 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef FIXEDSIZEONESTEPIVPODESOLVER_HPP_
+#define FIXEDSIZEONESTEPIVPODESOLVER_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include "TimeStepper.hpp"
+
+/*
+ * Fixed-size counterparts of the explicit one-step solvers derived from
+ * AbstractOneStepIvpOdeSolver.
+ *
+ * When the size of an ODE system is known at compile time (as it is for
+ * AbstractBackwardEulerCardiacCell<SIZE>), the state and the stages of each
+ * step can live on the stack, and the derivatives can be evaluated by a
+ * non-virtual call which the compiler may inline. The ODE system class given
+ * as the ODE_SYSTEM template parameter must provide a (preferably non-virtual,
+ * inline) method
+ *
+ *     void EvaluateFixedSizeYDerivatives(double time, const double rY[SIZE], double rDY[SIZE]);
+ *
+ * Each step class below performs the same arithmetic as the corresponding
+ * solver class, so the results agree with it to rounding. DeltaNotchCellCycleModel
+ * uses this path for its RK4 solves.
+ */
+
+/**
+ * A forward Euler step (see EulerIvpOdeSolver).
+ */
+struct FixedSizeEulerStep
+{
+    /**
+     * Advance the state by one time step.
+     *
+     * @param rOdeSystem  the ODE system
+     * @param time  the current time
+     * @param timeStep  dt
+     * @param rY  the current state, replaced by the state at the next time step
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static inline void Apply(ODE_SYSTEM& rOdeSystem, double time, double timeStep, double rY[SIZE])
+    {
+        double dy[SIZE];
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time, rY, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            rY[i] = rY[i] + timeStep*dy[i];
+        }
+    }
+};
+
+/**
+ * A Heun step (see HeunIvpOdeSolver).
+ */
+struct FixedSizeHeunStep
+{
+    /**
+     * Advance the state by one time step.
+     *
+     * @param rOdeSystem  the ODE system
+     * @param time  the current time
+     * @param timeStep  dt
+     * @param rY  the current state, replaced by the state at the next time step
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static inline void Apply(ODE_SYSTEM& rOdeSystem, double time, double timeStep, double rY[SIZE])
+    {
+        double k1[SIZE];
+        double k2[SIZE];
+        double y_predicted[SIZE];
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time, rY, k1);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            y_predicted[i] = timeStep*k1[i] + rY[i];
+        }
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time+timeStep, y_predicted, k2);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            rY[i] = rY[i] + timeStep*0.5*(k1[i] + k2[i]);
+        }
+    }
+};
+
+/**
+ * A second order Runge-Kutta (midpoint) step (see RungeKutta2IvpOdeSolver).
+ */
+struct FixedSizeRungeKutta2Step
+{
+    /**
+     * Advance the state by one time step.
+     *
+     * @param rOdeSystem  the ODE system
+     * @param time  the current time
+     * @param timeStep  dt
+     * @param rY  the current state, replaced by the state at the next time step
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static inline void Apply(ODE_SYSTEM& rOdeSystem, double time, double timeStep, double rY[SIZE])
+    {
+        double dy[SIZE];
+        double y_midpoint[SIZE];
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time, rY, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            y_midpoint[i] = (timeStep*dy[i])/2.0 + rY[i];
+        }
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time+timeStep/2.0, y_midpoint, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            rY[i] = rY[i] + timeStep*dy[i];
+        }
+    }
+};
+
+/**
+ * A classical fourth order Runge-Kutta step (see RungeKutta4IvpOdeSolver).
+ */
+struct FixedSizeRungeKutta4Step
+{
+    /**
+     * Advance the state by one time step.
+     *
+     * @param rOdeSystem  the ODE system
+     * @param time  the current time
+     * @param timeStep  dt
+     * @param rY  the current state, replaced by the state at the next time step
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static inline void Apply(ODE_SYSTEM& rOdeSystem, double time, double timeStep, double rY[SIZE])
+    {
+        double k1[SIZE];
+        double k2[SIZE];
+        double k3[SIZE];
+        double dy[SIZE];
+        double yki[SIZE];
+
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time, rY, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            k1[i] = timeStep*dy[i];
+            yki[i] = rY[i] + 0.5*k1[i];
+        }
+
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time+0.5*timeStep, yki, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            k2[i] = timeStep*dy[i];
+            yki[i] = rY[i] + 0.5*k2[i];
+        }
+
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time+0.5*timeStep, yki, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            k3[i] = timeStep*dy[i];
+            yki[i] = rY[i] + k3[i];
+        }
+
+        rOdeSystem.EvaluateFixedSizeYDerivatives(time+timeStep, yki, dy);
+        for (unsigned i=0; i<SIZE; i++)
+        {
+            rY[i] = rY[i] + (k1[i]+2*k2[i]+2*k3[i]+timeStep*dy[i])/6.0;
+        }
+    }
+};
+
+/**
+ * Solves an ODE system of compile-time size SIZE with the one-step method STEP
+ * (one of the step classes above), without heap allocation or virtual calls.
+ *
+ * Unlike AbstractOneStepIvpOdeSolver, stopping events are not checked, and no
+ * OdeSolution is produced.
+ */
+template<class STEP>
+class FixedSizeOneStepIvpOdeSolver
+{
+public:
+
+    /**
+     * Solve the system from startTime to endTime, with the same time steps as
+     * AbstractOneStepIvpOdeSolver (the last step is shortened if need be).
+     *
+     * @param rOdeSystem  the ODE system
+     * @param rYValues  the initial state, replaced by the state at endTime
+     * @param startTime  the time of the initial state
+     * @param endTime  the time to solve to
+     * @param timeStep  dt
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static void Solve(ODE_SYSTEM& rOdeSystem, double rYValues[SIZE], double startTime, double endTime, double timeStep)
+    {
+        assert(endTime > startTime);
+        assert(timeStep > 0.0);
+
+        TimeStepper stepper(startTime, endTime, timeStep);
+        while (!stepper.IsTimeAtEnd())
+        {
+            STEP::template Apply<SIZE>(rOdeSystem, stepper.GetTime(), stepper.GetNextTimeStep(), rYValues);
+            stepper.AdvanceOneTimeStep();
+        }
+    }
+
+    /**
+     * Solve the system from startTime to endTime, with the state held in a std::vector.
+     * The state is copied to the stack for the duration of the solve.
+     *
+     * @param rOdeSystem  the ODE system
+     * @param rYValues  the initial state, replaced by the state at endTime
+     * @param startTime  the time of the initial state
+     * @param endTime  the time to solve to
+     * @param timeStep  dt
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static void Solve(ODE_SYSTEM& rOdeSystem, std::vector<double>& rYValues, double startTime, double endTime, double timeStep)
+    {
+        assert(rYValues.size() == SIZE);
+        double y[SIZE];
+        std::copy(rYValues.begin(), rYValues.end(), y);
+        Solve<SIZE>(rOdeSystem, y, startTime, endTime, timeStep);
+        std::copy(y, y+SIZE, rYValues.begin());
+    }
+
+    /**
+     * Solve the system from startTime to endTime, starting from and updating
+     * its own state variables (see AbstractOdeSystem::rGetStateVariables()).
+     *
+     * @param rOdeSystem  the ODE system
+     * @param startTime  the time of the current state
+     * @param endTime  the time to solve to
+     * @param timeStep  dt
+     */
+    template<unsigned SIZE, class ODE_SYSTEM>
+    static void SolveAndUpdateStateVariable(ODE_SYSTEM& rOdeSystem, double startTime, double endTime, double timeStep)
+    {
+        Solve<SIZE>(rOdeSystem, rOdeSystem.rGetStateVariables(), startTime, endTime, timeStep);
+    }
+};
+
+#endif /*FIXEDSIZEONESTEPIVPODESOLVER_HPP_*/
@@ -38,11 +38,32 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //January 2009
 #include "HeunIvpOdeSolver.hpp"
 
+HeunIvpOdeSolver::HeunIvpOdeSolver()
+    : k1(GetMaxNumThreads()),
+      k2(GetMaxNumThreads())
+{
+}
+
 void HeunIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem,
                                                   double timeStep,
                                                   double time,
                                                   std::vector<double>& rCurrentYValues,
                                                   std::vector<double>& rNextYValues)
+{
+    const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
+
+    CalculateNextYValueWithWorkingMemory(pAbstractOdeSystem, timeStep, time, rCurrentYValues, rNextYValues,
+                                         rGetThreadWorkingMemory(k1, num_equations),
+                                         rGetThreadWorkingMemory(k2, num_equations));
+}
+
+void HeunIvpOdeSolver::CalculateNextYValueWithWorkingMemory(AbstractOdeSystem* pAbstractOdeSystem,
+                                                            double timeStep,
+                                                            double time,
+                                                            std::vector<double>& rCurrentYValues,
+                                                            std::vector<double>& rNextYValues,
+                                                            std::vector<double>& rK1,
+                                                            std::vector<double>& rK2)
 {
     /*
      * Apply Heun 2nd order method for each time step in AbstractOneStepIvpSolver.
@@ -52,29 +73,26 @@ void HeunIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem
 
     const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
 
-    std::vector<double> k1(num_equations);
-    std::vector<double> k2(num_equations);
     std::vector<double>& dy = rNextYValues; // re-use memory
 
     // Work out k1
-    pAbstractOdeSystem->EvaluateYDerivatives(time, rCurrentYValues, k1);
+    pAbstractOdeSystem->EvaluateYDerivatives(time, rCurrentYValues, rK1);
 
     // Add current y values to k1 values
     for (unsigned i=0; i<num_equations; i++)
     {
-        dy[i] = timeStep*k1[i] + rCurrentYValues[i];
+        dy[i] = timeStep*rK1[i] + rCurrentYValues[i];
     }
     //Work out k2
-    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep, dy, k2);
+    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep, dy, rK2);
 
     // New solution
     for (unsigned i=0; i<num_equations; i++)
     {
-        rNextYValues[i] = rCurrentYValues[i] + timeStep*0.5*(k1[i] + k2[i]);
+        rNextYValues[i] = rCurrentYValues[i] + timeStep*0.5*(rK1[i] + rK2[i]);
     }
 }
 
-
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(HeunIvpOdeSolver)
@@ -46,20 +46,22 @@ unsigned MockEulerIvpOdeSolver::GetCallCount()
     return mCallCount;
 }
 
-void MockEulerIvpOdeSolver::InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
+bool MockEulerIvpOdeSolver::InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
                                           std::vector<double>& rCurrentYValues,
                                           std::vector<double>& rWorkingMemory,
                                           double startTime,
                                           double endTime,
-                                          double timeStep)
+                                          double timeStep,
+                                          double& rStoppingTime)
 {
     mCallCount++;
-    EulerIvpOdeSolver::InternalSolve(pAbstractOdeSystem,
-                                     rCurrentYValues,
-                                     rWorkingMemory,
-                                     startTime,
-                                     endTime,
-                                     timeStep);
+    return EulerIvpOdeSolver::InternalSolve(pAbstractOdeSystem,
+                                            rCurrentYValues,
+                                            rWorkingMemory,
+                                            startTime,
+                                            endTime,
+                                            timeStep,
+                                            rStoppingTime);
 }
 
 
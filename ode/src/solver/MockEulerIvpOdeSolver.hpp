@@ -81,13 +81,17 @@ protected:
      * @param startTime  initial time
      * @param endTime  time to solve to
      * @param timeStep  dt
+     * @param rStoppingTime  filled in with the time of the stopping event, if one occurred
+     *
+     * @return whether a stopping event occurred
      */
-    virtual void InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
+    virtual bool InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
                                std::vector<double>& rCurrentYValues,
                                std::vector<double>& rWorkingMemory,
                                double startTime,
                                double endTime,
-                               double timeStep);
+                               double timeStep,
+                               double& rStoppingTime);
 
 public:
 
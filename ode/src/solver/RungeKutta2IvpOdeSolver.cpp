@@ -36,11 +36,29 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "RungeKutta2IvpOdeSolver.hpp"
 
+RungeKutta2IvpOdeSolver::RungeKutta2IvpOdeSolver()
+    : k1(GetMaxNumThreads())
+{
+}
+
 void RungeKutta2IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem,
                                                   double timeStep,
                                                   double time,
                                                   std::vector<double>& rCurrentYValues,
                                                   std::vector<double>& rNextYValues)
+{
+    const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
+
+    CalculateNextYValueWithWorkingMemory(pAbstractOdeSystem, timeStep, time, rCurrentYValues, rNextYValues,
+                                         rGetThreadWorkingMemory(k1, num_equations));
+}
+
+void RungeKutta2IvpOdeSolver::CalculateNextYValueWithWorkingMemory(AbstractOdeSystem* pAbstractOdeSystem,
+                                                                   double timeStep,
+                                                                   double time,
+                                                                   std::vector<double>& rCurrentYValues,
+                                                                   std::vector<double>& rNextYValues,
+                                                                   std::vector<double>& rK1)
 {
     /*
      * Apply Runge-Kutta 2nd order method for each timestep in AbstractOneStepIvpSolver.
@@ -50,7 +68,6 @@ void RungeKutta2IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOd
 
     const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
 
-    std::vector<double> k1(num_equations);
     std::vector<double>& dy = rNextYValues; // re-use memory
 
     // Work out k1
@@ -58,19 +75,18 @@ void RungeKutta2IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOd
 
     for (unsigned i=0; i<num_equations; i++)
     {
-        k1[i] = timeStep*dy[i];
-        k1[i] = k1[i]/2.0 + rCurrentYValues[i];
+        rK1[i] = timeStep*dy[i];
+        rK1[i] = rK1[i]/2.0 + rCurrentYValues[i];
     }
 
     // Work out k2 and new solution
-    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep/2.0, k1, dy);
+    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep/2.0, rK1, dy);
     for (unsigned i=0; i<num_equations; i++)
     {
         rNextYValues[i] = rCurrentYValues[i] + timeStep*dy[i];
     }
 }
 
-
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(RungeKutta2IvpOdeSolver)
@@ -69,6 +69,9 @@ protected:
     /**
      * Calculate the solution to the ODE system at the next timestep.
      *
+     * The working memory is kept per OpenMP thread, since this solver may be
+     * shared by many cells.
+     *
      * @param pAbstractOdeSystem  the ODE system to solve
      * @param timeStep  dt
      * @param time  the current time
@@ -81,13 +84,34 @@ protected:
                              std::vector<double>& rCurrentYValues,
                              std::vector<double>& rNextYValues);
 
+private:
+
+    /**
+     * Calculate the solution to the ODE system at the next timestep, using the
+     * given working memory.
+     *
+     * @param pAbstractOdeSystem  the ODE system to solve
+     * @param timeStep  dt
+     * @param time  the current time
+     * @param rCurrentYValues  the current (initial) state
+     * @param rNextYValues  the state at the next timestep
+     * @param rK1  working memory for k1
+     */
+    void CalculateNextYValueWithWorkingMemory(AbstractOdeSystem* pAbstractOdeSystem,
+                                              double timeStep,
+                                              double time,
+                                              std::vector<double>& rCurrentYValues,
+                                              std::vector<double>& rNextYValues,
+                                              std::vector<double>& rK1);
+
+    std::vector<std::vector<double> > k1;  /**< Working memory, per thread: expression k1 in the RK2 method. */
+
 public:
 
     /**
      * Constructor.
      */
-    RungeKutta2IvpOdeSolver()
-    {}
+    RungeKutta2IvpOdeSolver();
 
 };
 
@@ -35,11 +35,41 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "RungeKutta4IvpOdeSolver.hpp"
 
+RungeKutta4IvpOdeSolver::RungeKutta4IvpOdeSolver()
+    : k1(GetMaxNumThreads()),
+      k2(GetMaxNumThreads()),
+      k3(GetMaxNumThreads()),
+      k4(GetMaxNumThreads()),
+      yki(GetMaxNumThreads())
+{
+}
+
 void RungeKutta4IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem,
                                                   double timeStep,
                                                   double time,
                                                   std::vector<double>& rCurrentYValues,
                                                   std::vector<double>& rNextYValues)
+{
+    const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
+
+    CalculateNextYValueWithWorkingMemory(pAbstractOdeSystem, timeStep, time, rCurrentYValues, rNextYValues,
+                                         rGetThreadWorkingMemory(k1, num_equations),
+                                         rGetThreadWorkingMemory(k2, num_equations),
+                                         rGetThreadWorkingMemory(k3, num_equations),
+                                         rGetThreadWorkingMemory(k4, num_equations),
+                                         rGetThreadWorkingMemory(yki, num_equations));
+}
+
+void RungeKutta4IvpOdeSolver::CalculateNextYValueWithWorkingMemory(AbstractOdeSystem* pAbstractOdeSystem,
+                                                                   double timeStep,
+                                                                   double time,
+                                                                   std::vector<double>& rCurrentYValues,
+                                                                   std::vector<double>& rNextYValues,
+                                                                   std::vector<double>& rK1,
+                                                                   std::vector<double>& rK2,
+                                                                   std::vector<double>& rK3,
+                                                                   std::vector<double>& rK4,
+                                                                   std::vector<double>& rYki)
 {
     /*
      * Apply Runge-Kutta 4th order method for each timestep in AbstractOneStepIvpSolver.
@@ -49,43 +79,34 @@ void RungeKutta4IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOd
 
     const unsigned num_equations = pAbstractOdeSystem->GetNumberOfStateVariables();
 
-    if (num_equations != k1.size())
-    {
-        k1.resize(num_equations);
-        k2.resize(num_equations);
-        k3.resize(num_equations);
-        k4.resize(num_equations);
-        yki.resize(num_equations);
-    }
-
     std::vector<double>& dy = rNextYValues; // re-use memory
 
     pAbstractOdeSystem->EvaluateYDerivatives(time, rCurrentYValues, dy);
     for (unsigned i=0; i<num_equations; i++)
     {
-        k1[i] = timeStep*dy[i];
-        yki[i] = rCurrentYValues[i] + 0.5*k1[i];
+        rK1[i] = timeStep*dy[i];
+        rYki[i] = rCurrentYValues[i] + 0.5*rK1[i];
     }
 
-    pAbstractOdeSystem->EvaluateYDerivatives(time+0.5*timeStep, yki, dy);
+    pAbstractOdeSystem->EvaluateYDerivatives(time+0.5*timeStep, rYki, dy);
     for (unsigned i=0; i<num_equations; i++)
     {
-        k2[i] = timeStep*dy[i];
-        yki[i] = rCurrentYValues[i] + 0.5*k2[i];
+        rK2[i] = timeStep*dy[i];
+        rYki[i] = rCurrentYValues[i] + 0.5*rK2[i];
     }
 
-    pAbstractOdeSystem->EvaluateYDerivatives(time+0.5*timeStep, yki, dy);
+    pAbstractOdeSystem->EvaluateYDerivatives(time+0.5*timeStep, rYki, dy);
     for (unsigned i=0; i<num_equations; i++)
     {
-        k3[i] = timeStep*dy[i];
-        yki[i] = rCurrentYValues[i] + k3[i];
+        rK3[i] = timeStep*dy[i];
+        rYki[i] = rCurrentYValues[i] + rK3[i];
     }
 
-    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep, yki, dy);
+    pAbstractOdeSystem->EvaluateYDerivatives(time+timeStep, rYki, dy);
     for (unsigned i=0; i<num_equations; i++)
     {
-        k4[i] = timeStep*dy[i];
-        rNextYValues[i] = rCurrentYValues[i] + (k1[i]+2*k2[i]+2*k3[i]+k4[i])/6.0;
+        rK4[i] = timeStep*dy[i];
+        rNextYValues[i] = rCurrentYValues[i] + (rK1[i]+2*rK2[i]+2*rK3[i]+rK4[i])/6.0;
     }
 }
 
@@ -69,6 +69,9 @@ protected:
     /**
      * Calculate the solution to the ODE system at the next timestep.
      *
+     * The working memory is kept per OpenMP thread, since this solver is commonly
+     * shared by many cells.
+     *
      * @param pAbstractOdeSystem  the ODE system to solve
      * @param timeStep  dt
      * @param time  the current time
@@ -83,11 +86,44 @@ protected:
 
 private:
 
-    std::vector<double> k1;  /**< Working memory: expression k1 in the RK4 method. */
-    std::vector<double> k2;  /**< Working memory: expression k2 in the RK4 method. */
-    std::vector<double> k3;  /**< Working memory: expression k3 in the RK4 method. */
-    std::vector<double> k4;  /**< Working memory: expression k4 in the RK4 method. */
-    std::vector<double> yki; /**< Working memory: expression yki in the RK4 method. */
+    /**
+     * Calculate the solution to the ODE system at the next timestep, using the
+     * given working memory.
+     *
+     * @param pAbstractOdeSystem  the ODE system to solve
+     * @param timeStep  dt
+     * @param time  the current time
+     * @param rCurrentYValues  the current (initial) state
+     * @param rNextYValues  the state at the next timestep
+     * @param rK1  working memory for k1
+     * @param rK2  working memory for k2
+     * @param rK3  working memory for k3
+     * @param rK4  working memory for k4
+     * @param rYki  working memory for yki
+     */
+    void CalculateNextYValueWithWorkingMemory(AbstractOdeSystem* pAbstractOdeSystem,
+                                              double timeStep,
+                                              double time,
+                                              std::vector<double>& rCurrentYValues,
+                                              std::vector<double>& rNextYValues,
+                                              std::vector<double>& rK1,
+                                              std::vector<double>& rK2,
+                                              std::vector<double>& rK3,
+                                              std::vector<double>& rK4,
+                                              std::vector<double>& rYki);
+
+    std::vector<std::vector<double> > k1;  /**< Working memory, per thread: expression k1 in the RK4 method. */
+    std::vector<std::vector<double> > k2;  /**< Working memory, per thread: expression k2 in the RK4 method. */
+    std::vector<std::vector<double> > k3;  /**< Working memory, per thread: expression k3 in the RK4 method. */
+    std::vector<std::vector<double> > k4;  /**< Working memory, per thread: expression k4 in the RK4 method. */
+    std::vector<std::vector<double> > yki; /**< Working memory, per thread: expression yki in the RK4 method. */
+
+public:
+
+    /**
+     * Constructor.
+     */
+    RungeKutta4IvpOdeSolver();
 
 };
 
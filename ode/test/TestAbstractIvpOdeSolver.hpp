@@ -263,6 +263,38 @@ public:
         TS_ASSERT_DELTA(ode_system.rGetStateVariables()[0], 1.0, 1e-2);
     }
 
+    void TestSharingSolverBetweenThreads()
+    {
+        // One solver is commonly shared by many ODE systems, which may be solved on different threads
+        RungeKutta4IvpOdeSolver rk4_solver;
+        const unsigned num_odes = 100;
+
+        // Set up the system information singleton before any threads need it
+        ParameterisedOde first_ode;
+        TS_ASSERT_EQUALS(first_ode.GetNumberOfStateVariables(), 1u);
+
+        std::vector<double> threaded_results(num_odes);
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif // _OPENMP
+        for (int i=0; i<(int)num_odes; i++)
+        {
+            ParameterisedOde ode; // dy/dt = a, y(0) = 0.
+            ode.SetParameter(0, (double)i);
+            rk4_solver.SolveAndUpdateStateVariable(&ode, 0, 1, 0.01);
+            threaded_results[i] = ode.rGetStateVariables()[0];
+        }
+
+        for (unsigned i=0; i<num_odes; i++)
+        {
+            ParameterisedOde ode;
+            ode.SetParameter(0, (double)i);
+            rk4_solver.SolveAndUpdateStateVariable(&ode, 0, 1, 0.01);
+            TS_ASSERT_EQUALS(threaded_results[i], ode.rGetStateVariables()[0]);
+            TS_ASSERT_DELTA(threaded_results[i], (double)i, 1e-9);
+        }
+    }
+
     void TestWithParameters()
     {
         ParameterisedOde ode; // dy/dt = a, y(0) = 0.
@@ -0,0 +1,120 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTFIXEDSIZEONESTEPIVPODESOLVER_HPP_
+#define TESTFIXEDSIZEONESTEPIVPODESOLVER_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+
+#include "FixedSizeOneStepIvpOdeSolver.hpp"
+#include "EulerIvpOdeSolver.hpp"
+#include "HeunIvpOdeSolver.hpp"
+#include "RungeKutta2IvpOdeSolver.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "OdeThirdOrder.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+class TestFixedSizeOneStepIvpOdeSolver : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Check that a fixed-size solver gives the same answer as the corresponding
+     * one-step solver, including when the last time step has to be shortened.
+     */
+    template<class STEP>
+    void CompareWithOneStepSolver(AbstractOneStepIvpOdeSolver& rSolver)
+    {
+        double end_times[2] = {2.0, 1.005};
+        for (unsigned i=0; i<2; i++)
+        {
+            OdeThirdOrder ode_system;
+
+            std::vector<double> expected = ode_system.GetInitialConditions();
+            rSolver.Solve(&ode_system, expected, 0.0, end_times[i], 0.01);
+
+            std::vector<double> state = ode_system.GetInitialConditions();
+            FixedSizeOneStepIvpOdeSolver<STEP>::template Solve<3>(ode_system, state, 0.0, end_times[i], 0.01);
+
+            for (unsigned j=0; j<3; j++)
+            {
+                TS_ASSERT_DELTA(state[j], expected[j], 1e-12);
+            }
+        }
+    }
+
+public:
+
+    void TestAgreesWithOneStepSolvers() throw(Exception)
+    {
+        EulerIvpOdeSolver euler_solver;
+        CompareWithOneStepSolver<FixedSizeEulerStep>(euler_solver);
+
+        HeunIvpOdeSolver heun_solver;
+        CompareWithOneStepSolver<FixedSizeHeunStep>(heun_solver);
+
+        RungeKutta2IvpOdeSolver rk2_solver;
+        CompareWithOneStepSolver<FixedSizeRungeKutta2Step>(rk2_solver);
+
+        RungeKutta4IvpOdeSolver rk4_solver;
+        CompareWithOneStepSolver<FixedSizeRungeKutta4Step>(rk4_solver);
+    }
+
+    void TestSolveAndUpdateStateVariable() throw(Exception)
+    {
+        OdeThirdOrder ode_system;
+        FixedSizeOneStepIvpOdeSolver<FixedSizeRungeKutta4Step>::SolveAndUpdateStateVariable<3>(ode_system, 0.0, 2.0, 0.001);
+
+        // Exact solution
+        double t = 2.0;
+        std::vector<double>& r_state = ode_system.rGetStateVariables();
+        TS_ASSERT_DELTA(r_state[0], -sin(t), 1e-5);
+        TS_ASSERT_DELTA(r_state[1], sin(t)+cos(t), 1e-5);
+        TS_ASSERT_DELTA(r_state[2], 2*sin(t), 1e-5);
+
+        // Raw arrays work too
+        double y[3] = {0.0, 1.0, 0.0};
+        FixedSizeOneStepIvpOdeSolver<FixedSizeRungeKutta4Step>::Solve<3>(ode_system, y, 0.0, 2.0, 0.001);
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(y[i], r_state[i], 1e-12);
+        }
+    }
+};
+
+#endif /*TESTFIXEDSIZEONESTEPIVPODESOLVER_HPP_*/
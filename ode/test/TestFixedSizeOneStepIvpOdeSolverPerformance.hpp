@@ -0,0 +1,88 @@
+/*
+
+Copyright (c) 2005-2015, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef TESTFIXEDSIZEONESTEPIVPODESOLVERPERFORMANCE_HPP_
+#define TESTFIXEDSIZEONESTEPIVPODESOLVERPERFORMANCE_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+
+#include "FixedSizeOneStepIvpOdeSolver.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "OdeThirdOrder.hpp"
+#include "Timer.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Compares the speed of FixedSizeOneStepIvpOdeSolver with RungeKutta4IvpOdeSolver.
+ * Only run in the profile test pack, as the timings depend on the machine.
+ */
+class TestFixedSizeOneStepIvpOdeSolverPerformance : public CxxTest::TestSuite
+{
+public:
+
+    void TestRungeKutta4Timings() throw(Exception)
+    {
+        OdeThirdOrder ode_system;
+        RungeKutta4IvpOdeSolver rk4_solver;
+
+        std::vector<double> state = ode_system.GetInitialConditions();
+        Timer::Reset();
+        for (unsigned repeat=0; repeat<1000; repeat++)
+        {
+            rk4_solver.Solve(&ode_system, state, 0.0, 1.0, 0.001);
+        }
+        double one_step_time = Timer::GetElapsedTime();
+
+        std::vector<double> fixed_size_state = ode_system.GetInitialConditions();
+        Timer::Reset();
+        for (unsigned repeat=0; repeat<1000; repeat++)
+        {
+            FixedSizeOneStepIvpOdeSolver<FixedSizeRungeKutta4Step>::Solve<3>(ode_system, fixed_size_state, 0.0, 1.0, 0.001);
+        }
+        double fixed_size_time = Timer::GetElapsedTime();
+
+        std::cout << "RK4 for 10^6 steps: RungeKutta4IvpOdeSolver " << one_step_time
+                  << "s, FixedSizeOneStepIvpOdeSolver " << fixed_size_time << "s\n";
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(fixed_size_state[i], state[i], 1e-6*fabs(state[i]) + 1e-12);
+        }
+    }
+};
+
+#endif /*TESTFIXEDSIZEONESTEPIVPODESOLVERPERFORMANCE_HPP_*/
@@ -54,6 +54,11 @@ public:
     }
 
     void EvaluateYDerivatives(double time, const std::vector<double>& rY, std::vector<double>& rDY)
+    {
+        EvaluateFixedSizeYDerivatives(time, &rY[0], &rDY[0]);
+    }
+
+    void EvaluateFixedSizeYDerivatives(double time, const double rY[3], double rDY[3])
     {
         rDY[0] = rY[0]-rY[1]+rY[2];
         rDY[1] = rY[1]-rY[2];
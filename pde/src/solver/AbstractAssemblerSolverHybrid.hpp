@@ -92,6 +92,19 @@ public:
     {
     }
 
+    /**
+     * Use a different boundary conditions container in subsequent solves, for example so that
+     * a solver can be kept from one time step to the next while its boundary conditions change.
+     *
+     * @param pBoundaryConditions pointer to the new boundary conditions
+     */
+    void ResetBoundaryConditionsContainer(BoundaryConditionsContainer<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>* pBoundaryConditions)
+    {
+        assert(pBoundaryConditions);
+        mNaturalNeumannSurfaceTermAssembler.ResetBoundaryConditionsContainer(pBoundaryConditions);
+        mpBoundaryConditions = pBoundaryConditions;
+    }
+
     /**
      * Implementation of AbstractLinearPdeSolver::SetupLinearSystem, using the assembler that this class
      * also inherits from. Concrete classes inheriting from both this class and
@@ -142,6 +142,20 @@ protected:
      */
     void WriteOneStep(double time, Vec solution);
 
+    /**
+     * Called by Solve() once the linear system for a time step has been set up,
+     * to provide the initial guess for its iterative solve. The default is the
+     * solution at the start of the time step. A subclass returning a different
+     * vector keeps ownership of it.
+     *
+     * @param currentSolution  the solution at the start of the time step
+     * @return the initial guess to pass to the linear solver
+     */
+    virtual Vec GetInitialGuessForSolve(Vec currentSolution)
+    {
+        return currentSolution;
+    }
+
 public:
 
     /**
@@ -440,7 +454,7 @@ Vec AbstractDynamicLinearPdeSolver<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::Solve()
             this->mpLinearSystem->ResetKspSolver();
         }
 
-        next_solution = this->mpLinearSystem->Solve(solution);
+        next_solution = this->mpLinearSystem->Solve(this->GetInitialGuessForSolve(solution));
 
         if (mMatrixIsConstant)
         {
@@ -56,6 +56,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *  non-zero Neumann BCs (from the BoundaryConditionsContainer given) are assembled on.
  *
  *  The interface is the same the volume assemblers.
+ *
+ *  If the Neumann boundary conditions do not change with time, SetPrecomputeSurfaceTerms() can be
+ *  used to assemble the surface terms into a vector of their own once, which is then added to the
+ *  vector to be assembled on each call.  The stored terms are discarded if a different
+ *  BoundaryConditionsContainer is given to ResetBoundaryConditionsContainer().
  */
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
 class AbstractFeSurfaceIntegralAssembler : public AbstractFeAssemblerCommon<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM,true,false,NORMAL>
@@ -73,6 +78,12 @@ protected:
     /** Basis function for use with boundary elements. */
     typedef LinearBasisFunction<ELEMENT_DIM-1> SurfaceBasisFunction;
 
+    /** Whether to assemble the surface terms once and store them, see SetPrecomputeSurfaceTerms(). */
+    bool mPrecomputeSurfaceTerms;
+
+    /** The stored surface terms, if mPrecomputeSurfaceTerms is true and they have been assembled. */
+    Vec mPrecomputedSurfaceTerms;
+
     /**
      * @return the vector to be added to full vector
      * for a given Gauss point in BoundaryElement, ie, essentially the
@@ -110,6 +121,13 @@ protected:
                                           c_vector<double, PROBLEM_DIM*ELEMENT_DIM>& rBSurfElem);
 
 
+    /**
+     * Add the contributions of the surface elements with Neumann boundary conditions to a vector.
+     *
+     * @param vector the vector to add to (the values are added, but the vector is not finalised)
+     */
+    void AddSurfaceTerms(Vec vector);
+
     /**
      * Main assemble method. Users should call Assemble() however
      */
@@ -138,8 +156,31 @@ public:
     void ResetBoundaryConditionsContainer(BoundaryConditionsContainer<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>* pBoundaryConditions)
     {
         assert(pBoundaryConditions);
+        if (pBoundaryConditions != this->mpBoundaryConditions && mPrecomputedSurfaceTerms)
+        {
+            PetscTools::Destroy(mPrecomputedSurfaceTerms);
+            mPrecomputedSurfaceTerms = NULL;
+        }
         this->mpBoundaryConditions = pBoundaryConditions;
     }
+
+    /**
+     * Set whether to assemble the surface terms once, store them, and add the stored terms to
+     * the vector on each subsequent assembly.  This is only valid if the Neumann boundary conditions
+     * (and anything else ComputeVectorSurfaceTerm() depends on) do not change with time - a
+     * StimulusBoundaryCondition, for example, does.  Must be called collectively.
+     *
+     * @param precomputeSurfaceTerms whether to store the surface terms
+     */
+    void SetPrecomputeSurfaceTerms(bool precomputeSurfaceTerms)
+    {
+        if (!precomputeSurfaceTerms && mPrecomputedSurfaceTerms)
+        {
+            PetscTools::Destroy(mPrecomputedSurfaceTerms);
+            mPrecomputedSurfaceTerms = NULL;
+        }
+        mPrecomputeSurfaceTerms = precomputeSurfaceTerms;
+    }
 };
 
 
@@ -149,7 +190,9 @@ AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::Abstrac
             BoundaryConditionsContainer<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>* pBoundaryConditions)
     : AbstractFeAssemblerCommon<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM,true,false,NORMAL>(),
       mpMesh(pMesh),
-      mpBoundaryConditions(pBoundaryConditions)
+      mpBoundaryConditions(pBoundaryConditions),
+      mPrecomputeSurfaceTerms(false),
+      mPrecomputedSurfaceTerms(NULL)
 {
     assert(pMesh);
     assert(pBoundaryConditions);
@@ -163,22 +206,21 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
 AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::~AbstractFeSurfaceIntegralAssembler()
 {
     delete mpSurfaceQuadRule;
+    if (mPrecomputedSurfaceTerms)
+    {
+        PetscTools::Destroy(mPrecomputedSurfaceTerms);
+    }
 }
 
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
-void AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::DoAssemble()
+void AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::AddSurfaceTerms(Vec vector)
 {
-    assert(this->mAssembleVector);
-
-    HeartEventHandler::BeginEvent(HeartEventHandler::NEUMANN_BCS);
-
     // Loop over surface elements with non-zero Neumann boundary conditions
     if (mpBoundaryConditions->AnyNonZeroNeumannConditions())
     {
         typename BoundaryConditionsContainer<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::NeumannMapIterator
             neumann_iterator = mpBoundaryConditions->BeginNeumann();
-
         c_vector<double, PROBLEM_DIM*ELEMENT_DIM> b_surf_elem;
 
         // Iterate over defined conditions
@@ -190,10 +232,38 @@ void AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::Do
             const size_t STENCIL_SIZE=PROBLEM_DIM*ELEMENT_DIM; // problem_dim*num_nodes_on_surface_element
             unsigned p_indices[STENCIL_SIZE];
             r_surf_element.GetStiffnessMatrixGlobalIndices(PROBLEM_DIM, p_indices);
-            PetscVecTools::AddMultipleValues<STENCIL_SIZE>(this->mVectorToAssemble, p_indices, b_surf_elem);
+            PetscVecTools::AddMultipleValues<STENCIL_SIZE>(vector, p_indices, b_surf_elem);
             ++neumann_iterator;
         }
     }
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+void AbstractFeSurfaceIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM>::DoAssemble()
+{
+    assert(this->mAssembleVector);
+
+    HeartEventHandler::BeginEvent(HeartEventHandler::NEUMANN_BCS);
+
+    if (mPrecomputeSurfaceTerms)
+    {
+        /*
+         * Every process takes this branch (whether or not it owns any Neumann boundary
+         * elements), as creating and finalising the stored vector are collective.
+         */
+        if (mPrecomputedSurfaceTerms == NULL)
+        {
+            VecDuplicate(this->mVectorToAssemble, &mPrecomputedSurfaceTerms);
+            PetscVecTools::Zero(mPrecomputedSurfaceTerms);
+            AddSurfaceTerms(mPrecomputedSurfaceTerms);
+            PetscVecTools::Finalise(mPrecomputedSurfaceTerms);
+        }
+        PetscVecTools::AddScaledVector(this->mVectorToAssemble, mPrecomputedSurfaceTerms, 1.0);
+    }
+    else
+    {
+        AddSurfaceTerms(this->mVectorToAssemble);
+    }
 
     HeartEventHandler::EndEvent(HeartEventHandler::NEUMANN_BCS);
 }
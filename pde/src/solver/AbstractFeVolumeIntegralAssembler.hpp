@@ -36,7 +36,15 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ABSTRACTFEVOLUMEINTEGRALASSEMBLER_HPP_
 #define ABSTRACTFEVOLUMEINTEGRALASSEMBLER_HPP_
 
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 #include "AbstractFeAssemblerCommon.hpp"
+#include "FirstFailureCollector.hpp"
 #include "GaussianQuadratureRule.hpp"
 #include "BoundaryConditionsContainer.hpp"
 #include "PetscVecTools.hpp"
@@ -73,6 +81,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  * This class inherits from AbstractFeAssemblerCommon which is where some member variables
  * (the matrix/vector to be created, for example) are defined.
+ *
+ * If Chaste is built with OpenMP (the 'openmp' build option) and the concrete class
+ * says that CanAssembleElementsConcurrently(), element contributions are computed
+ * by several threads (see DoAssembleWithThreads()).
  */
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM, bool CAN_ASSEMBLE_VECTOR, bool CAN_ASSEMBLE_MATRIX, InterpolationLevel INTERPOLATION_LEVEL>
 class AbstractFeVolumeIntegralAssembler :
@@ -118,6 +130,17 @@ protected:
      */
     void DoAssemble();
 
+    /**
+     * Threaded version of the element loop in DoAssemble().  Element contributions are
+     * computed concurrently, a batch of elements at a time, and are then added to the
+     * matrix/vector by the calling thread alone in the same order as the serial loop.
+     * This needs no locking around PETSc, and gives exactly the same matrix and vector
+     * as the serial loop whatever the number of threads.
+     *
+     * Only called if CanAssembleElementsConcurrently() returns true.
+     */
+    void DoAssembleWithThreads();
+
 protected:
 
     /**
@@ -217,6 +240,20 @@ protected:
         return true;
     }
 
+    /**
+     * @return true if AssembleOnElement() may be called on different elements at the same
+     * time from different threads, i.e. if ComputeMatrixTerm() and ComputeVectorTerm() only
+     * read the state of the assembler (and of anything it points to), and the interpolation
+     * hooks ResetInterpolatedQuantities() etc. are not used.
+     *
+     * Returns false here so that assembly is serial unless a concrete assembler opts in.
+     * Note that ElementAssemblyCriterion() is always called from a single thread.
+     */
+    virtual bool CanAssembleElementsConcurrently()
+    {
+        return false;
+    }
+
 
 public:
 
@@ -287,38 +324,117 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
         PetscMatTools::Zero(this->mMatrixToAssemble);
     }
 
+    bool use_threads = false;
+#ifdef _OPENMP
+    use_threads = (omp_get_max_threads() > 1) && !omp_in_parallel() && CanAssembleElementsConcurrently();
+#endif // _OPENMP
+
+    if (use_threads)
+    {
+        DoAssembleWithThreads();
+    }
+    else
+    {
+        const size_t STENCIL_SIZE=PROBLEM_DIM*(ELEMENT_DIM+1);
+        c_matrix<double, STENCIL_SIZE, STENCIL_SIZE> a_elem;
+        c_vector<double, STENCIL_SIZE> b_elem;
+
+        // Loop over elements
+        for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator iter = mpMesh->GetElementIteratorBegin();
+             iter != mpMesh->GetElementIteratorEnd();
+             ++iter)
+        {
+            Element<ELEMENT_DIM, SPACE_DIM>& r_element = *iter;
+
+            // Test for ownership first, since it's pointless to test the criterion on something which we might know nothing about.
+            if ( r_element.GetOwnership() == true && ElementAssemblyCriterion(r_element)==true )
+            {
+                AssembleOnElement(r_element, a_elem, b_elem);
+
+                unsigned p_indices[STENCIL_SIZE];
+                r_element.GetStiffnessMatrixGlobalIndices(PROBLEM_DIM, p_indices);
+
+                if (this->mAssembleMatrix)
+                {
+                    PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, p_indices, a_elem);
+                }
+
+                if (this->mAssembleVector)
+                {
+                    PetscVecTools::AddMultipleValues<STENCIL_SIZE>(this->mVectorToAssemble, p_indices, b_elem);
+                }
+            }
+        }
+    }
+
+    HeartEventHandler::EndEvent(assemble_event);
+}
+
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM, bool CAN_ASSEMBLE_VECTOR, bool CAN_ASSEMBLE_MATRIX, InterpolationLevel INTERPOLATION_LEVEL>
+void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_ASSEMBLE_VECTOR, CAN_ASSEMBLE_MATRIX, INTERPOLATION_LEVEL>::DoAssembleWithThreads()
+{
     const size_t STENCIL_SIZE=PROBLEM_DIM*(ELEMENT_DIM+1);
-    c_matrix<double, STENCIL_SIZE, STENCIL_SIZE> a_elem;
-    c_vector<double, STENCIL_SIZE> b_elem;
 
-    // Loop over elements
+    // The number of elements whose contributions are stored at any one time
+    const unsigned BATCH_SIZE = 4096;
+
+    // ElementAssemblyCriterion() may use state of the concrete class, so is evaluated here, serially
+    std::vector<Element<ELEMENT_DIM, SPACE_DIM>*> elements;
     for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator iter = mpMesh->GetElementIteratorBegin();
          iter != mpMesh->GetElementIteratorEnd();
          ++iter)
     {
-        Element<ELEMENT_DIM, SPACE_DIM>& r_element = *iter;
+        if ( iter->GetOwnership() == true && ElementAssemblyCriterion(*iter)==true )
+        {
+            elements.push_back(&(*iter));
+        }
+    }
 
-        // Test for ownership first, since it's pointless to test the criterion on something which we might know nothing about.
-        if ( r_element.GetOwnership() == true && ElementAssemblyCriterion(r_element)==true )
+    const unsigned num_elements = elements.size();
+    std::vector<c_matrix<double, STENCIL_SIZE, STENCIL_SIZE> > a_elems(std::min(BATCH_SIZE, num_elements));
+    std::vector<c_vector<double, STENCIL_SIZE> > b_elems(std::min(BATCH_SIZE, num_elements));
+
+    for (unsigned batch_start=0; batch_start<num_elements; batch_start+=BATCH_SIZE)
+    {
+        const int num_in_batch = (int) std::min(BATCH_SIZE, num_elements-batch_start);
+
+        // Exceptions must not escape a parallel region, so the one for the first element in the batch is thrown once all threads have finished
+        FirstFailureCollector failures;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+        for (int i=0; i<num_in_batch; i++)
         {
-            AssembleOnElement(r_element, a_elem, b_elem);
+            try
+            {
+                AssembleOnElement(*elements[batch_start+i], a_elems[i], b_elems[i]);
+            }
+            catch (Exception& e)
+            {
+                failures.RecordFailure(i, e);
+            }
+        }
+
+        failures.ThrowFirstFailure();
 
+        for (int i=0; i<num_in_batch; i++)
+        {
             unsigned p_indices[STENCIL_SIZE];
-            r_element.GetStiffnessMatrixGlobalIndices(PROBLEM_DIM, p_indices);
+            elements[batch_start+i]->GetStiffnessMatrixGlobalIndices(PROBLEM_DIM, p_indices);
 
             if (this->mAssembleMatrix)
             {
-                PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, p_indices, a_elem);
+                PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, p_indices, a_elems[i]);
             }
 
             if (this->mAssembleVector)
             {
-                PetscVecTools::AddMultipleValues<STENCIL_SIZE>(this->mVectorToAssemble, p_indices, b_elem);
+                PetscVecTools::AddMultipleValues<STENCIL_SIZE>(this->mVectorToAssemble, p_indices, b_elems[i]);
             }
         }
     }
-
-    HeartEventHandler::EndEvent(assemble_event);
 }
 
 
@@ -333,7 +449,7 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
         c_matrix<double, SPACE_DIM, ELEMENT_DIM+1>& rReturnValue)
 {
     assert(ELEMENT_DIM < 4 && ELEMENT_DIM > 0);
-    static c_matrix<double, ELEMENT_DIM, ELEMENT_DIM+1> grad_phi;
+    c_matrix<double, ELEMENT_DIM, ELEMENT_DIM+1> grad_phi;
 
     LinearBasisFunction<ELEMENT_DIM>::ComputeBasisFunctionDerivatives(rPoint, grad_phi);
     rReturnValue = prod(trans(rInverseJacobian), grad_phi);
@@ -59,6 +59,16 @@ private:
     /** Whether to use mass lumping or not. */
     bool mUseMassLumping;
 
+protected:
+
+    /**
+     * @return true, as ComputeMatrixTerm() only reads the state of this class.
+     */
+    bool CanAssembleElementsConcurrently()
+    {
+        return true;
+    }
+
 public:
 
     /**
@@ -49,6 +49,16 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 class StiffnessMatrixAssembler
     : public AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, 1, false /*no vectors*/, true/*assembles matrices*/, NORMAL>
 {
+protected:
+
+    /**
+     * @return true, as ComputeMatrixTerm() only reads the state of this class.
+     */
+    bool CanAssembleElementsConcurrently()
+    {
+        return true;
+    }
+
 public:
 
     /**
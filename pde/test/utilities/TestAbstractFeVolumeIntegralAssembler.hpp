@@ -182,6 +182,61 @@ public:
 };
 
 
+// Assembler with position-dependent terms which can be told whether it is safe to assemble
+// elements concurrently, and to throw when assembling a given element
+template<unsigned DIM>
+class ConcurrentlyAssemblableAssembler : public AbstractFeVolumeIntegralAssembler<DIM,DIM,1,true,true,NORMAL>
+{
+private:
+    bool mConcurrent;
+    unsigned mFailingElementIndex;
+
+    c_matrix<double,1*(DIM+1),1*(DIM+1)> ComputeMatrixTerm(
+        c_vector<double, DIM+1>& rPhi,
+        c_matrix<double, DIM, DIM+1>& rGradPhi,
+        ChastePoint<DIM>& rX,
+        c_vector<double,1>& rU,
+        c_matrix<double, 1, DIM>& rGradU,
+        Element<DIM,DIM>* pElement)
+    {
+        return (1.0 + rX[0])*outer_prod(rPhi, rPhi) + prod(trans(rGradPhi), rGradPhi);
+    }
+
+    c_vector<double,1*(DIM+1)> ComputeVectorTerm(
+        c_vector<double, DIM+1>& rPhi,
+        c_matrix<double, DIM, DIM+1>& rGradPhi,
+        ChastePoint<DIM>& rX,
+        c_vector<double,1>& rU,
+        c_matrix<double, 1, DIM>& rGradU,
+        Element<DIM,DIM>* pElement)
+    {
+        if (pElement->GetIndex() == mFailingElementIndex)
+        {
+            EXCEPTION("Element " << mFailingElementIndex << " failed");
+        }
+        return (rX[0]*rX[DIM-1])*rPhi;
+    }
+
+    bool CanAssembleElementsConcurrently()
+    {
+        return mConcurrent;
+    }
+
+public:
+    ConcurrentlyAssemblableAssembler(AbstractTetrahedralMesh<DIM,DIM>* pMesh, bool concurrent)
+        : AbstractFeVolumeIntegralAssembler<DIM,DIM,1,true,true,NORMAL>(pMesh),
+          mConcurrent(concurrent),
+          mFailingElementIndex(UNSIGNED_UNSET)
+    {
+    }
+
+    void SetFailingElementIndex(unsigned index)
+    {
+        mFailingElementIndex = index;
+    }
+};
+
+
 class TestAbstractFeVolumeIntegralAssembler : public CxxTest::TestSuite
 {
 private:
@@ -592,6 +647,69 @@ public:
         PetscTools::Destroy(mat);
     }
 
+    /*
+     * When Chaste is built with OpenMP, an assembler which says it can assemble elements
+     * concurrently does so using several threads, and should give exactly the same matrix
+     * and vector as a serial assembly.
+     */
+    void TestConcurrentAssemblyMatchesSerialAssembly() throw(Exception)
+    {
+        TetrahedralMesh<3,3> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0, 1.0);
+        unsigned num_nodes = mesh.GetNumNodes();
+
+        Mat serial_mat;
+        Mat concurrent_mat;
+        PetscTools::SetupMat(serial_mat, num_nodes, num_nodes, 27);
+        PetscTools::SetupMat(concurrent_mat, num_nodes, num_nodes, 27);
+        Vec serial_vec = PetscTools::CreateVec(num_nodes);
+        Vec concurrent_vec = PetscTools::CreateVec(num_nodes);
+
+        ConcurrentlyAssemblableAssembler<3> serial_assembler(&mesh, false);
+        serial_assembler.SetMatrixToAssemble(serial_mat);
+        serial_assembler.SetVectorToAssemble(serial_vec, true);
+        serial_assembler.Assemble();
+
+        ConcurrentlyAssemblableAssembler<3> concurrent_assembler(&mesh, true);
+        concurrent_assembler.SetMatrixToAssemble(concurrent_mat);
+        concurrent_assembler.SetVectorToAssemble(concurrent_vec, true);
+        concurrent_assembler.Assemble();
+
+        PetscMatTools::Finalise(serial_mat);
+        PetscMatTools::Finalise(concurrent_mat);
+        PetscVecTools::Finalise(serial_vec);
+        PetscVecTools::Finalise(concurrent_vec);
+
+        ReplicatableVector serial_vec_repl(serial_vec);
+        ReplicatableVector concurrent_vec_repl(concurrent_vec);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_EQUALS(concurrent_vec_repl[i], serial_vec_repl[i]);
+        }
+
+        int lo, hi;
+        MatGetOwnershipRange(serial_mat, &lo, &hi);
+        for (unsigned i=lo; i<(unsigned)hi; i++)
+        {
+            for (unsigned j=0; j<num_nodes; j++)
+            {
+                TS_ASSERT_EQUALS(PetscMatTools::GetElement(concurrent_mat,i,j), PetscMatTools::GetElement(serial_mat,i,j));
+            }
+        }
+
+        // An exception thrown while assembling an element reaches the caller
+        concurrent_assembler.SetFailingElementIndex(mesh.GetNumElements()/2);
+        if (mesh.GetElement(mesh.GetNumElements()/2)->GetOwnership())
+        {
+            TS_ASSERT_THROWS_CONTAINS(concurrent_assembler.Assemble(), "failed");
+        }
+
+        PetscTools::Destroy(serial_mat);
+        PetscTools::Destroy(concurrent_mat);
+        PetscTools::Destroy(serial_vec);
+        PetscTools::Destroy(concurrent_vec);
+    }
+
     void TestInterpolationOfPositionAndCurrentSolution() throw(Exception)
     {
         TetrahedralMesh<1,1> mesh;
@@ -1478,6 +1478,11 @@ def GetBuildType(buildType):
                 obj.build_dir += '_warn'
             except ValueError:
                 pass
+        elif extra == 'openmp':
+            # Use OpenMP threads within each process, e.g. for solving cell models
+            obj._cc_flags.append('-fopenmp')
+            obj._link_flags.append('-fopenmp')
+            obj.build_dir += '_openmp'
         elif extra == 'barriers':
             obj._cc_flags.append('-DCHASTE_EVENT_BARRIERS')
             obj.build_dir += '_barriers'
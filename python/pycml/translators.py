@@ -39,6 +39,7 @@ programming language code, primarily C++ compatible with Chaste, but
 supporting a few other languages also (and easily extensible).
 """
 
+import hashlib
 import optparse
 import os
 import re
@@ -1039,24 +1040,38 @@ class CellMLTranslator(object):
         """Return the equivalent of '1 + (unsigned)((max-min)/step+0.5)'."""
         return '1 + (unsigned)((%s-%s)/%s+0.5)' % (max, min, step)
 
-    def output_lut_generation(self, only_index=None):
+    def output_lut_generation(self, only_index=None, cached=False):
         """Output code to generate lookup tables.
 
         There should be a list of suitable expressions available as self.doc.lookup_tables,
         to save having to search the whole model.
         
         If only_index is given, only generate tables using the given table index key.
+        
+        If cached is True, memory for the tables is obtained from the
+        AbstractLookupTableCollection base class, which may load them from its cache,
+        in which case they are not regenerated.  This requires only_index to be given.
         """
+        assert only_index is not None or not cached
         # Don't use table lookups to generate the tables!
         self.use_lookup_tables = False
         # Allocate memory for tables
         for key, idx in self.doc.lookup_table_indexes.iteritems():
             if only_index is None or only_index == idx:
                 min, max, step, _ = self.lut_parameters(key)
+                num_tables = self.doc.lookup_tables_num_per_index[idx]
                 self.writeln(self.TYPE_CONST_UNSIGNED, '_table_size_', idx, self.EQ_ASSIGN,
                              self.lut_size_calculation(min, max, step), self.STMT_END)
-                self.writeln('_lookup_table_', idx, self.EQ_ASSIGN, 'new double[_table_size_', idx,
-                             '][', self.doc.lookup_tables_num_per_index[idx], ']', self.STMT_END)
+                if cached:
+                    self.writeln('bool _tables_cached_', idx, self.STMT_END)
+                    self.writeln('_lookup_table_', idx, self.EQ_ASSIGN, 'reinterpret_cast<double(*)[', num_tables,
+                                 ']>(AllocateTables(', idx, ', _table_size_', idx, ', _tables_cached_', idx, '))',
+                                 self.STMT_END)
+                    self.writeln('if (!_tables_cached_', idx, ')')
+                    self.open_block()
+                else:
+                    self.writeln('_lookup_table_', idx, self.EQ_ASSIGN, 'new double[_table_size_', idx,
+                                 '][', num_tables, ']', self.STMT_END)
         # Generate each table in a separate loop
         for expr in self.doc.lookup_tables:
             var = expr.component.get_variable_by_name(expr.var)
@@ -1074,12 +1089,23 @@ class CellMLTranslator(object):
             self.output_expr(expr, False)
             self.writeln(self.STMT_END, indent=False)
             self.close_block()
+        if cached:
+            self.writeln('SaveTablesToCache(', only_index, ')', self.STMT_END)
+            self.close_block()
         self.use_lookup_tables = True
 
-    def output_lut_deletion(self, only_index=None):
-        """Output code to delete memory allocated for lookup tables."""
+    def output_lut_deletion(self, only_index=None, cached=False):
+        """Output code to delete memory allocated for lookup tables.
+        
+        If cached is True, the memory was obtained from the AbstractLookupTableCollection
+        base class, and must be released through it.
+        """
         for idx in self.doc.lookup_table_indexes.itervalues():
             if only_index is None or only_index == idx:
+                if cached:
+                    self.writeln('FreeTables(', idx, ')', self.STMT_END)
+                    self.writeln('_lookup_table_', idx, self.EQ_ASSIGN, 'NULL', self.STMT_END)
+                    continue
                 self.writeln('if (_lookup_table_', idx, ')')
                 self.open_block()
                 self.writeln('delete[] _lookup_table_', idx, self.STMT_END)
@@ -2039,6 +2065,19 @@ class CellMLToChasteTranslator(CellMLTranslator):
         else:
             super(CellMLToChasteTranslator, self).output_table_index_generation_code(key, idx)
 
+    def lut_cache_key(self):
+        """Return a string identifying the lookup tables generated for this model.
+        
+        This is used to name the files in which tables are cached at run time, so
+        must change if the table contents could change for the same table settings.
+        """
+        digest = hashlib.md5()
+        digest.update(self.lt_class_name)
+        digest.update(str(self.config.options.include_dt_in_tables))
+        for expr in self.doc.lookup_tables:
+            digest.update(expr.xml().encode('utf-8'))
+        return self.lt_class_name + '_' + digest.hexdigest()
+
     def output_lut_class(self):
         """Output a separate class for lookup tables.
         
@@ -2060,7 +2099,7 @@ class CellMLToChasteTranslator(CellMLTranslator):
         # Method to free the table memory
         self.writeln('void FreeMemory()')
         self.open_block()
-        self.output_lut_deletion()
+        self.output_lut_deletion(cached=True)
         self.writeln('mNeedsRegeneration.assign(mNeedsRegeneration.size(), true);')
         self.close_block()
         # Table lookup methods
@@ -2069,7 +2108,7 @@ class CellMLToChasteTranslator(CellMLTranslator):
         # Destructor
         self.writeln('~', self.lt_class_name, '()')
         self.open_block()
-        self.output_lut_deletion()
+        self.output_lut_deletion(cached=True)
         self.close_block()
         # Make the class a singleton
         self.writeln('protected:', indent_level=0)
@@ -2082,6 +2121,7 @@ class CellMLToChasteTranslator(CellMLTranslator):
         if self.config.options.include_dt_in_tables:
             self.writeln('mDt = HeartConfig::Instance()->GetOdeTimeStep();')
             self.writeln('assert(mDt > 0.0);')
+        self.writeln('mCacheKey = "', self.lut_cache_key(), '";')
         num_indexes = len(self.doc.lookup_table_indexes)
         self.writeln('mKeyingVariableNames.resize(', num_indexes, ');')
         self.writeln('mNumberOfTables.resize(', num_indexes, ');')
@@ -2116,8 +2156,8 @@ class CellMLToChasteTranslator(CellMLTranslator):
         for idx in self.doc.lookup_table_indexes.itervalues():
             self.writeln('if (mNeedsRegeneration[', idx, '])')
             self.open_block()
-            self.output_lut_deletion(only_index=idx)
-            self.output_lut_generation(only_index=idx)
+            self.output_lut_deletion(only_index=idx, cached=True)
+            self.output_lut_generation(only_index=idx, cached=True)
             self.writeln('mNeedsRegeneration[', idx, '] = false;')
             self.close_block(blank_line=True)
         self.writeln(event_handler, 'EndEvent(', event_handler, 'GENERATE_TABLES);')